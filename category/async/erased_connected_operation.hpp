@@ -277,12 +277,16 @@ public:
         deferred
     };
 
+    // Reads are scheduled by AsyncIO in this order, highest first
     enum class io_priority : uint8_t
     {
-        highest,
+        highest, // reads an executing fiber is blocked upon
         normal,
+        traversal, // background walks of the trie, e.g. prefetch
+        compaction, // copying live nodes out of the oldest chunks
         idle
     };
+    static constexpr size_t io_priority_count = 5;
 
 protected:
     operation_type operation_type_{operation_type::unknown};
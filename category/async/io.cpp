@@ -24,6 +24,7 @@
 #include <category/core/assert.h>
 #include <category/core/io/buffers.hpp>
 #include <category/core/io/ring.hpp>
+#include <category/core/metrics/metrics.hpp>
 #include <category/core/tl_tid.h>
 
 #include <boost/container/small_vector.hpp>
@@ -31,6 +32,7 @@
 
 #include <ankerl/unordered_dense.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
 #include <chrono>
@@ -86,6 +88,63 @@
 
 MONAD_ASYNC_NAMESPACE_BEGIN
 
+namespace
+{
+    metrics::Histogram read_latency_histogram(
+        enum erased_connected_operation::io_priority const priority) noexcept
+    {
+        switch (priority) {
+        case erased_connected_operation::io_priority::highest:
+            return metrics::Histogram::io_read_highest;
+        case erased_connected_operation::io_priority::traversal:
+            return metrics::Histogram::io_read_traversal;
+        case erased_connected_operation::io_priority::compaction:
+            return metrics::Histogram::io_read_compaction;
+        case erased_connected_operation::io_priority::idle:
+            return metrics::Histogram::io_read_idle;
+        default:
+            return metrics::Histogram::io_read_normal;
+        }
+    }
+
+    uint16_t
+    to_ioprio(enum erased_connected_operation::io_priority const prio) noexcept
+    {
+        switch (prio) {
+        case erased_connected_operation::io_priority::highest:
+            // Highest level of the best effort class. The realtime class
+            // needs CAP_SYS_ADMIN or CAP_SYS_NICE, else io_uring fails the
+            // read with EPERM, and with it these reads could starve writes.
+            // The pending read queues already submit these first.
+            return IOPRIO_PRIO_VALUE(IOPRIO_CLASS_BE, 0);
+        case erased_connected_operation::io_priority::traversal:
+        case erased_connected_operation::io_priority::compaction:
+            // Lowest level of the default best effort class, so background
+            // reads still make progress on a busy device unlike idle
+            return IOPRIO_PRIO_VALUE(IOPRIO_CLASS_BE, 7);
+        case erased_connected_operation::io_priority::idle:
+            return IOPRIO_PRIO_VALUE(IOPRIO_CLASS_IDLE, 0);
+        default:
+            return 0;
+        }
+    }
+
+    size_t sqe_read_size(struct io_uring_sqe const &sqe)
+    {
+        if (sqe.opcode == IORING_OP_READ_FIXED ||
+            sqe.opcode == IORING_OP_READ) {
+            return sqe.len;
+        }
+        if (sqe.opcode == IORING_OP_READV) {
+            // For readv, read size is the total length of iovecs
+            struct iovec const *iovecs =
+                reinterpret_cast<struct iovec const *>(sqe.addr);
+            return iov_length(std::span<const struct iovec>(iovecs, sqe.len));
+        }
+        MONAD_ABORT("unexpected opcode in deferred read");
+    }
+}
+
 namespace detail
 {
     struct AsyncIO_per_thread_state_t::within_completions_holder
@@ -333,17 +392,7 @@ void AsyncIO::prepare_read_sqe_(
         ci.chunk.read_fd().second + chunk_and_offset.offset,
         0);
     sqe->flags |= IOSQE_FIXED_FILE;
-    switch (prio) {
-    case erased_connected_operation::io_priority::highest:
-        sqe->ioprio = IOPRIO_PRIO_VALUE(IOPRIO_CLASS_RT, 7);
-        break;
-    case erased_connected_operation::io_priority::idle:
-        sqe->ioprio = IOPRIO_PRIO_VALUE(IOPRIO_CLASS_IDLE, 0);
-        break;
-    default:
-        sqe->ioprio = 0;
-        break;
-    }
+    sqe->ioprio = to_ioprio(prio);
 
     io_uring_sqe_set_data(sqe, uring_data);
 }
@@ -381,17 +430,7 @@ void AsyncIO::prepare_read_sqe_(
             ci.chunk.read_fd().second + chunk_and_offset.offset);
     }
     sqe->flags |= IOSQE_FIXED_FILE;
-    switch (prio) {
-    case erased_connected_operation::io_priority::highest:
-        sqe->ioprio = IOPRIO_PRIO_VALUE(IOPRIO_CLASS_RT, 7);
-        break;
-    case erased_connected_operation::io_priority::idle:
-        sqe->ioprio = IOPRIO_PRIO_VALUE(IOPRIO_CLASS_IDLE, 0);
-        break;
-    default:
-        sqe->ioprio = 0;
-        break;
-    }
+    sqe->ioprio = to_ioprio(prio);
 
     io_uring_sqe_set_data(sqe, uring_data);
 }
@@ -473,17 +512,7 @@ void AsyncIO::submit_request_(
     // TODO(niall) test this to see if it helps prevent overwhelming the device
     // with writes
     // sqe->rw_flags |= RWF_DSYNC;
-    switch (prio) {
-    case erased_connected_operation::io_priority::highest:
-        sqe->ioprio = IOPRIO_PRIO_VALUE(IOPRIO_CLASS_RT, 7);
-        break;
-    case erased_connected_operation::io_priority::idle:
-        sqe->ioprio = IOPRIO_PRIO_VALUE(IOPRIO_CLASS_IDLE, 0);
-        break;
-    default:
-        sqe->ioprio = 0;
-        break;
-    }
+    sqe->ioprio = to_ioprio(prio);
 
     io_uring_sqe_set_data(sqe, uring_data);
     MONAD_ASYNC_IO_URING_RETRYABLE(io_uring_submit(wr_ring));
@@ -519,6 +548,142 @@ void AsyncIO::poll_uring_while_submission_queue_full_()
     }
 }
 
+void AsyncIO::read_bandwidth_limit_::refill()
+{
+    auto const now = std::chrono::steady_clock::now();
+    auto const elapsed =
+        std::chrono::duration<double>(now - last_refill).count();
+    last_refill = now;
+    tokens = std::min(
+        tokens + elapsed * double(bytes_per_sec), double(burst_bytes));
+}
+
+bool AsyncIO::read_bandwidth_limit_::try_consume(size_t const bytes)
+{
+    if (bytes_per_sec == 0) {
+        return true;
+    }
+    refill();
+    if (tokens <= 0) {
+        return false;
+    }
+    tokens -= double(bytes);
+    return true;
+}
+
+void AsyncIO::read_bandwidth_limit_::charge(size_t const bytes)
+{
+    if (bytes_per_sec == 0) {
+        return;
+    }
+    refill();
+    tokens -= double(bytes);
+}
+
+std::chrono::nanoseconds
+AsyncIO::read_bandwidth_limit_::until_available() const noexcept
+{
+    if (bytes_per_sec == 0) {
+        return std::chrono::nanoseconds(0);
+    }
+    // One nanosecond past the point at which tokens turn positive
+    auto const deficit = std::max(-tokens, 0.0);
+    auto const due = last_refill +
+                     std::chrono::nanoseconds(int64_t(
+                         deficit * 1e9 / double(bytes_per_sec))) +
+                     std::chrono::nanoseconds(1);
+    return std::max(
+        std::chrono::nanoseconds(0),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            due - std::chrono::steady_clock::now()));
+}
+
+void AsyncIO::set_read_bandwidth_limit(
+    enum erased_connected_operation::io_priority const prio,
+    uint64_t const bytes_per_sec, uint64_t const burst_bytes)
+{
+    auto &limit = read_bandwidth_limits_[size_t(prio)];
+    limit.bytes_per_sec = bytes_per_sec;
+    limit.burst_bytes = (burst_bytes != 0) ? burst_bytes : bytes_per_sec / 10;
+    limit.tokens = double(limit.burst_bytes);
+    limit.last_refill = std::chrono::steady_clock::now();
+}
+
+bool AsyncIO::must_defer_read_(
+    enum erased_connected_operation::io_priority const prio, size_t const size,
+    bool &charged)
+{
+    charged = foreground_reads_depth_ > 0;
+    if (charged) {
+        read_bandwidth_limits_[size_t(prio)].charge(size);
+    }
+    if (concurrent_read_io_limit_ > 0 &&
+        records_.inflight_rd >= concurrent_read_io_limit_) {
+        return true;
+    }
+    if (charged) {
+        return false;
+    }
+    // Background reads within a class are submitted in the order initiated
+    if (!concurrent_read_ios_pending_[size_t(prio)].empty()) {
+        return true;
+    }
+    if (!read_bandwidth_limits_[size_t(prio)].try_consume(size)) {
+        metrics::add(metrics::Counter::io_reads_throttled);
+        return true;
+    }
+    return false;
+}
+
+std::chrono::nanoseconds AsyncIO::throttled_reads_delay_() const noexcept
+{
+    auto ret = std::chrono::nanoseconds::max();
+    for (size_t prio = 0; prio < concurrent_read_ios_pending_.size(); prio++) {
+        if (!concurrent_read_ios_pending_[prio].empty()) {
+            ret = std::min(ret, read_bandwidth_limits_[prio].until_available());
+        }
+    }
+    return ret;
+}
+
+void AsyncIO::dequeue_pending_reads_()
+{
+    auto *const ring = &uring_.get_ring();
+    // Reads an executing fiber waits upon go ahead of all background reads
+    for (size_t prio = 0; prio < concurrent_read_ios_pending_.size(); prio++) {
+        auto &pending = concurrent_read_ios_pending_[prio];
+        while (!pending.empty() &&
+               (concurrent_read_io_limit_ == 0 ||
+                records_.inflight_rd < concurrent_read_io_limit_) &&
+               io_uring_sq_space_left(ring) != 0) {
+            auto it = pending.begin();
+            if (!it->charged && !read_bandwidth_limits_[prio].try_consume(
+                                    sqe_read_size(it->sqe))) {
+                // Out of budget, but foreground reads of this class and
+                // lower priority classes may proceed
+                it = std::find_if(
+                    pending.begin(), pending.end(), [](auto const &read) {
+                        return read.charged;
+                    });
+                if (it == pending.end()) {
+                    break;
+                }
+            }
+
+            // Allocate new SQE and copy the stored one
+            struct io_uring_sqe *sqe = io_uring_get_sqe(ring);
+            MONAD_ASSERT(sqe);
+            *sqe = it->sqe;
+
+            MONAD_ASYNC_IO_URING_RETRYABLE(io_uring_submit(ring));
+
+            account_read_(sqe_read_size(it->sqe));
+
+            pending.erase(it);
+        }
+    }
+}
+
 // return the number of completions processed
 // if blocking is true, will block until at least one completion is processed
 size_t AsyncIO::poll_uring_(bool blocking, unsigned const poll_rings_mask)
@@ -534,45 +699,7 @@ size_t AsyncIO::poll_uring_(bool blocking, unsigned const poll_rings_mask)
     auto *const wr_ring =
         (wr_uring_ != nullptr) ? &wr_uring_->get_ring() : nullptr;
 
-    auto dequeue_concurrent_read_ios_pending = [&]() {
-        if (concurrent_read_io_limit_ > 0) {
-            while (!concurrent_read_ios_pending_.empty() &&
-                   records_.inflight_rd < concurrent_read_io_limit_ &&
-                   io_uring_sq_space_left(other_ring) != 0) {
-                auto const &stored_sqe = concurrent_read_ios_pending_.front();
-
-                // Allocate new SQE and copy the stored one
-                struct io_uring_sqe *sqe = io_uring_get_sqe(other_ring);
-                MONAD_ASSERT(sqe);
-                *sqe = stored_sqe;
-
-                MONAD_ASYNC_IO_URING_RETRYABLE(io_uring_submit(other_ring));
-
-                // Calculate read size from the SQE
-                size_t read_size;
-                if (sqe->opcode == IORING_OP_READ_FIXED ||
-                    sqe->opcode == IORING_OP_READ) {
-                    read_size = sqe->len;
-                }
-                else if (sqe->opcode == IORING_OP_READV) {
-                    // For readv, read size is the total length of iovecs
-                    struct iovec const *iovecs =
-                        reinterpret_cast<struct iovec const *>(sqe->addr);
-                    read_size = iov_length(
-                        std::span<const struct iovec>(iovecs, sqe->len));
-                }
-                else {
-                    MONAD_ABORT("unexpected opcode in deferred read");
-                }
-
-                account_read_(read_size);
-
-                concurrent_read_ios_pending_.pop_front();
-            }
-        }
-    };
-
-    dequeue_concurrent_read_ios_pending();
+    dequeue_pending_reads_();
 
     io_uring *ring = nullptr;
     erased_connected_operation *state = nullptr;
@@ -614,7 +741,27 @@ size_t AsyncIO::poll_uring_(bool blocking, unsigned const poll_rings_mask)
             }
             if (blocking && records_.inflight_wr == 0 &&
                 detail::AsyncIO_per_thread_state().empty()) {
-                MONAD_ASYNC_IO_URING_RETRYABLE(io_uring_wait_cqe(ring, &cqe));
+                if (records_.inflight_rd == 0 && reads_pending_() > 0) {
+                    // Only reads out of bandwidth budget remain, no
+                    // completion can arrive before the budget refills
+                    auto const delay = throttled_reads_delay_();
+                    __kernel_timespec ts{
+                        .tv_sec = delay.count() / 1000000000,
+                        .tv_nsec = delay.count() % 1000000000};
+                    int r;
+                    do {
+                        r = io_uring_wait_cqe_timeout(ring, &cqe, &ts);
+                    }
+                    while (r == -EINTR);
+                    if (r == -ETIME) {
+                        return false;
+                    }
+                    MONAD_ASSERT(r == 0);
+                }
+                else {
+                    MONAD_ASYNC_IO_URING_RETRYABLE(
+                        io_uring_wait_cqe(ring, &cqe));
+                }
             }
             else {
                 // If nothing in io_uring, return false
@@ -648,6 +795,7 @@ size_t AsyncIO::poll_uring_(bool blocking, unsigned const poll_rings_mask)
                 res.has_error() &&
                 res.assume_error() == errc::resource_unavailable_try_again) {
                 records_.reads_retried++;
+                metrics::add(metrics::Counter::io_reads_retried);
                 /* This is what the io_uring source code does when
                 EAGAIN comes back in a cqe and the submission queue
                 is full. It effectively is a "hard pace", and given how
@@ -663,6 +811,14 @@ size_t AsyncIO::poll_uring_(bool blocking, unsigned const poll_rings_mask)
             }
             return false;
         };
+        auto record_read_latency = [&] {
+            metrics::add(metrics::Counter::io_reads_completed);
+            if (capture_io_latencies_) {
+                metrics::record(
+                    read_latency_histogram(state->io_priority()),
+                    state->elapsed);
+            }
+        };
         bool is_read_or_write = false;
         if (state->is_read()) {
             --records_.inflight_rd;
@@ -670,8 +826,9 @@ size_t AsyncIO::poll_uring_(bool blocking, unsigned const poll_rings_mask)
             if (retry_operation_if_temporary_failure()) {
                 return true;
             }
+            record_read_latency();
             // Speculative read i/o deque
-            dequeue_concurrent_read_ios_pending();
+            dequeue_pending_reads_();
         }
         else if (state->is_write()) {
             --records_.inflight_wr;
@@ -682,7 +839,8 @@ size_t AsyncIO::poll_uring_(bool blocking, unsigned const poll_rings_mask)
             if (retry_operation_if_temporary_failure()) {
                 return true;
             }
-            dequeue_concurrent_read_ios_pending();
+            record_read_latency();
+            dequeue_pending_reads_();
         }
 #ifndef NDEBUG
         else {
@@ -17,6 +17,7 @@
 
 #include <category/async/connected_operation.hpp>
 
+#include <category/async/detail/scope_polyfill.hpp>
 #include <category/async/storage_pool.hpp>
 
 #include <category/core/io/buffer_pool.hpp>
@@ -25,8 +26,10 @@
 
 #include <category/core/mem/allocators.hpp>
 
+#include <array>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <concepts>
 #include <cstddef>
 #include <deque>
@@ -91,9 +94,61 @@ private:
     IORecord records_;
     unsigned concurrent_read_io_limit_{0};
 
-    // Reads which could not be submitted immediately because the limit on
-    // concurrent reads was reached. Each entry is a fully prepared SQE.
-    std::deque<struct io_uring_sqe> concurrent_read_ios_pending_;
+    // Token bucket capping the read bandwidth of one priority class
+    struct read_bandwidth_limit_
+    {
+        uint64_t bytes_per_sec{0}; // zero is unlimited
+        uint64_t burst_bytes{0};
+        // May go negative, a read is admitted while any tokens remain
+        double tokens{0};
+        std::chrono::steady_clock::time_point last_refill;
+
+        void refill();
+        bool try_consume(size_t bytes);
+        void charge(size_t bytes);
+        std::chrono::nanoseconds until_available() const noexcept;
+    };
+
+    // Reads initiated while non-zero are foreground, see foreground_reads()
+    unsigned foreground_reads_depth_{0};
+
+    struct pending_read_
+    {
+        struct io_uring_sqe sqe;
+        // Foreground reads are charged to their class's bandwidth budget
+        // when initiated and wait only for a read slot
+        bool charged;
+    };
+
+    // Reads which could not be submitted immediately, either because the
+    // limit on concurrent reads was reached or because their priority class
+    // ran out of read bandwidth. Each entry holds a fully prepared SQE.
+    // Queues are indexed by io_priority and drained highest priority first.
+    std::array<
+        std::deque<pending_read_>,
+        erased_connected_operation::io_priority_count>
+        concurrent_read_ios_pending_;
+    std::array<
+        read_bandwidth_limit_, erased_connected_operation::io_priority_count>
+        read_bandwidth_limits_;
+
+    unsigned reads_pending_() const noexcept
+    {
+        size_t ret = 0;
+        for (auto const &pending : concurrent_read_ios_pending_) {
+            ret += pending.size();
+        }
+        return static_cast<unsigned>(ret);
+    }
+
+    // Whether a read must wait in its priority class's queue. Sets
+    // `charged` if the read was charged to its class's bandwidth budget.
+    bool must_defer_read_(
+        enum erased_connected_operation::io_priority prio, size_t size,
+        bool &charged);
+    void dequeue_pending_reads_();
+    // How long until a read waiting only on bandwidth budget may proceed
+    std::chrono::nanoseconds throttled_reads_delay_() const noexcept;
 
     void submit_request_(
         std::span<std::byte> buffer, chunk_offset_t chunk_and_offset,
@@ -175,15 +230,19 @@ public:
 
     unsigned io_in_flight() const noexcept
     {
-        return records_.inflight_rd +
-               static_cast<unsigned>(concurrent_read_ios_pending_.size()) +
-               records_.inflight_wr + deferred_initiations_in_flight();
+        return records_.inflight_rd + reads_pending_() + records_.inflight_wr +
+               deferred_initiations_in_flight();
     }
 
     unsigned reads_in_flight() const noexcept
     {
-        return records_.inflight_rd +
-               static_cast<unsigned>(concurrent_read_ios_pending_.size());
+        return records_.inflight_rd + reads_pending_();
+    }
+
+    //! Reads initiated but waiting for a read slot or bandwidth budget
+    unsigned reads_pending() const noexcept
+    {
+        return reads_pending_();
     }
 
     unsigned max_reads_in_flight() const noexcept
@@ -223,6 +282,38 @@ public:
         concurrent_read_io_limit_ = v;
     }
 
+    uint64_t read_bandwidth_limit(
+        enum erased_connected_operation::io_priority const prio) const noexcept
+    {
+        return read_bandwidth_limits_[size_t(prio)].bytes_per_sec;
+    }
+
+    //! Caps the read bandwidth of a priority class, reads over budget wait
+    //! in their class's queue. Zero removes the cap. `burst_bytes` defaults
+    //! to a tenth of a second's worth.
+    void set_read_bandwidth_limit(
+        enum erased_connected_operation::io_priority prio,
+        uint64_t bytes_per_sec, uint64_t burst_bytes = 0);
+
+    //! Bytes left in the bandwidth budget of a capped priority class as of
+    //! its last read, negative once overdrawn
+    double read_bandwidth_tokens(
+        enum erased_connected_operation::io_priority const prio) const noexcept
+    {
+        return read_bandwidth_limits_[size_t(prio)].tokens;
+    }
+
+    //! Reads initiated while the returned guard lives are foreground: they
+    //! are charged to their class's bandwidth budget but never wait for it.
+    //! A block commit waits on all the reads of its upsert, including the
+    //! compaction ones, so those must not be held back by a cap.
+    auto foreground_reads() noexcept
+    {
+        ++foreground_reads_depth_;
+        return monad::make_scope_exit(
+            [this]() noexcept { --foreground_reads_depth_; });
+    }
+
     bool eager_completions() const noexcept
     {
         return eager_completions_;
@@ -327,16 +418,18 @@ public:
             uring_data->initiated = std::chrono::steady_clock::now();
         }
 
-        if (concurrent_read_io_limit_ > 0 &&
-            records_.inflight_rd >= concurrent_read_io_limit_) {
-            auto &sqe = concurrent_read_ios_pending_.emplace_back();
-            prepare_read_sqe_(
-                &sqe, buffer, offset, uring_data, uring_data->io_priority());
+        auto const prio = uring_data->io_priority();
+        bool charged;
+        if (must_defer_read_(prio, buffer.size(), charged)) {
+            auto &pending =
+                concurrent_read_ios_pending_[size_t(prio)].emplace_back();
+            pending.charged = charged;
+            prepare_read_sqe_(&pending.sqe, buffer, offset, uring_data, prio);
             return size_t(-1); // we never complete immediately
         }
 
         auto const size = buffer.size();
-        submit_request_(buffer, offset, uring_data, uring_data->io_priority());
+        submit_request_(buffer, offset, uring_data, prio);
         account_read_(size);
         return size_t(-1); // we never complete immediately
     }
@@ -351,15 +444,17 @@ public:
             uring_data->initiated = std::chrono::steady_clock::now();
         }
 
-        if (concurrent_read_io_limit_ > 0 &&
-            records_.inflight_rd >= concurrent_read_io_limit_) {
-            auto &sqe = concurrent_read_ios_pending_.emplace_back();
-            prepare_read_sqe_(
-                &sqe, buffers, offset, uring_data, uring_data->io_priority());
+        auto const prio = uring_data->io_priority();
+        bool charged;
+        if (must_defer_read_(prio, iov_length(buffers), charged)) {
+            auto &pending =
+                concurrent_read_ios_pending_[size_t(prio)].emplace_back();
+            pending.charged = charged;
+            prepare_read_sqe_(&pending.sqe, buffers, offset, uring_data, prio);
             return size_t(-1); // we never complete immediately
         }
 
-        submit_request_(buffers, offset, uring_data, uring_data->io_priority());
+        submit_request_(buffers, offset, uring_data, prio);
         account_read_(iov_length(buffers));
         return size_t(-1); // we never complete immediately
     }
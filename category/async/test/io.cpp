@@ -27,6 +27,8 @@
 #include <category/core/io/ring.hpp>
 #include <category/core/test_util/gtest_signal_stacktrace_printer.hpp> // NOLINT
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
@@ -311,4 +313,185 @@ namespace
         EXPECT_EQ(completed, NUM_READS);
         EXPECT_EQ(testio.reads_in_flight(), 0u);
     }
+
+    struct priority_order_receiver
+    {
+        static constexpr bool lifetime_managed_internally = true;
+
+        std::vector<
+            enum monad::async::erased_connected_operation::io_priority> &order;
+
+        void set_value(
+            monad::async::erased_connected_operation *const io_state,
+            monad::async::read_single_buffer_sender::result_type const r)
+        {
+            MONAD_ASSERT(r);
+            order.push_back(io_state->io_priority());
+        }
+    };
+
+    TEST(AsyncIO, pending_reads_drain_highest_priority_first)
+    {
+        using io_priority =
+            enum monad::async::erased_connected_operation::io_priority;
+        monad::async::storage_pool pool(
+            monad::async::use_anonymous_inode_tag{});
+        monad::io::Ring testring;
+        monad::io::Buffers testrwbuf = monad::io::make_buffers_for_read_only(
+            testring, 10, monad::async::AsyncIO::MONAD_IO_BUFFERS_READ_SIZE);
+        monad::async::AsyncIO testio(pool, testrwbuf);
+        testio.set_concurrent_read_io_limit(1);
+
+        std::vector<io_priority> order;
+        auto const initiate = [&](io_priority const prio) {
+            auto state = testio.make_connected(
+                monad::async::read_single_buffer_sender(
+                    {0, 0}, monad::async::DISK_PAGE_SIZE),
+                priority_order_receiver{order});
+            state->set_io_priority(prio);
+            state->initiate();
+            (void)state.release();
+        };
+        // The first read takes the only slot, the rest queue behind it
+        initiate(io_priority::normal);
+        for (size_t n = 0; n < 3; n++) {
+            initiate(io_priority::compaction);
+            initiate(io_priority::traversal);
+            initiate(io_priority::highest);
+        }
+        testio.wait_until_done();
+
+        std::vector<io_priority> const expected{
+            io_priority::normal,
+            io_priority::highest,
+            io_priority::highest,
+            io_priority::highest,
+            io_priority::traversal,
+            io_priority::traversal,
+            io_priority::traversal,
+            io_priority::compaction,
+            io_priority::compaction,
+            io_priority::compaction};
+        EXPECT_EQ(order, expected);
+    }
+
+    TEST(AsyncIO, read_bandwidth_limit_throttles_only_its_class)
+    {
+        using io_priority =
+            enum monad::async::erased_connected_operation::io_priority;
+        monad::async::storage_pool pool(
+            monad::async::use_anonymous_inode_tag{});
+        monad::io::Ring testring;
+        monad::io::Buffers testrwbuf = monad::io::make_buffers_for_read_only(
+            testring, 32, monad::async::AsyncIO::MONAD_IO_BUFFERS_READ_SIZE);
+        monad::async::AsyncIO testio(pool, testrwbuf);
+        // Twenty pages a second with a burst of two pages
+        testio.set_read_bandwidth_limit(
+            io_priority::compaction, 20 * monad::async::DISK_PAGE_SIZE);
+        EXPECT_EQ(
+            testio.read_bandwidth_limit(io_priority::compaction),
+            20 * monad::async::DISK_PAGE_SIZE);
+
+        std::vector<io_priority> order;
+        auto const initiate = [&](io_priority const prio) {
+            auto state = testio.make_connected(
+                monad::async::read_single_buffer_sender(
+                    {0, 0}, monad::async::DISK_PAGE_SIZE),
+                priority_order_receiver{order});
+            state->set_io_priority(prio);
+            state->initiate();
+            (void)state.release();
+        };
+        for (size_t n = 0; n < 10; n++) {
+            initiate(io_priority::compaction);
+        }
+        // Nothing has been reaped yet, so every read not submitted is
+        // queued. The burst admits two pages, plus at most one more read
+        // for the budget refilled since.
+        ASSERT_TRUE(order.empty());
+        auto const submitted = testio.total_reads_submitted();
+        EXPECT_GE(submitted, 2u);
+        EXPECT_LE(submitted, 3u);
+        EXPECT_EQ(testio.reads_in_flight(), 10u);
+        EXPECT_EQ(testio.max_reads_in_flight(), submitted);
+        // Unthrottled classes are not held up by the throttled one
+        initiate(io_priority::normal);
+        EXPECT_EQ(testio.total_reads_submitted(), submitted + 1);
+        EXPECT_EQ(testio.reads_in_flight(), 11u);
+        testio.wait_until_done();
+
+        EXPECT_EQ(testio.total_reads_submitted(), 11u);
+        EXPECT_EQ(testio.reads_in_flight(), 0u);
+        ASSERT_EQ(order.size(), 11u);
+        EXPECT_EQ(std::ranges::count(order, io_priority::compaction), 10);
+    }
+
+    TEST(AsyncIO, foreground_reads_are_charged_but_not_throttled)
+    {
+        using io_priority =
+            enum monad::async::erased_connected_operation::io_priority;
+        constexpr double page = monad::async::DISK_PAGE_SIZE;
+        monad::async::storage_pool pool(
+            monad::async::use_anonymous_inode_tag{});
+        monad::io::Ring testring;
+        monad::io::Buffers testrwbuf = monad::io::make_buffers_for_read_only(
+            testring, 32, monad::async::AsyncIO::MONAD_IO_BUFFERS_READ_SIZE);
+        monad::async::AsyncIO testio(pool, testrwbuf);
+        // A burst of two pages, refilled at a negligible byte per second
+        testio.set_read_bandwidth_limit(
+            io_priority::compaction, 1, 2 * monad::async::DISK_PAGE_SIZE);
+
+        std::vector<io_priority> order;
+        auto const initiate = [&](io_priority const prio) {
+            auto state = testio.make_connected(
+                monad::async::read_single_buffer_sender(
+                    {0, 0}, monad::async::DISK_PAGE_SIZE),
+                priority_order_receiver{order});
+            state->set_io_priority(prio);
+            state->initiate();
+            (void)state.release();
+        };
+        {
+            auto const foreground = testio.foreground_reads();
+            for (size_t n = 0; n < 6; n++) {
+                initiate(io_priority::compaction);
+            }
+        }
+        // Every foreground read is submitted and charged, overdrawing the
+        // budget by four pages
+        EXPECT_EQ(testio.total_reads_submitted(), 6u);
+        EXPECT_EQ(testio.reads_pending(), 0u);
+        EXPECT_NEAR(
+            testio.read_bandwidth_tokens(io_priority::compaction),
+            -4 * page,
+            1);
+
+        // A background read of the class waits for the overdraft to be
+        // repaid, and is not charged meanwhile
+        initiate(io_priority::compaction);
+        EXPECT_EQ(testio.total_reads_submitted(), 6u);
+        EXPECT_EQ(testio.reads_pending(), 1u);
+        EXPECT_NEAR(
+            testio.read_bandwidth_tokens(io_priority::compaction),
+            -4 * page,
+            1);
+
+        // A foreground read does not queue behind it
+        {
+            auto const foreground = testio.foreground_reads();
+            initiate(io_priority::compaction);
+        }
+        EXPECT_EQ(testio.total_reads_submitted(), 7u);
+        EXPECT_EQ(testio.reads_pending(), 1u);
+        EXPECT_NEAR(
+            testio.read_bandwidth_tokens(io_priority::compaction),
+            -5 * page,
+            1);
+
+        // Lifting the cap releases the background read
+        testio.set_read_bandwidth_limit(io_priority::compaction, 0);
+        testio.wait_until_done();
+        EXPECT_EQ(testio.total_reads_submitted(), 8u);
+        EXPECT_EQ(order.size(), 8u);
+    }
 }
@@ -28,6 +28,8 @@
 #include <category/core/event/event_ring_util.h>
 
 #include <filesystem>
+#include <format>
+#include <string>
 
 #include <errno.h>
 #include <fcntl.h>
@@ -97,3 +99,64 @@ TEST(EventSnapshotTest, Decompress)
     ASSERT_EQ(-1, fd_out);
     close(fd_in);
 }
+
+TEST(EventReaderLockTest, AttachReader)
+{
+    int const writer_fd = memfd_create("reader-lock-test", 0);
+    ASSERT_NE(writer_fd, -1);
+    ASSERT_EQ(0, ftruncate(writer_fd, 4096));
+
+    bool has_readers;
+    ASSERT_EQ(0, monad_event_ring_query_readers(writer_fd, &has_readers));
+    EXPECT_FALSE(has_readers);
+
+    // A reader opens its own file description, the same way a separate
+    // process would
+    std::string const fd_path = std::format("/proc/self/fd/{}", writer_fd);
+    int const reader_fd = open(fd_path.c_str(), O_RDONLY);
+    ASSERT_NE(reader_fd, -1);
+    ASSERT_EQ(0, monad_event_ring_attach_reader(reader_fd));
+    ASSERT_EQ(0, monad_event_ring_query_readers(writer_fd, &has_readers));
+    EXPECT_TRUE(has_readers);
+
+    // Closing the reader's descriptor releases the lock
+    close(reader_fd);
+    ASSERT_EQ(0, monad_event_ring_query_readers(writer_fd, &has_readers));
+    EXPECT_FALSE(has_readers);
+    close(writer_fd);
+}
+
+TEST(EventReaderLockTest, MmapAttachesReader)
+{
+    fs::path const snapshot_file =
+        fs::path{TEST_DATA_DIR} / "data" / "event" / "emn-1b-15m.snapshot";
+    int const fd_in = open(snapshot_file.c_str(), O_RDONLY);
+    ASSERT_NE(fd_in, -1);
+    int writer_fd;
+    ASSERT_EQ(
+        0,
+        monad_event_decompress_snapshot_fd(
+            fd_in, MONAD_EVENT_NO_MAX_SIZE, snapshot_file.c_str(), &writer_fd));
+    close(fd_in);
+
+    // A read-only mapping holds the reader lock after the reader closes its
+    // own descriptor, until the ring is unmapped
+    std::string const fd_path = std::format("/proc/self/fd/{}", writer_fd);
+    int const reader_fd = open(fd_path.c_str(), O_RDONLY);
+    ASSERT_NE(reader_fd, -1);
+    monad_event_ring ring;
+    ASSERT_EQ(
+        0,
+        monad_event_ring_mmap(
+            &ring, PROT_READ, 0, reader_fd, 0, snapshot_file.c_str()));
+    close(reader_fd);
+
+    bool has_readers;
+    ASSERT_EQ(0, monad_event_ring_query_readers(writer_fd, &has_readers));
+    EXPECT_TRUE(has_readers);
+
+    monad_event_ring_unmap(&ring);
+    ASSERT_EQ(0, monad_event_ring_query_readers(writer_fd, &has_readers));
+    EXPECT_FALSE(has_readers);
+    close(writer_fd);
+}
@@ -28,6 +28,7 @@
 #include <category/core/event/event_iterator.h>
 #include <category/core/event/event_recorder.h>
 #include <category/core/event/event_ring.h>
+#include <category/core/event/event_ring_util.h>
 #include <category/core/format_err.h>
 #include <category/core/srcloc.h>
 
@@ -228,6 +229,7 @@ int monad_event_ring_mmap(
     }
 
     event_ring->mmap_prot = mmap_prot;
+    event_ring->reader_lock_fd = -1;
     header = event_ring->header = mmap(
         nullptr,
         HEADER_SIZE,
@@ -347,6 +349,25 @@ int monad_event_ring_mmap(
         }
     }
 
+    // Readers hold the reader lock for as long as the ring is mapped, so that
+    // a writer recording only while someone reads sees every SDK reader. The
+    // lock belongs to the open file description, which a duplicate descriptor
+    // keeps alive after the caller closes `ring_fd`
+    if ((mmap_prot & PROT_WRITE) == 0) {
+        event_ring->reader_lock_fd = fcntl(ring_fd, F_DUPFD_CLOEXEC, 0);
+        if (event_ring->reader_lock_fd == -1) {
+            rc = FORMAT_ERRC(
+                errno,
+                "dup of event ring file `%s` descriptor failed",
+                error_name);
+            goto Error;
+        }
+        rc = monad_event_ring_attach_reader(event_ring->reader_lock_fd);
+        if (rc != 0 && rc != ENOSYS) {
+            goto Error;
+        }
+    }
+
     return 0;
 
 Error:
@@ -371,6 +392,9 @@ void monad_event_ring_unmap(struct monad_event_ring *const event_ring)
             munmap(event_ring->context_area, header->size.context_area_size);
         }
         munmap((void *)header, HEADER_SIZE);
+        if (event_ring->reader_lock_fd != -1) {
+            (void)close(event_ring->reader_lock_fd);
+        }
     }
     memset(event_ring, 0, sizeof *event_ring);
 }
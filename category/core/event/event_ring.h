@@ -53,6 +53,7 @@ enum monad_event_record_error_type : uint16_t;
 struct monad_event_ring
 {
     int mmap_prot;                              ///< Our pages mmap'ed with this
+    int reader_lock_fd;                         ///< Holds reader lock, or -1
     struct monad_event_ring_header *header;     ///< Event ring metadata
     struct monad_event_descriptor *descriptors; ///< Event descriptor ring array
     uint8_t *payload_buf;                       ///< Payload buffer base address
@@ -144,7 +145,9 @@ int monad_event_ring_init_file(
 
 /// Given an open file descriptor which contains an initialized event ring at
 /// `ring_offset`, mmap the event ring into our address space; mmap_extra_flags
-/// is OR'ed with MAP_SHARED to produce the final flags
+/// is OR'ed with MAP_SHARED to produce the final flags. A read-only mapping
+/// also attaches as a reader (see monad_event_ring_attach_reader) until the
+/// ring is unmapped, so `ring_fd` may be closed as soon as this returns
 int monad_event_ring_mmap(
     struct monad_event_ring *, int mmap_prot, int mmap_extra_flags, int ring_fd,
     off_t ring_offset, char const *error_name);
@@ -87,6 +87,18 @@ int monad_event_ring_query_flocks(
 /// monad_event_ring_query_flocks function
 int monad_event_ring_query_excl_writer_pid(int ring_fd, pid_t *pid);
 
+/// Place a shared open file description lock (see F_OFD_SETLK in fcntl(2))
+/// on the first byte of the event ring file, telling the writer that a reader
+/// is attached; monad_event_ring_mmap does this for every read-only mapping.
+/// These locks are independent of the writer's flock(2) lock, and are released
+/// when the last descriptor for the open file description is closed
+int monad_event_ring_attach_reader(int ring_fd);
+
+/// Check whether any process holds the lock placed by
+/// monad_event_ring_attach_reader; the writer uses this to skip recording
+/// entirely when nobody is reading
+int monad_event_ring_query_readers(int ring_fd, bool *has_readers);
+
 /// Given a path to a file (which does not need to exist), check if the
 /// associated file system supports that file being mmap'ed with MAP_HUGETLB
 int monad_check_path_supports_map_hugetlb(char const *path, bool *supported);
@@ -123,3 +123,37 @@ int monad_event_ring_query_flocks(
     }
     return 0; // NOLINT(clang-analyzer-unix.Stream)
 }
+
+static void init_reader_lock(struct flock *const fl, short const type)
+{
+    memset(fl, 0, sizeof *fl);
+    fl->l_type = type;
+    fl->l_whence = SEEK_SET;
+    fl->l_start = 0;
+    fl->l_len = 1;
+}
+
+int monad_event_ring_attach_reader(int const ring_fd)
+{
+    struct flock fl;
+
+    init_reader_lock(&fl, F_RDLCK);
+    if (fcntl(ring_fd, F_OFD_SETLK, &fl) == -1) {
+        return FORMAT_ERRC(errno, "fcntl(F_OFD_SETLK) failed");
+    }
+    return 0;
+}
+
+int monad_event_ring_query_readers(int const ring_fd, bool *const has_readers)
+{
+    struct flock fl;
+
+    // Ask whether a write lock on the reader byte could be placed; any
+    // reader's shared lock would conflict with it
+    init_reader_lock(&fl, F_WRLCK);
+    if (fcntl(ring_fd, F_OFD_GETLK, &fl) == -1) {
+        return FORMAT_ERRC(errno, "fcntl(F_OFD_GETLK) failed");
+    }
+    *has_readers = fl.l_type != F_UNLCK;
+    return 0;
+}
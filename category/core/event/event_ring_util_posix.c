@@ -35,3 +35,13 @@ int monad_event_ring_query_flocks(
 {
     return FORMAT_ERRC(ENOSYS, "function not available on non-Linux platforms");
 }
+
+int monad_event_ring_attach_reader(int)
+{
+    return FORMAT_ERRC(ENOSYS, "function not available on non-Linux platforms");
+}
+
+int monad_event_ring_query_readers(int, bool *)
+{
+    return FORMAT_ERRC(ENOSYS, "function not available on non-Linux platforms");
+}
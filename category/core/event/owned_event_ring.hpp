@@ -47,6 +47,11 @@ public:
         return &event_ring_;
     }
 
+    int get_ring_fd() const
+    {
+        return ring_fd_;
+    }
+
 private:
     monad_event_ring event_ring_;
     std::string ring_path_;
@@ -65,6 +65,13 @@ public:
     {
         return *fiber_group_;
     }
+
+    /// Create another FiberGroup on the threads of this pool, with its own
+    /// task queue. It must be destroyed before the pool.
+    std::unique_ptr<FiberGroup> create_fiber_group(unsigned const n_fibers)
+    {
+        return thread_pool_->create_fiber_group(n_fibers);
+    }
 };
 
 MONAD_FIBER_NAMESPACE_END
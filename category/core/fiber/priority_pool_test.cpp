@@ -15,13 +15,18 @@
 
 #include <gtest/gtest.h>
 
+#include <category/core/fiber/fiber_group.hpp>
 #include <category/core/fiber/priority_pool.hpp>
 
 #include <category/core/test_util/gtest_signal_stacktrace_printer.hpp> // NOLINT
 
+#include <boost/fiber/future/future.hpp>
+#include <boost/fiber/future/promise.hpp>
+
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -147,3 +152,33 @@ TEST(PriorityPool, move_only_functor)
 
     EXPECT_EQ(result.load(std::memory_order_acquire), 42);
 }
+
+TEST(PriorityPool, extra_fiber_group_does_not_block_pool)
+{
+    monad::fiber::PriorityPool ppool(1, 2);
+    auto const group = ppool.create_fiber_group(2);
+
+    // Occupy every fiber of the extra group, and queue more work behind
+    boost::fibers::promise<void> gate;
+    boost::fibers::shared_future<void> const opened = gate.get_future();
+    std::atomic<int> background_done{0};
+    for (int i = 0; i < 4; ++i) {
+        group->submit(uint64_t{1} << 32, [&opened, &background_done] {
+            opened.wait();
+            background_done.fetch_add(1, std::memory_order_release);
+        });
+    }
+
+    // Work submitted to the pool afterwards still runs
+    std::atomic<bool> done{false};
+    ppool.submit(0, [&done] { done.store(true, std::memory_order_release); });
+    while (!done.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(background_done.load(std::memory_order_acquire), 0);
+
+    gate.set_value();
+    while (background_done.load(std::memory_order_acquire) != 4) {
+        std::this_thread::yield();
+    }
+}
@@ -0,0 +1,75 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/fiber/stack_pool.hpp>
+
+#include <category/core/fiber/config.hpp>
+
+#include <boost/context/protected_fixedsize_stack.hpp>
+#include <boost/context/stack_context.hpp>
+
+#include <cstddef>
+#include <mutex>
+
+MONAD_FIBER_NAMESPACE_BEGIN
+
+StackPool::StackPool(
+    std::size_t const stack_size, std::size_t const max_retained)
+    : stack_size_{stack_size}
+    , max_retained_{max_retained}
+{
+    free_.reserve(max_retained_);
+}
+
+StackPool::~StackPool()
+{
+    boost::context::protected_fixedsize_stack salloc{stack_size_};
+    for (auto &sctx : free_) {
+        salloc.deallocate(sctx);
+    }
+}
+
+boost::context::stack_context StackPool::allocate()
+{
+    {
+        std::lock_guard const lock{mutex_};
+        if (!free_.empty()) {
+            auto const sctx = free_.back();
+            free_.pop_back();
+            return sctx;
+        }
+    }
+    return boost::context::protected_fixedsize_stack{stack_size_}.allocate();
+}
+
+void StackPool::deallocate(boost::context::stack_context &sctx) noexcept
+{
+    {
+        std::lock_guard const lock{mutex_};
+        if (free_.size() < max_retained_) {
+            free_.push_back(sctx);
+            return;
+        }
+    }
+    boost::context::protected_fixedsize_stack{stack_size_}.deallocate(sctx);
+}
+
+std::size_t StackPool::num_retained()
+{
+    std::lock_guard const lock{mutex_};
+    return free_.size();
+}
+
+MONAD_FIBER_NAMESPACE_END
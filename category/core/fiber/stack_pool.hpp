@@ -0,0 +1,77 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <category/core/fiber/config.hpp>
+
+#include <boost/context/stack_context.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+MONAD_FIBER_NAMESPACE_BEGIN
+
+/// StackPool keeps the guard-paged stacks of finished fibers for reuse, so
+/// that short-lived fibers do not pay an mmap and mprotect each. At most
+/// `max_retained` stacks are kept, further stacks are unmapped when their
+/// fiber finishes. It is thread safe, as a fiber may finish on another
+/// thread than the one it was created on.
+class StackPool final
+{
+    std::size_t const stack_size_;
+    std::size_t const max_retained_;
+    std::mutex mutex_{};
+    std::vector<boost::context::stack_context> free_{};
+
+public:
+    StackPool(std::size_t stack_size, std::size_t max_retained);
+
+    StackPool(StackPool const &) = delete;
+    StackPool &operator=(StackPool const &) = delete;
+
+    ~StackPool();
+
+    boost::context::stack_context allocate();
+    void deallocate(boost::context::stack_context &) noexcept;
+
+    std::size_t num_retained();
+};
+
+/// Stack allocator handing out the stacks of a StackPool, for constructing
+/// fibers with `std::allocator_arg`
+class PooledStack final
+{
+    StackPool *pool_;
+
+public:
+    explicit PooledStack(StackPool &pool)
+        : pool_{&pool}
+    {
+    }
+
+    boost::context::stack_context allocate()
+    {
+        return pool_->allocate();
+    }
+
+    void deallocate(boost::context::stack_context &sctx) noexcept
+    {
+        pool_->deallocate(sctx);
+    }
+};
+
+MONAD_FIBER_NAMESPACE_END
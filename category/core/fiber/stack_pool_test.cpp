@@ -0,0 +1,74 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/fiber/stack_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <boost/context/stack_context.hpp>
+#include <boost/fiber/fiber.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace monad::fiber;
+
+TEST(StackPool, reuses_released_stack)
+{
+    StackPool pool{64 * 1024, 2};
+    auto sctx = pool.allocate();
+    void *const sp = sctx.sp;
+    EXPECT_GE(sctx.size, 64 * 1024);
+    pool.deallocate(sctx);
+    EXPECT_EQ(pool.num_retained(), 1);
+
+    auto reused = pool.allocate();
+    EXPECT_EQ(reused.sp, sp);
+    EXPECT_EQ(pool.num_retained(), 0);
+    pool.deallocate(reused);
+}
+
+TEST(StackPool, retains_at_most_max_retained)
+{
+    StackPool pool{64 * 1024, 2};
+    std::vector<boost::context::stack_context> stacks;
+    for (int i = 0; i < 5; ++i) {
+        stacks.push_back(pool.allocate());
+    }
+    for (auto &sctx : stacks) {
+        pool.deallocate(sctx);
+    }
+    EXPECT_EQ(pool.num_retained(), 2);
+}
+
+TEST(StackPool, runs_fibers_on_pooled_stacks)
+{
+    StackPool pool{64 * 1024, 4};
+    for (int round = 0; round < 3; ++round) {
+        int sum = 0;
+        std::vector<boost::fibers::fiber> fibers;
+        for (int i = 1; i <= 4; ++i) {
+            fibers.emplace_back(
+                std::allocator_arg, PooledStack{pool}, [&sum, i] {
+                    sum += i;
+                });
+        }
+        for (auto &fiber : fibers) {
+            fiber.join();
+        }
+        EXPECT_EQ(sum, 10);
+        EXPECT_EQ(pool.num_retained(), 4);
+    }
+}
@@ -0,0 +1,234 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/mem/slab_allocator.hpp>
+
+#include <category/core/assert.h>
+#include <category/core/config.hpp>
+#include <category/core/likely.h>
+
+#include <sys/mman.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+MONAD_NAMESPACE_BEGIN
+
+SlabPool::SlabPool(size_t const max_free_chunks)
+    : max_free_chunks_{max_free_chunks}
+{
+}
+
+SlabPool::~SlabPool()
+{
+    for (Chunk *const chunk : chunks_) {
+        (void)munmap(chunk, CHUNK_SIZE);
+    }
+}
+
+SlabPool::Chunk *SlabPool::chunk_of(void *const p) noexcept
+{
+    return reinterpret_cast<Chunk *>(
+        reinterpret_cast<uintptr_t>(p) & ~(CHUNK_SIZE - 1));
+}
+
+void SlabPool::map_chunk()
+{
+    Chunk *chunk;
+    if (!empty_.empty()) {
+        chunk = empty_.back();
+        empty_.pop_back();
+    }
+    else {
+        // Over-map and trim to a chunk aligned range, so that the kernel
+        // can back it with a single transparent huge page if it honours the
+        // advice. Mapped directly rather than through operator new so that
+        // releasing a chunk returns it to the OS.
+        void *const p = mmap(
+            nullptr,
+            2 * CHUNK_SIZE,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS,
+            -1,
+            0);
+        if (MONAD_UNLIKELY(p == MAP_FAILED)) {
+            throw std::bad_alloc{};
+        }
+        auto *const begin = static_cast<unsigned char *>(p);
+        auto *const aligned = reinterpret_cast<unsigned char *>(
+            (reinterpret_cast<uintptr_t>(begin) + CHUNK_SIZE - 1) &
+            ~(CHUNK_SIZE - 1));
+        if (aligned != begin) {
+            (void)munmap(begin, static_cast<size_t>(aligned - begin));
+        }
+        (void)munmap(
+            aligned + CHUNK_SIZE,
+            static_cast<size_t>(begin + CHUNK_SIZE - aligned));
+        (void)madvise(aligned, CHUNK_SIZE, MADV_HUGEPAGE);
+        chunk = new (aligned) Chunk{};
+        chunk->index = chunks_.size();
+        chunks_.push_back(chunk);
+        chunk_bytes_.fetch_add(CHUNK_SIZE, std::memory_order_relaxed);
+    }
+    chunk->free = {};
+    chunk->used = 0;
+
+    // The unused tail of the previous chunk, at most MAX_BLOCK_SIZE, is
+    // abandoned
+    Chunk *const previous = current_;
+    current_ = chunk;
+    cursor_ = reinterpret_cast<unsigned char *>(chunk) + CHUNK_HEADER_SIZE;
+    end_ = reinterpret_cast<unsigned char *>(chunk) + CHUNK_SIZE;
+    if (previous != nullptr && previous->used == 0) {
+        release_chunk(previous);
+    }
+}
+
+void SlabPool::release_chunk(Chunk *const chunk) noexcept
+{
+    MONAD_DEBUG_ASSERT(chunk->used == 0 && chunk != current_);
+    for (unsigned c = 0; c < NUM_CLASSES; ++c) {
+        if (chunk->free[c] != nullptr) {
+            unlink(c, chunk);
+        }
+    }
+    if (empty_.size() < max_free_chunks_) {
+        empty_.push_back(chunk);
+        return;
+    }
+    unmap_chunk(chunk);
+}
+
+void SlabPool::unmap_chunk(Chunk *const chunk) noexcept
+{
+    Chunk *const last = chunks_.back();
+    last->index = chunk->index;
+    chunks_[chunk->index] = last;
+    chunks_.pop_back();
+    (void)munmap(chunk, CHUNK_SIZE);
+    chunk_bytes_.fetch_sub(CHUNK_SIZE, std::memory_order_relaxed);
+}
+
+void SlabPool::link(unsigned const c, Chunk *const chunk) noexcept
+{
+    chunk->prev[c] = nullptr;
+    chunk->next[c] = partial_[c];
+    if (partial_[c] != nullptr) {
+        partial_[c]->prev[c] = chunk;
+    }
+    partial_[c] = chunk;
+}
+
+void SlabPool::unlink(unsigned const c, Chunk *const chunk) noexcept
+{
+    if (chunk->prev[c] != nullptr) {
+        chunk->prev[c]->next[c] = chunk->next[c];
+    }
+    else {
+        partial_[c] = chunk->next[c];
+    }
+    if (chunk->next[c] != nullptr) {
+        chunk->next[c]->prev[c] = chunk->prev[c];
+    }
+}
+
+unsigned SlabPool::take(unsigned const c, void **const out, unsigned const n)
+{
+    MONAD_ASSERT(n > 0);
+    size_t const size = class_size(c);
+    unsigned taken = 0;
+    std::lock_guard const lock{mutex_};
+    while (taken < n && partial_[c] != nullptr) {
+        Chunk *const chunk = partial_[c];
+        for (; taken < n && chunk->free[c] != nullptr; ++taken) {
+            out[taken] = chunk->free[c];
+            chunk->free[c] = chunk->free[c]->next;
+            ++chunk->used;
+        }
+        if (chunk->free[c] == nullptr) {
+            unlink(c, chunk);
+        }
+    }
+    if (taken == 0) {
+        if (static_cast<size_t>(end_ - cursor_) < size) {
+            map_chunk();
+        }
+        for (; taken < n && static_cast<size_t>(end_ - cursor_) >= size;
+             ++taken) {
+            out[taken] = cursor_;
+            cursor_ += size;
+        }
+        current_->used += taken;
+    }
+    in_use_bytes_.fetch_add(taken * size, std::memory_order_relaxed);
+    return taken;
+}
+
+void SlabPool::give(
+    unsigned const c, void *const *const blocks, unsigned const n) noexcept
+{
+    if (n == 0) {
+        return;
+    }
+    std::lock_guard const lock{mutex_};
+    for (unsigned i = 0; i < n; ++i) {
+        auto *const block = static_cast<FreeBlock *>(blocks[i]);
+        Chunk *const chunk = chunk_of(block);
+        if (chunk->free[c] == nullptr) {
+            link(c, chunk);
+        }
+        block->next = chunk->free[c];
+        chunk->free[c] = block;
+        if (--chunk->used == 0 && chunk != current_) {
+            release_chunk(chunk);
+        }
+    }
+    in_use_bytes_.fetch_sub(n * class_size(c), std::memory_order_relaxed);
+}
+
+void SlabPool::set_max_free_chunks(size_t const n) noexcept
+{
+    std::lock_guard const lock{mutex_};
+    max_free_chunks_ = n;
+    while (empty_.size() > n) {
+        unmap_chunk(empty_.back());
+        empty_.pop_back();
+    }
+}
+
+void *SlabPool::allocate_large(size_t const bytes)
+{
+    void *const p = ::operator new(bytes, std::align_val_t{ALIGNMENT});
+    large_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    return p;
+}
+
+void SlabPool::deallocate_large(void *const p, size_t const bytes) noexcept
+{
+    ::operator delete(p, std::align_val_t{ALIGNMENT});
+    large_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+SlabAllocatorStats SlabPool::stats() const noexcept
+{
+    return {
+        .chunk_bytes = chunk_bytes_.load(std::memory_order_relaxed),
+        .in_use_bytes = in_use_bytes_.load(std::memory_order_relaxed),
+        .large_bytes = large_bytes_.load(std::memory_order_relaxed)};
+}
+
+MONAD_NAMESPACE_END
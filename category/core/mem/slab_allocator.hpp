@@ -0,0 +1,336 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <category/core/assert.h>
+#include <category/core/config.hpp>
+#include <category/core/likely.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+MONAD_NAMESPACE_BEGIN
+
+struct SlabAllocatorStats
+{
+    // Chunks currently mapped, including empty ones kept for reuse
+    uint64_t chunk_bytes;
+    // Size-class blocks held by callers or cached in thread magazines
+    uint64_t in_use_bytes;
+    // Allocations above the largest size class, served by operator new
+    uint64_t large_bytes;
+};
+
+//! Size-class slab pool carved from 2 MiB chunks of regular memory advised
+//! for transparent huge pages. Reserved hugetlb pages are left to `HugeMem`
+//! users such as the io buffers, which cannot start without them. Freed
+//! blocks go on per-class free lists kept by their chunk and are reused. A
+//! chunk none of whose blocks is in use is unmapped, except that up to
+//! `max_free_chunks` empty chunks stay mapped for reuse, so that a pool
+//! hovering around a chunk boundary does not map and unmap on every batch.
+//! Blocks cached in thread magazines count as in use and keep their chunk
+//! mapped. Thread safe; `SlabAllocator` puts per-thread magazines in front
+//! of it so that most allocations do not take the lock.
+class SlabPool
+{
+public:
+    static constexpr size_t CHUNK_SIZE = size_t{1} << 21;
+    static constexpr size_t ALIGNMENT = 16;
+    static constexpr size_t MAX_BLOCK_SIZE = 4096;
+    // 16 byte steps up to 512 bytes, then 128 byte steps
+    static constexpr unsigned NUM_CLASSES = 32 + (MAX_BLOCK_SIZE - 512) / 128;
+    static constexpr size_t DEFAULT_MAX_FREE_CHUNKS = 4;
+
+    static constexpr unsigned size_class(size_t const bytes) noexcept
+    {
+        MONAD_DEBUG_ASSERT(bytes > 0 && bytes <= MAX_BLOCK_SIZE);
+        if (bytes <= 512) {
+            return static_cast<unsigned>((bytes + 15) / 16 - 1);
+        }
+        return static_cast<unsigned>(31 + (bytes - 512 + 127) / 128);
+    }
+
+    static constexpr size_t class_size(unsigned const c) noexcept
+    {
+        MONAD_DEBUG_ASSERT(c < NUM_CLASSES);
+        return c < 32 ? 16 * (size_t{c} + 1) : 512 + 128 * (size_t{c} - 31);
+    }
+
+    explicit SlabPool(size_t max_free_chunks = DEFAULT_MAX_FREE_CHUNKS);
+    ~SlabPool();
+
+    SlabPool(SlabPool const &) = delete;
+    SlabPool &operator=(SlabPool const &) = delete;
+
+    //! Store between 1 and `n` free blocks of class `c` into `out` and
+    //! return how many, mapping a new chunk if there are none
+    unsigned take(unsigned c, void **out, unsigned n);
+
+    //! Return `n` blocks of class `c` to the free lists of their chunks,
+    //! releasing the chunks left with no block in use
+    void give(unsigned c, void *const *blocks, unsigned n) noexcept;
+
+    //! Change how many empty chunks stay mapped, unmapping any excess
+    void set_max_free_chunks(size_t) noexcept;
+
+    void *allocate_large(size_t bytes);
+    void deallocate_large(void *p, size_t bytes) noexcept;
+
+    SlabAllocatorStats stats() const noexcept;
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+
+    // Header at the start of every chunk. Chunks are CHUNK_SIZE aligned, so
+    // a block finds its chunk by masking its address.
+    struct Chunk
+    {
+        std::array<FreeBlock *, NUM_CLASSES> free;
+        // Links in the per-class lists of chunks with free blocks
+        std::array<Chunk *, NUM_CLASSES> prev;
+        std::array<Chunk *, NUM_CLASSES> next;
+        // Blocks handed out by take() and not given back yet
+        size_t used;
+        // Position in chunks_
+        size_t index;
+    };
+
+    static constexpr size_t CHUNK_HEADER_SIZE =
+        (sizeof(Chunk) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+    static Chunk *chunk_of(void *) noexcept;
+
+    void map_chunk();
+    void release_chunk(Chunk *) noexcept;
+    void unmap_chunk(Chunk *) noexcept;
+    void link(unsigned c, Chunk *) noexcept;
+    void unlink(unsigned c, Chunk *) noexcept;
+
+    std::mutex mutex_;
+    // Chunks with free blocks of each class
+    std::array<Chunk *, NUM_CLASSES> partial_{};
+    // Chunk being carved; never released while it is
+    Chunk *current_{nullptr};
+    unsigned char *cursor_{nullptr};
+    unsigned char *end_{nullptr};
+    std::vector<Chunk *> chunks_;
+    // Empty chunks kept mapped for reuse
+    std::vector<Chunk *> empty_;
+    size_t max_free_chunks_;
+
+    std::atomic<uint64_t> chunk_bytes_{0};
+    std::atomic<uint64_t> in_use_bytes_{0};
+    std::atomic<uint64_t> large_bytes_{0};
+};
+
+//! Process-wide slab allocator, one pool per `Tag`. Each thread caches up
+//! to `MAGAZINE_SIZE` free blocks per size class and exchanges them with
+//! the pool in half-magazine batches; a thread's cached blocks go back to
+//! the pool when it exits. Blocks may be freed on any thread.
+template <class Tag>
+class SlabAllocator
+{
+public:
+    static constexpr unsigned MAGAZINE_SIZE = 64;
+
+    static void *allocate(size_t const bytes)
+    {
+        if (MONAD_UNLIKELY(bytes > SlabPool::MAX_BLOCK_SIZE)) {
+            return pool().allocate_large(bytes);
+        }
+        auto const c = SlabPool::size_class(bytes);
+        auto &mag = magazines_[c];
+        if (MONAD_UNLIKELY(mag.count == 0)) {
+            return refill(c);
+        }
+        return mag.blocks[--mag.count];
+    }
+
+    static void deallocate(void *const p, size_t const bytes) noexcept
+    {
+        if (MONAD_UNLIKELY(bytes > SlabPool::MAX_BLOCK_SIZE)) {
+            return pool().deallocate_large(p, bytes);
+        }
+        auto const c = SlabPool::size_class(bytes);
+        auto &mag = magazines_[c];
+        if (MONAD_UNLIKELY(
+                mag.count == MAGAZINE_SIZE || state_ != State::attached)) {
+            return spill(c, p);
+        }
+        mag.blocks[mag.count++] = p;
+    }
+
+    static SlabAllocatorStats stats() noexcept
+    {
+        return pool().stats();
+    }
+
+    static void set_max_free_chunks(size_t const n) noexcept
+    {
+        pool().set_max_free_chunks(n);
+    }
+
+private:
+    struct Magazine
+    {
+        unsigned count;
+        std::array<void *, MAGAZINE_SIZE> blocks;
+    };
+
+    enum class State : uint8_t
+    {
+        unattached,
+        attached,
+        detached
+    };
+
+    // Flushes the thread's magazines when it exits
+    struct ThreadGuard
+    {
+        ~ThreadGuard()
+        {
+            for (unsigned c = 0; c < SlabPool::NUM_CLASSES; ++c) {
+                auto &mag = magazines_[c];
+                pool().give(c, mag.blocks.data(), mag.count);
+                mag.count = 0;
+            }
+            state_ = State::detached;
+        }
+    };
+
+    // Never destroyed, so blocks freed during static destruction are safe
+    static SlabPool &pool()
+    {
+        static SlabPool &pool = *new SlabPool;
+        return pool;
+    }
+
+    static void attach()
+    {
+        thread_local ThreadGuard guard;
+        state_ = State::attached;
+    }
+
+    [[gnu::noinline]] static void *refill(unsigned const c)
+    {
+        if (state_ == State::unattached) {
+            attach();
+        }
+        if (MONAD_UNLIKELY(state_ == State::detached)) {
+            void *p;
+            pool().take(c, &p, 1);
+            return p;
+        }
+        auto &mag = magazines_[c];
+        mag.count = pool().take(c, mag.blocks.data(), MAGAZINE_SIZE / 2);
+        return mag.blocks[--mag.count];
+    }
+
+    [[gnu::noinline]] static void spill(unsigned const c, void *p) noexcept
+    {
+        if (state_ == State::unattached) {
+            attach();
+        }
+        if (MONAD_UNLIKELY(state_ == State::detached)) {
+            return pool().give(c, &p, 1);
+        }
+        auto &mag = magazines_[c];
+        if (mag.count == MAGAZINE_SIZE) {
+            mag.count -= MAGAZINE_SIZE / 2;
+            pool().give(c, mag.blocks.data() + mag.count, MAGAZINE_SIZE / 2);
+        }
+        mag.blocks[mag.count++] = p;
+    }
+
+    // Trivially destructible, so they remain usable after the guard ran
+    static thread_local inline std::array<Magazine, SlabPool::NUM_CLASSES>
+        magazines_{};
+    static thread_local inline State state_{State::unattached};
+};
+
+namespace allocators
+{
+    //! \brief Like `variable_size_allocator`, but allocates from the
+    //! `SlabAllocator<Tag>` pool
+    template <class T, class Tag>
+    struct slab_variable_size_allocator
+    {
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        explicit slab_variable_size_allocator(
+            size_t const storage_bytes) noexcept
+            : extra_bytes_(storage_bytes - sizeof(T))
+        {
+            MONAD_ASSERT(storage_bytes >= sizeof(T));
+        }
+
+        template <typename U>
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        slab_variable_size_allocator(
+            slab_variable_size_allocator<U, Tag> const &other) noexcept
+            : extra_bytes_(other.extra_bytes_)
+        {
+        }
+
+        [[nodiscard]] T *allocate(size_type const n)
+        {
+            static_assert(alignof(T) <= SlabPool::ALIGNMENT);
+            MONAD_ASSERT(n == 1);
+            return static_cast<T *>(
+                SlabAllocator<Tag>::allocate(sizeof(T) + extra_bytes_));
+        }
+
+        void deallocate(T *const p, size_type) noexcept
+        {
+            SlabAllocator<Tag>::deallocate(p, sizeof(T) + extra_bytes_);
+        }
+
+        template <typename U>
+        struct rebind
+        {
+            using other = slab_variable_size_allocator<U, Tag>;
+        };
+
+        bool
+        operator==(slab_variable_size_allocator const &other) const noexcept
+        {
+            return extra_bytes_ == other.extra_bytes_;
+        }
+
+        bool
+        operator!=(slab_variable_size_allocator const &other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+        template <typename U, typename V>
+        friend struct slab_variable_size_allocator;
+
+    private:
+        size_t extra_bytes_;
+    };
+}
+
+MONAD_NAMESPACE_END
@@ -0,0 +1,172 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/mem/slab_allocator.hpp>
+
+#include <category/core/config.hpp>
+#include <category/core/test_util/gtest_signal_stacktrace_printer.hpp> // NOLINT
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace MONAD_NAMESPACE;
+
+namespace
+{
+    struct TestTag;
+    using Alloc = SlabAllocator<TestTag>;
+}
+
+TEST(SlabPool, size_classes)
+{
+    for (size_t bytes = 1; bytes <= SlabPool::MAX_BLOCK_SIZE; ++bytes) {
+        auto const c = SlabPool::size_class(bytes);
+        ASSERT_LT(c, SlabPool::NUM_CLASSES);
+        ASSERT_GE(SlabPool::class_size(c), bytes);
+        ASSERT_EQ(SlabPool::class_size(c) % SlabPool::ALIGNMENT, 0);
+        if (c > 0) {
+            ASSERT_LT(SlabPool::class_size(c - 1), bytes);
+        }
+    }
+    EXPECT_EQ(
+        SlabPool::class_size(SlabPool::NUM_CLASSES - 1),
+        SlabPool::MAX_BLOCK_SIZE);
+}
+
+TEST(SlabPool, releases_free_chunks)
+{
+    constexpr unsigned c = SlabPool::NUM_CLASSES - 1;
+    SlabPool pool{1};
+
+    // Carve blocks until a second chunk is mapped
+    std::vector<void *> first;
+    void *block;
+    while (pool.take(c, &block, 1) == 1 &&
+           pool.stats().chunk_bytes == SlabPool::CHUNK_SIZE) {
+        first.push_back(block);
+    }
+    void *const second = block;
+    ASSERT_EQ(pool.stats().chunk_bytes, 2 * SlabPool::CHUNK_SIZE);
+
+    // The emptied first chunk is kept mapped for reuse
+    pool.give(c, first.data(), static_cast<unsigned>(first.size()));
+    EXPECT_EQ(pool.stats().chunk_bytes, 2 * SlabPool::CHUNK_SIZE);
+
+    // and unmapped once no empty chunk may be kept
+    pool.set_max_free_chunks(0);
+    EXPECT_EQ(pool.stats().chunk_bytes, SlabPool::CHUNK_SIZE);
+
+    // The chunk being carved stays mapped while empty
+    pool.give(c, &second, 1);
+    EXPECT_EQ(pool.stats().chunk_bytes, SlabPool::CHUNK_SIZE);
+    EXPECT_EQ(pool.stats().in_use_bytes, 0);
+
+    // and its freed block is handed out again
+    ASSERT_EQ(pool.take(c, &block, 1), 1);
+    EXPECT_EQ(block, second);
+    pool.give(c, &block, 1);
+}
+
+TEST(SlabAllocator, reuses_blocks)
+{
+    auto const before = Alloc::stats();
+    std::vector<void *> blocks;
+    for (unsigned i = 0; i < 1000; ++i) {
+        void *const p = Alloc::allocate(100);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(p) % SlabPool::ALIGNMENT, 0);
+        std::memset(p, static_cast<int>(i), 100);
+        blocks.push_back(p);
+    }
+    EXPECT_EQ(std::set<void *>(blocks.begin(), blocks.end()).size(), 1000);
+    auto const after_alloc = Alloc::stats();
+    EXPECT_GE(after_alloc.in_use_bytes - before.in_use_bytes, 1000 * 112);
+    EXPECT_GT(after_alloc.chunk_bytes, 0);
+
+    for (void *const p : blocks) {
+        Alloc::deallocate(p, 100);
+    }
+    // freed blocks are reused rather than carved from new chunks
+    auto const mapped = after_alloc.chunk_bytes;
+    for (unsigned i = 0; i < 1000; ++i) {
+        blocks[i] = Alloc::allocate(100);
+    }
+    auto const after_reuse = Alloc::stats();
+    EXPECT_EQ(after_reuse.chunk_bytes, mapped);
+    for (void *const p : blocks) {
+        Alloc::deallocate(p, 100);
+    }
+}
+
+TEST(SlabAllocator, frees_across_threads)
+{
+    std::vector<void *> blocks(5000);
+    std::thread([&] {
+        for (auto &p : blocks) {
+            p = Alloc::allocate(48);
+        }
+    }).join();
+    // the allocating thread returned its magazines when it exited
+    std::thread([&] {
+        for (void *const p : blocks) {
+            Alloc::deallocate(p, 48);
+        }
+    }).join();
+    auto const before = Alloc::stats();
+    void *const p = Alloc::allocate(48);
+    Alloc::deallocate(p, 48);
+    auto const after = Alloc::stats();
+    EXPECT_EQ(after.chunk_bytes, before.chunk_bytes);
+}
+
+TEST(SlabAllocator, large_allocations)
+{
+    auto const before = Alloc::stats();
+    void *const p = Alloc::allocate(SlabPool::MAX_BLOCK_SIZE + 1);
+    std::memset(p, 0xff, SlabPool::MAX_BLOCK_SIZE + 1);
+    EXPECT_EQ(
+        Alloc::stats().large_bytes - before.large_bytes,
+        SlabPool::MAX_BLOCK_SIZE + 1);
+    Alloc::deallocate(p, SlabPool::MAX_BLOCK_SIZE + 1);
+    EXPECT_EQ(Alloc::stats().large_bytes, before.large_bytes);
+}
+
+TEST(SlabAllocator, allocate_shared)
+{
+    struct Trailing
+    {
+        uint64_t size;
+
+        explicit Trailing(uint64_t const s)
+            : size{s}
+        {
+        }
+    };
+
+    size_t const bytes = sizeof(Trailing) + 200;
+    allocators::slab_variable_size_allocator<Trailing, TestTag> const alloc(
+        bytes);
+    auto const before = Alloc::stats();
+    {
+        auto const sp = std::allocate_shared<Trailing>(alloc, bytes);
+        std::memset(sp.get() + 1, 0xab, 200);
+        EXPECT_GT(Alloc::stats().in_use_bytes, before.in_use_bytes);
+    }
+}
@@ -0,0 +1,371 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/metrics/metrics.hpp>
+
+#include <category/core/assert.h>
+#include <category/core/config.hpp>
+#include <category/core/detail/start_lifetime_as_polyfill.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+MONAD_NAMESPACE_BEGIN
+
+namespace metrics
+{
+    namespace
+    {
+        constexpr char const *COUNTER_NAMES[NUM_COUNTERS] = {
+            "blocks_executed",
+            "transactions_executed",
+            "transaction_retries",
+            "triedb_account_cache_hit",
+            "triedb_account_cache_miss",
+            "triedb_storage_cache_hit",
+            "triedb_storage_cache_miss",
+            "io_reads_completed",
+            "io_reads_retried",
+            "io_reads_throttled",
+        };
+
+        constexpr char const *HISTOGRAM_NAMES[NUM_HISTOGRAMS] = {
+            "block_sender_recovery",
+            "block_tx_exec",
+            "block_commit",
+            "block_total",
+            "triedb_read_account",
+            "triedb_read_storage",
+            "io_read_highest",
+            "io_read_normal",
+            "io_read_traversal",
+            "io_read_compaction",
+            "io_read_idle",
+        };
+
+        void init_header(SegmentHeader &header) noexcept
+        {
+            std::memcpy(header.magic, SEGMENT_MAGIC, sizeof(header.magic));
+            header.num_counters = NUM_COUNTERS;
+            header.num_histograms = NUM_HISTOGRAMS;
+            header.num_buckets = NUM_BUCKETS;
+            header.max_threads = MAX_THREADS;
+            for (size_t i = 0; i < NUM_COUNTERS; ++i) {
+                std::strncpy(
+                    header.counter_names[i], COUNTER_NAMES[i], NAME_SIZE - 1);
+            }
+            for (size_t i = 0; i < NUM_HISTOGRAMS; ++i) {
+                std::strncpy(
+                    header.histogram_names[i],
+                    HISTOGRAM_NAMES[i],
+                    NAME_SIZE - 1);
+            }
+        }
+
+        Segment *map_segment(int const fd, int const prot)
+        {
+            void *const p = ::mmap(
+                nullptr, sizeof(Segment), prot, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED) {
+                throw std::system_error(errno, std::system_category());
+            }
+            return start_lifetime_as<Segment>(p);
+        }
+
+        // Lazily created when recording starts without set_segment()
+        Segment &private_segment() noexcept
+        {
+            static Segment *const segment = [] {
+                void *const p = ::mmap(
+                    nullptr,
+                    sizeof(Segment),
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                    -1,
+                    0);
+                MONAD_ASSERT(p != MAP_FAILED);
+                auto *const segment = start_lifetime_as<Segment>(p);
+                init_header(segment->header);
+                return segment;
+            }();
+            return *segment;
+        }
+
+        std::atomic<Segment *> current_segment{nullptr};
+    }
+
+    char const *counter_name(Counter const counter) noexcept
+    {
+        return COUNTER_NAMES[static_cast<size_t>(counter)];
+    }
+
+    char const *histogram_name(Histogram const histogram) noexcept
+    {
+        return HISTOGRAM_NAMES[static_cast<size_t>(histogram)];
+    }
+
+    namespace detail
+    {
+        thread_local constinit ThreadCells *thread_cells = nullptr;
+
+        namespace
+        {
+            // Cells of exited threads, handed out before claiming new ones.
+            // The cells keep their totals, so a reused block keeps counting
+            // up from where the exited thread left it.
+            std::mutex free_cells_mutex;
+            std::array<uint32_t, MAX_THREADS> free_cells;
+            uint32_t free_cells_count = 0;
+
+            thread_local constinit bool thread_cells_released = false;
+
+            struct ThreadCellsGuard
+            {
+                uint32_t index{MAX_THREADS};
+
+                ~ThreadCellsGuard()
+                {
+                    // the last block may be shared by several threads
+                    if (index < MAX_THREADS - 1) {
+                        std::lock_guard const lock{free_cells_mutex};
+                        free_cells[free_cells_count++] = index;
+                    }
+                    thread_cells = nullptr;
+                    thread_cells_released = true;
+                }
+            };
+
+            thread_local constinit ThreadCellsGuard thread_cells_guard;
+        }
+
+        ThreadCells *claim_thread_cells() noexcept
+        {
+            Segment &s = segment();
+            if (MONAD_UNLIKELY(thread_cells_released)) {
+                // recording from a thread local destructor which ran after
+                // the guard; the guard cannot be rearmed
+                thread_cells = &s.threads[MAX_THREADS - 1];
+                return thread_cells;
+            }
+            uint32_t index;
+            {
+                std::lock_guard const lock{free_cells_mutex};
+                if (free_cells_count > 0) {
+                    index = free_cells[--free_cells_count];
+                }
+                else {
+                    index = std::min(
+                        s.header.threads_claimed.fetch_add(
+                            1, std::memory_order_relaxed),
+                        MAX_THREADS - 1);
+                }
+            }
+            thread_cells_guard.index = index;
+            thread_cells = &s.threads[index];
+            return thread_cells;
+        }
+    }
+
+    SharedSegment SharedSegment::create(std::filesystem::path const &path)
+    {
+        int const fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd == -1) {
+            throw std::system_error(errno, std::system_category());
+        }
+        if (::ftruncate(fd, sizeof(Segment)) == -1) {
+            int const err = errno;
+            ::close(fd);
+            throw std::system_error(err, std::system_category());
+        }
+        SharedSegment ret;
+        try {
+            ret.segment_ = map_segment(fd, PROT_READ | PROT_WRITE);
+        }
+        catch (...) {
+            ::close(fd);
+            throw;
+        }
+        ::close(fd);
+        init_header(ret.segment_->header);
+        return ret;
+    }
+
+    SharedSegment SharedSegment::open(std::filesystem::path const &path)
+    {
+        int const fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            throw std::system_error(errno, std::system_category());
+        }
+        struct stat st;
+        if (::fstat(fd, &st) == -1) {
+            int const err = errno;
+            ::close(fd);
+            throw std::system_error(err, std::system_category());
+        }
+        if (static_cast<size_t>(st.st_size) != sizeof(Segment)) {
+            ::close(fd);
+            throw std::runtime_error(
+                path.string() + " is not a metrics segment of this version");
+        }
+        SharedSegment ret;
+        try {
+            ret.segment_ = map_segment(fd, PROT_READ);
+        }
+        catch (...) {
+            ::close(fd);
+            throw;
+        }
+        ::close(fd);
+        auto const &header = ret.segment_->header;
+        if (std::memcmp(header.magic, SEGMENT_MAGIC, sizeof(header.magic)) ||
+            header.num_counters != NUM_COUNTERS ||
+            header.num_histograms != NUM_HISTOGRAMS ||
+            header.num_buckets != NUM_BUCKETS ||
+            header.max_threads != MAX_THREADS) {
+            throw std::runtime_error(
+                path.string() + " is not a metrics segment of this version");
+        }
+        return ret;
+    }
+
+    SharedSegment::SharedSegment(SharedSegment &&other) noexcept
+        : segment_{std::exchange(other.segment_, nullptr)}
+    {
+    }
+
+    SharedSegment &SharedSegment::operator=(SharedSegment &&other) noexcept
+    {
+        if (this != &other) {
+            this->~SharedSegment();
+            segment_ = std::exchange(other.segment_, nullptr);
+        }
+        return *this;
+    }
+
+    SharedSegment::~SharedSegment()
+    {
+        if (segment_ != nullptr) {
+            ::munmap(segment_, sizeof(Segment));
+            segment_ = nullptr;
+        }
+    }
+
+    void set_segment(Segment &s)
+    {
+        Segment *const prev =
+            current_segment.exchange(&s, std::memory_order_acq_rel);
+        MONAD_ASSERT(
+            prev == nullptr ||
+            prev->header.threads_claimed.load(std::memory_order_relaxed) ==
+                0);
+    }
+
+    Segment &segment() noexcept
+    {
+        Segment *s = current_segment.load(std::memory_order_acquire);
+        if (s == nullptr) {
+            Segment *expected = nullptr;
+            s = &private_segment();
+            if (!current_segment.compare_exchange_strong(
+                    expected, s, std::memory_order_acq_rel)) {
+                s = expected;
+            }
+        }
+        return *s;
+    }
+
+    uint64_t HistogramSnapshot::percentile(double const p) const noexcept
+    {
+        if (count == 0) {
+            return 0;
+        }
+        double const clamped = std::clamp(p, 0.0, 100.0);
+        uint64_t const rank = std::max<uint64_t>(
+            1,
+            static_cast<uint64_t>(
+                std::ceil(clamped / 100.0 * static_cast<double>(count))));
+        uint64_t seen = 0;
+        for (unsigned i = 0; i < NUM_BUCKETS; ++i) {
+            seen += buckets[i];
+            if (seen >= rank) {
+                return std::min(bucket_upper_bound(i), max);
+            }
+        }
+        return max;
+    }
+
+    Snapshot Snapshot::since(Snapshot const &earlier) const noexcept
+    {
+        Snapshot ret{*this};
+        for (size_t i = 0; i < NUM_COUNTERS; ++i) {
+            ret.counters[i] -= earlier.counters[i];
+        }
+        for (size_t i = 0; i < NUM_HISTOGRAMS; ++i) {
+            auto &h = ret.histograms[i];
+            auto const &e = earlier.histograms[i];
+            h.count -= e.count;
+            h.sum -= e.sum;
+            for (unsigned b = 0; b < NUM_BUCKETS; ++b) {
+                h.buckets[b] -= e.buckets[b];
+            }
+        }
+        return ret;
+    }
+
+    Snapshot read_snapshot(Segment const &s) noexcept
+    {
+        Snapshot ret;
+        uint32_t const threads = std::min(
+            s.header.threads_claimed.load(std::memory_order_relaxed),
+            MAX_THREADS);
+        for (uint32_t t = 0; t < threads; ++t) {
+            auto const &cells = s.threads[t];
+            for (size_t i = 0; i < NUM_COUNTERS; ++i) {
+                ret.counters[i] +=
+                    cells.counters[i].load(std::memory_order_relaxed);
+            }
+            for (size_t i = 0; i < NUM_HISTOGRAMS; ++i) {
+                auto &h = ret.histograms[i];
+                auto const &c = cells.histograms[i];
+                h.count += c.count.load(std::memory_order_relaxed);
+                h.sum += c.sum.load(std::memory_order_relaxed);
+                h.max = std::max(h.max, c.max.load(std::memory_order_relaxed));
+                for (unsigned b = 0; b < NUM_BUCKETS; ++b) {
+                    h.buckets[b] +=
+                        c.buckets[b].load(std::memory_order_relaxed);
+                }
+            }
+        }
+        return ret;
+    }
+}
+
+MONAD_NAMESPACE_END
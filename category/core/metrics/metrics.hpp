@@ -0,0 +1,321 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <category/core/config.hpp>
+#include <category/core/likely.h>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+MONAD_NAMESPACE_BEGIN
+
+/// Process-wide registry of counters and latency histograms.
+///
+/// Every recording thread owns a cache-line aligned block of cells in a
+/// Segment and updates it with relaxed loads and stores, so recording never
+/// takes a lock or a locked instruction. The segment can be backed by a
+/// shared memory file (see SharedSegment), in which case an external process
+/// scrapes it with read_snapshot() while the node keeps running.
+namespace metrics
+{
+    enum class Counter : uint16_t
+    {
+        blocks_executed,
+        transactions_executed,
+        transaction_retries,
+        triedb_account_cache_hit,
+        triedb_account_cache_miss,
+        triedb_storage_cache_hit,
+        triedb_storage_cache_miss,
+        io_reads_completed,
+        io_reads_retried,
+        io_reads_throttled,
+        COUNT
+    };
+
+    /// All histograms are recorded in nanoseconds
+    enum class Histogram : uint16_t
+    {
+        block_sender_recovery,
+        block_tx_exec,
+        block_commit,
+        block_total,
+        triedb_read_account,
+        triedb_read_storage,
+        io_read_highest,
+        io_read_normal,
+        io_read_traversal,
+        io_read_compaction,
+        io_read_idle,
+        COUNT
+    };
+
+    inline constexpr size_t NUM_COUNTERS = static_cast<size_t>(Counter::COUNT);
+    inline constexpr size_t NUM_HISTOGRAMS =
+        static_cast<size_t>(Histogram::COUNT);
+
+    char const *counter_name(Counter) noexcept;
+    char const *histogram_name(Histogram) noexcept;
+
+    // HDR-style log-linear buckets: values below SUB_BUCKETS map one to one,
+    // every larger power of two is split into SUB_BUCKETS equal buckets, which
+    // bounds the relative error of a reported percentile to 1/SUB_BUCKETS.
+    inline constexpr unsigned SUB_BUCKET_BITS = 3;
+    inline constexpr unsigned SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+    inline constexpr unsigned NUM_BUCKETS =
+        (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    constexpr unsigned bucket_index(uint64_t const value) noexcept
+    {
+        if (value < SUB_BUCKETS) {
+            return static_cast<unsigned>(value);
+        }
+        unsigned const exp =
+            63u - static_cast<unsigned>(std::countl_zero(value));
+        unsigned const shift = exp - SUB_BUCKET_BITS;
+        return (shift + 1) * SUB_BUCKETS +
+               static_cast<unsigned>((value >> shift) & (SUB_BUCKETS - 1));
+    }
+
+    constexpr uint64_t bucket_lower_bound(unsigned const index) noexcept
+    {
+        if (index < SUB_BUCKETS) {
+            return index;
+        }
+        unsigned const shift = index / SUB_BUCKETS - 1;
+        return uint64_t{SUB_BUCKETS + index % SUB_BUCKETS} << shift;
+    }
+
+    constexpr uint64_t bucket_upper_bound(unsigned const index) noexcept
+    {
+        if (index < SUB_BUCKETS) {
+            return index;
+        }
+        unsigned const shift = index / SUB_BUCKETS - 1;
+        return bucket_lower_bound(index) + ((uint64_t{1} << shift) - 1);
+    }
+
+    static_assert(bucket_index(~uint64_t{0}) == NUM_BUCKETS - 1);
+
+    struct HistogramCells
+    {
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> sum;
+        std::atomic<uint64_t> max;
+        std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets;
+    };
+
+    struct alignas(64) ThreadCells
+    {
+        std::array<std::atomic<uint64_t>, NUM_COUNTERS> counters;
+        std::array<HistogramCells, NUM_HISTOGRAMS> histograms;
+    };
+
+    /// Threads beyond MAX_THREADS - 1 share the last block, where concurrent
+    /// updates may be lost
+    inline constexpr uint32_t MAX_THREADS = 128;
+    inline constexpr size_t NAME_SIZE = 48;
+    inline constexpr char SEGMENT_MAGIC[8] = {
+        'M', 'O', 'N', 'A', 'D', 'M', 'T', '1'};
+    inline constexpr char DEFAULT_SEGMENT_PATH[] = "/dev/shm/monad_metrics";
+
+    struct alignas(64) SegmentHeader
+    {
+        char magic[8];
+        uint32_t num_counters;
+        uint32_t num_histograms;
+        uint32_t num_buckets;
+        uint32_t max_threads;
+        std::atomic<uint32_t> threads_claimed;
+        char counter_names[NUM_COUNTERS][NAME_SIZE];
+        char histogram_names[NUM_HISTOGRAMS][NAME_SIZE];
+    };
+
+    struct Segment
+    {
+        SegmentHeader header;
+        std::array<ThreadCells, MAX_THREADS> threads;
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free);
+    static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+    namespace detail
+    {
+        extern thread_local constinit ThreadCells *thread_cells;
+
+        ThreadCells *claim_thread_cells() noexcept;
+
+        [[gnu::always_inline]] inline ThreadCells &cells() noexcept
+        {
+            ThreadCells *cells = thread_cells;
+            if (MONAD_UNLIKELY(cells == nullptr)) {
+                cells = claim_thread_cells();
+            }
+            return *cells;
+        }
+
+        // single writer per cell, so no read-modify-write is needed
+        [[gnu::always_inline]] inline void
+        bump(std::atomic<uint64_t> &cell, uint64_t const n) noexcept
+        {
+            cell.store(
+                cell.load(std::memory_order_relaxed) + n,
+                std::memory_order_relaxed);
+        }
+    }
+
+    [[gnu::always_inline]] inline void
+    add(Counter const counter, uint64_t const n = 1) noexcept
+    {
+        detail::bump(
+            detail::cells().counters[static_cast<size_t>(counter)], n);
+    }
+
+    [[gnu::always_inline]] inline void
+    record(Histogram const histogram, uint64_t const value) noexcept
+    {
+        auto &h = detail::cells().histograms[static_cast<size_t>(histogram)];
+        detail::bump(h.count, 1);
+        detail::bump(h.sum, value);
+        if (value > h.max.load(std::memory_order_relaxed)) {
+            h.max.store(value, std::memory_order_relaxed);
+        }
+        detail::bump(h.buckets[bucket_index(value)], 1);
+    }
+
+    template <class Rep, class Period>
+    void record(
+        Histogram const histogram,
+        std::chrono::duration<Rep, Period> const duration) noexcept
+    {
+        auto const ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+                .count();
+        record(histogram, ns > 0 ? static_cast<uint64_t>(ns) : 0);
+    }
+
+    /// Records the lifetime of the object into a histogram
+    class ScopedTimer
+    {
+        Histogram const histogram_;
+        std::chrono::steady_clock::time_point const begin_{
+            std::chrono::steady_clock::now()};
+
+    public:
+        explicit ScopedTimer(Histogram const histogram) noexcept
+            : histogram_{histogram}
+        {
+        }
+
+        ScopedTimer(ScopedTimer const &) = delete;
+        ScopedTimer &operator=(ScopedTimer const &) = delete;
+
+        ~ScopedTimer()
+        {
+            record(histogram_, std::chrono::steady_clock::now() - begin_);
+        }
+    };
+
+    /// A Segment mapped from a file, either created by the recording process
+    /// or opened read only by a scraper
+    class SharedSegment
+    {
+        Segment *segment_{nullptr};
+
+    public:
+        /// Creates (truncating) `path` and maps it writable
+        static SharedSegment create(std::filesystem::path const &);
+
+        /// Maps an existing segment read only; throws if it is not a segment
+        /// of this layout
+        static SharedSegment open(std::filesystem::path const &);
+
+        SharedSegment() = default;
+        SharedSegment(SharedSegment &&) noexcept;
+        SharedSegment &operator=(SharedSegment &&) noexcept;
+        ~SharedSegment();
+
+        Segment const &get() const noexcept
+        {
+            return *segment_;
+        }
+
+        Segment &get() noexcept
+        {
+            return *segment_;
+        }
+    };
+
+    /// Makes `segment` the destination of all subsequent recording. Must be
+    /// called before any thread records, typically right after startup; the
+    /// segment must outlive every recording thread.
+    void set_segment(Segment &);
+
+    /// The current destination, a process private segment if set_segment()
+    /// was never called
+    Segment &segment() noexcept;
+
+    struct HistogramSnapshot
+    {
+        uint64_t count{0};
+        uint64_t sum{0};
+        uint64_t max{0};
+        std::array<uint64_t, NUM_BUCKETS> buckets{};
+
+        /// Upper bound of the bucket holding the `p`th percentile, p in
+        /// [0, 100]; 0 if empty
+        uint64_t percentile(double p) const noexcept;
+
+        double mean() const noexcept
+        {
+            return count ? static_cast<double>(sum) / static_cast<double>(count)
+                         : 0;
+        }
+    };
+
+    struct Snapshot
+    {
+        std::array<uint64_t, NUM_COUNTERS> counters{};
+        std::array<HistogramSnapshot, NUM_HISTOGRAMS> histograms{};
+
+        uint64_t operator[](Counter const c) const noexcept
+        {
+            return counters[static_cast<size_t>(c)];
+        }
+
+        HistogramSnapshot const &operator[](Histogram const h) const noexcept
+        {
+            return histograms[static_cast<size_t>(h)];
+        }
+
+        /// What was recorded since `earlier`; the max of each histogram stays
+        /// the all time max
+        Snapshot since(Snapshot const &earlier) const noexcept;
+    };
+
+    /// Sums the cells of all threads without synchronizing with writers; a
+    /// concurrent snapshot may be off by the updates in flight
+    Snapshot read_snapshot(Segment const &) noexcept;
+}
+
+MONAD_NAMESPACE_END
@@ -0,0 +1,136 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/metrics/metrics.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+using namespace monad::metrics;
+
+TEST(metrics, bucket_bounds)
+{
+    for (uint64_t v :
+         {0ul, 1ul, 7ul, 8ul, 9ul, 15ul, 16ul, 17ul, 1000ul, 123456789ul,
+          ~uint64_t{0}}) {
+        unsigned const i = bucket_index(v);
+        ASSERT_LT(i, NUM_BUCKETS);
+        EXPECT_LE(bucket_lower_bound(i), v);
+        EXPECT_GE(bucket_upper_bound(i), v);
+    }
+    for (unsigned i = 1; i < NUM_BUCKETS; ++i) {
+        EXPECT_EQ(bucket_lower_bound(i), bucket_upper_bound(i - 1) + 1);
+        EXPECT_EQ(bucket_index(bucket_lower_bound(i)), i);
+    }
+}
+
+TEST(metrics, percentile)
+{
+    HistogramSnapshot h;
+    EXPECT_EQ(h.percentile(99), 0);
+    for (uint64_t v = 1; v <= 100; ++v) {
+        h.buckets[bucket_index(v)]++;
+        h.count++;
+        h.sum += v;
+        h.max = v;
+    }
+    EXPECT_DOUBLE_EQ(h.mean(), 50.5);
+    EXPECT_EQ(h.percentile(100), 100);
+    // within the 1/SUB_BUCKETS relative error of the exact value
+    EXPECT_GE(h.percentile(50), 50);
+    EXPECT_LE(h.percentile(50), 50 + 50 / SUB_BUCKETS);
+    EXPECT_GE(h.percentile(99), 99);
+}
+
+TEST(metrics, shared_segment)
+{
+    auto const path = std::filesystem::temp_directory_path() /
+                      ("monad_metrics_test_" + std::to_string(getpid()));
+    {
+        auto writer = SharedSegment::create(path);
+        set_segment(writer.get());
+
+        // every thread records into its own cells
+        auto const work = [] {
+            for (unsigned i = 0; i < 1000; ++i) {
+                add(Counter::io_reads_completed);
+                record(Histogram::io_read_normal, i);
+            }
+            add(Counter::transactions_executed, 5);
+            record(Histogram::block_total, std::chrono::microseconds{3});
+        };
+        std::thread t1{work};
+        std::thread t2{work};
+        t1.join();
+        t2.join();
+
+        auto const reader = SharedSegment::open(path);
+        EXPECT_STREQ(
+            reader.get().header.counter_names[static_cast<size_t>(
+                Counter::io_reads_retried)],
+            "io_reads_retried");
+        auto const snapshot = read_snapshot(reader.get());
+        EXPECT_EQ(snapshot[Counter::io_reads_completed], 2000);
+        EXPECT_EQ(snapshot[Counter::transactions_executed], 10);
+        EXPECT_EQ(snapshot[Histogram::io_read_normal].count, 2000);
+        EXPECT_EQ(snapshot[Histogram::io_read_normal].max, 999);
+        EXPECT_EQ(snapshot[Histogram::block_total].max, 3000);
+
+        {
+            ScopedTimer const timer{Histogram::block_commit};
+        }
+        auto const later = read_snapshot(reader.get());
+        auto const delta = later.since(snapshot);
+        EXPECT_EQ(delta[Counter::io_reads_completed], 0);
+        EXPECT_EQ(delta[Histogram::block_commit].count, 1);
+
+        // exited threads return their cells, keeping the recorded totals
+        std::thread{work}.join();
+        auto const claimed =
+            reader.get().header.threads_claimed.load(std::memory_order_relaxed);
+        for (uint32_t i = 1; i < 2 * MAX_THREADS; ++i) {
+            std::thread{work}.join();
+        }
+        EXPECT_EQ(
+            reader.get().header.threads_claimed.load(std::memory_order_relaxed),
+            claimed);
+        EXPECT_EQ(
+            read_snapshot(reader.get())[Counter::io_reads_completed],
+            2000 + 2 * MAX_THREADS * 1000);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(metrics, open_rejects_foreign_file)
+{
+    auto const path = std::filesystem::temp_directory_path() /
+                      ("monad_metrics_foreign_" + std::to_string(getpid()));
+    {
+        std::FILE *const f = std::fopen(path.c_str(), "w");
+        ASSERT_NE(f, nullptr);
+        std::fputs("not a segment", f);
+        std::fclose(f);
+    }
+    EXPECT_THROW(SharedSegment::open(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,711 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// End-to-end block replay benchmark.
+//
+// Generates a deterministic range of signed blocks and replays them through
+// execute_block and TrieDb::commit, the same way runloop_ethereum does. Each
+// block is split into phases, and every phase reports wall time together with
+// cycles, cache misses and branch misses from perf_event_open:
+//   - senders:   sender and authority recovery
+//   - execution: execute_block (merge retries are reported as a count, since
+//                they happen inside the execution phase)
+//   - commit:    commit builder and trie upserts, including node hashing
+//   - roots:     populating the header roots, bloom and ommers hash
+//
+// The counters are opened with inherit set before any worker thread starts,
+// so they include the fiber pool and the db threads. If perf events are not
+// available (e.g. perf_event_paranoid or a container), counters are reported
+// as null and only wall times are produced. Results are written as JSON.
+
+#include <category/core/address.hpp>
+#include <category/core/assert.h>
+#include <category/core/byte_string.hpp>
+#include <category/core/bytes.hpp>
+#include <category/core/fiber/priority_pool.hpp>
+#include <category/core/int.hpp>
+#include <category/core/keccak.hpp>
+#include <category/core/result.hpp>
+#include <category/execution/ethereum/block_hash_buffer.hpp>
+#include <category/execution/ethereum/chain/chain.hpp>
+#include <category/execution/ethereum/chain/ethereum_mainnet.hpp>
+#include <category/execution/ethereum/core/account.hpp>
+#include <category/execution/ethereum/core/block.hpp>
+#include <category/execution/ethereum/core/receipt.hpp>
+#include <category/execution/ethereum/core/rlp/block_rlp.hpp>
+#include <category/execution/ethereum/core/rlp/transaction_rlp.hpp>
+#include <category/execution/ethereum/core/transaction.hpp>
+#include <category/execution/ethereum/db/commit_builder.hpp>
+#include <category/execution/ethereum/db/trie_db.hpp>
+#include <category/execution/ethereum/db/util.hpp>
+#include <category/execution/ethereum/execute_block.hpp>
+#include <category/execution/ethereum/metrics/block_metrics.hpp>
+#include <category/execution/ethereum/state2/block_state.hpp>
+#include <category/execution/ethereum/state2/state_deltas.hpp>
+#include <category/execution/ethereum/trace/call_frame.hpp>
+#include <category/execution/ethereum/trace/call_tracer.hpp>
+#include <category/execution/ethereum/trace/state_tracer.hpp>
+#include <category/execution/ethereum/validate_block.hpp>
+#include <category/execution/monad/db/page_commit_builder.hpp>
+#include <category/mpt/db.hpp>
+#include <category/mpt/ondisk_db_config.hpp>
+#include <category/vm/code.hpp>
+#include <category/vm/evm/traits.hpp>
+#include <category/vm/vm.hpp>
+
+#include <CLI/CLI.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <secp256k1.h>
+#include <secp256k1_recovery.h>
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace monad;
+using namespace monad::literals;
+using namespace monad::test;
+
+namespace
+{
+    using traits = EvmTraits<MONAD_ETH_SHANGHAI>;
+
+    // PUSH0 SLOAD PUSH1 1 ADD PUSH0 SSTORE STOP: every call increments slot
+    // zero, so transactions sent to it conflict with each other
+    auto const COUNTER_CODE = 0x5f546001015f5500_bytes;
+    auto const COUNTER_CODE_HASH = to_bytes(keccak256(COUNTER_CODE));
+    constexpr auto COUNTER_CA =
+        0xc0c0c0c0c0c0c0c0c0c0c0c0c0c0c0c0c0c0c0c0_address;
+    constexpr auto BENEFICIARY =
+        0xbeefbeefbeefbeefbeefbeefbeefbeefbeefbeef_address;
+
+    constexpr uint64_t TX_GAS_LIMIT = 100'000;
+
+    ////////////////////////////////////////
+    // Hardware counters
+    ////////////////////////////////////////
+
+    constexpr std::array COUNTER_CONFIGS{
+        std::pair{PERF_COUNT_HW_CPU_CYCLES, "cycles"},
+        std::pair{PERF_COUNT_HW_CACHE_MISSES, "cache_misses"},
+        std::pair{PERF_COUNT_HW_BRANCH_MISSES, "branch_misses"}};
+    constexpr size_t NUM_COUNTERS = COUNTER_CONFIGS.size();
+
+    using CounterValues = std::array<uint64_t, NUM_COUNTERS>;
+
+    class PerfCounters
+    {
+        std::array<int, NUM_COUNTERS> fds_;
+
+    public:
+        PerfCounters()
+        {
+            fds_.fill(-1);
+            for (size_t i = 0; i < NUM_COUNTERS; ++i) {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof(attr));
+                attr.size = sizeof(attr);
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = COUNTER_CONFIGS[i].first;
+                attr.inherit = 1;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+                                   PERF_FORMAT_TOTAL_TIME_RUNNING;
+                fds_[i] = static_cast<int>(syscall(
+                    SYS_perf_event_open,
+                    &attr,
+                    0,
+                    -1,
+                    -1,
+                    PERF_FLAG_FD_CLOEXEC));
+                if (fds_[i] == -1) {
+                    close_all();
+                    return;
+                }
+            }
+        }
+
+        PerfCounters(PerfCounters const &) = delete;
+        PerfCounters &operator=(PerfCounters const &) = delete;
+
+        ~PerfCounters()
+        {
+            close_all();
+        }
+
+        bool available() const noexcept
+        {
+            return fds_[0] != -1;
+        }
+
+        CounterValues read() const
+        {
+            CounterValues values{};
+            if (!available()) {
+                return values;
+            }
+            for (size_t i = 0; i < NUM_COUNTERS; ++i) {
+                uint64_t buf[3]; // value, time enabled, time running
+                MONAD_ASSERT(
+                    ::read(fds_[i], buf, sizeof(buf)) ==
+                    static_cast<ssize_t>(sizeof(buf)));
+                // scale up if the counter was multiplexed
+                values[i] = buf[2] == 0 ? 0
+                                        : static_cast<uint64_t>(
+                                              static_cast<double>(buf[0]) *
+                                              static_cast<double>(buf[1]) /
+                                              static_cast<double>(buf[2]));
+            }
+            return values;
+        }
+
+    private:
+        void close_all() noexcept
+        {
+            for (int &fd : fds_) {
+                if (fd != -1) {
+                    ::close(fd);
+                    fd = -1;
+                }
+            }
+        }
+    };
+
+    struct Sample
+    {
+        std::chrono::steady_clock::time_point time;
+        CounterValues counters;
+    };
+
+    Sample take_sample(PerfCounters const &perf)
+    {
+        auto const counters = perf.read();
+        return {std::chrono::steady_clock::now(), counters};
+    }
+
+    struct PhaseStats
+    {
+        std::chrono::nanoseconds time{0};
+        CounterValues counters{};
+
+        static PhaseStats between(Sample const &begin, Sample const &end)
+        {
+            PhaseStats stats{.time = end.time - begin.time};
+            for (size_t i = 0; i < NUM_COUNTERS; ++i) {
+                // scaled values of multiplexed counters are not monotonic
+                stats.counters[i] = end.counters[i] > begin.counters[i]
+                                        ? end.counters[i] - begin.counters[i]
+                                        : 0;
+            }
+            return stats;
+        }
+
+        PhaseStats &operator+=(PhaseStats const &other)
+        {
+            time += other.time;
+            for (size_t i = 0; i < NUM_COUNTERS; ++i) {
+                counters[i] += other.counters[i];
+            }
+            return *this;
+        }
+
+        nlohmann::json to_json(bool const with_counters) const
+        {
+            nlohmann::json j;
+            j["time_us"] =
+                std::chrono::duration<double, std::micro>(time).count();
+            for (size_t i = 0; i < NUM_COUNTERS; ++i) {
+                j[COUNTER_CONFIGS[i].second] =
+                    with_counters ? nlohmann::json(counters[i])
+                                  : nlohmann::json(nullptr);
+            }
+            return j;
+        }
+    };
+
+    enum class Phase
+    {
+        senders,
+        execution,
+        commit,
+        roots,
+    };
+
+    constexpr std::array<char const *, 4> PHASE_NAMES{
+        "senders", "execution", "commit", "roots"};
+
+    using PhaseArray = std::array<PhaseStats, PHASE_NAMES.size()>;
+
+    struct BlockResult
+    {
+        uint64_t number;
+        size_t transactions;
+        uint64_t gas_used;
+        uint32_t retries;
+        PhaseArray phases;
+    };
+
+    nlohmann::json
+    phases_to_json(PhaseArray const &phases, bool const with_counters)
+    {
+        nlohmann::json j;
+        for (size_t i = 0; i < phases.size(); ++i) {
+            j[PHASE_NAMES[i]] = phases[i].to_json(with_counters);
+        }
+        return j;
+    }
+
+    ////////////////////////////////////////
+    // Workload generation
+    ////////////////////////////////////////
+
+    using secp256k1_context_ptr =
+        std::unique_ptr<secp256k1_context, void (*)(secp256k1_context *)>;
+
+    struct Sender
+    {
+        bytes32_t secret;
+        Address address;
+        uint64_t nonce;
+    };
+
+    Address
+    derive_address(secp256k1_context const *const ctx, bytes32_t const &secret)
+    {
+        secp256k1_pubkey pubkey;
+        MONAD_ASSERT(
+            1 == secp256k1_ec_pubkey_create(ctx, &pubkey, secret.bytes));
+        uint8_t serialized[65];
+        size_t size = sizeof(serialized);
+        MONAD_ASSERT(
+            1 == secp256k1_ec_pubkey_serialize(
+                     ctx,
+                     serialized,
+                     &size,
+                     &pubkey,
+                     SECP256K1_EC_UNCOMPRESSED));
+        // drop the 0x04 prefix, the address is the tail of the hash
+        auto const hash = keccak256(byte_string_view{serialized + 1, 64});
+        Address address;
+        std::memcpy(
+            address.bytes,
+            hash.bytes + sizeof(hash.bytes) - sizeof(address.bytes),
+            sizeof(address.bytes));
+        return address;
+    }
+
+    void sign(
+        secp256k1_context const *const ctx, Transaction &tx,
+        bytes32_t const &secret)
+    {
+        auto const hash = keccak256(rlp::encode_transaction_for_signing(tx));
+        secp256k1_ecdsa_recoverable_signature sig;
+        MONAD_ASSERT(
+            1 == secp256k1_ecdsa_sign_recoverable(
+                     ctx, &sig, hash.bytes, secret.bytes, nullptr, nullptr));
+        uint8_t compact[64];
+        int recid;
+        MONAD_ASSERT(
+            1 == secp256k1_ecdsa_recoverable_signature_serialize_compact(
+                     ctx, compact, &recid, &sig));
+        tx.sc.signature.r = load_be_unsafe<uint256_t>(compact);
+        tx.sc.signature.s = load_be_unsafe<uint256_t>(compact + 32);
+        tx.sc.signature.y_parity = static_cast<uint8_t>(recid);
+    }
+
+    std::vector<Sender>
+    make_senders(secp256k1_context const *const ctx, uint64_t const n)
+    {
+        std::vector<Sender> senders;
+        senders.reserve(n);
+        for (uint64_t i = 0; i < n; ++i) {
+            // small integers are valid secp256k1 secret keys
+            auto const secret = store_be_as<bytes32_t>(uint256_t{i + 1});
+            senders.push_back(
+                {.secret = secret,
+                 .address = derive_address(ctx, secret),
+                 .nonce = 0});
+        }
+        return senders;
+    }
+
+    struct WorkloadConfig
+    {
+        uint64_t blocks;
+        uint64_t txs_per_block;
+        unsigned conflict_percent;
+        uint64_t seed;
+    };
+
+    std::vector<Block> generate_blocks(
+        secp256k1_context const *const ctx, std::vector<Sender> &senders,
+        WorkloadConfig const &config)
+    {
+        std::mt19937_64 rng{config.seed};
+        std::uniform_int_distribution<unsigned> percent{0, 99};
+        std::vector<Block> blocks;
+        blocks.reserve(config.blocks);
+        uint64_t next_sender = 0;
+        for (uint64_t n = 1; n <= config.blocks; ++n) {
+            Block block{
+                .header =
+                    {.number = n,
+                     .gas_limit = config.txs_per_block * TX_GAS_LIMIT,
+                     .timestamp = n * 12,
+                     .beneficiary = BENEFICIARY,
+                     .base_fee_per_gas = 1},
+                .withdrawals = std::vector<Withdrawal>{}};
+            block.transactions.reserve(config.txs_per_block);
+            for (uint64_t i = 0; i < config.txs_per_block; ++i) {
+                Sender &sender = senders[next_sender++ % senders.size()];
+                bool const conflicting =
+                    percent(rng) < config.conflict_percent;
+                Address to;
+                if (conflicting) {
+                    to = COUNTER_CA;
+                }
+                else {
+                    auto const r = store_be_as<bytes32_t>(uint256_t{rng()});
+                    std::memcpy(
+                        to.bytes,
+                        r.bytes + sizeof(r.bytes) - sizeof(to.bytes),
+                        sizeof(to.bytes));
+                }
+                Transaction tx{
+                    .nonce = sender.nonce++,
+                    .max_fee_per_gas = 2,
+                    .gas_limit = TX_GAS_LIMIT,
+                    .value = conflicting ? 0 : 1,
+                    .to = to,
+                    .type = TransactionType::eip1559,
+                    .max_priority_fee_per_gas = 1};
+                tx.sc.chain_id = 1;
+                sign(ctx, tx, sender.secret);
+                block.transactions.push_back(std::move(tx));
+            }
+            blocks.push_back(std::move(block));
+        }
+        return blocks;
+    }
+
+    void commit_genesis(TrieDb &tdb, std::vector<Sender> const &senders)
+    {
+        StateDeltas deltas;
+        for (auto const &sender : senders) {
+            deltas.emplace(
+                sender.address,
+                StateDelta{
+                    .account =
+                        {std::nullopt,
+                         Account{
+                             .balance =
+                                 0xffffffffffffffffffffffffffffffff_u256}}});
+        }
+        deltas.emplace(
+            COUNTER_CA,
+            StateDelta{
+                .account =
+                    {std::nullopt,
+                     Account{.code_hash = COUNTER_CODE_HASH, .nonce = 1}}});
+        Code const code{
+            {COUNTER_CODE_HASH, vm::make_shared_intercode(COUNTER_CODE)}};
+        BlockHeader const header{.number = 0};
+        auto builder = make_commit_builder(header.number, tdb);
+        builder->add_state_deltas(deltas)
+            .add_code(code)
+            .add_receipts({})
+            .add_transactions({}, {})
+            .add_call_frames({})
+            .add_ommers({});
+        tdb.commit(
+            NULL_HASH_BLAKE3, *builder, header, deltas, [&](BlockHeader &h) {
+                h.state_root = tdb.state_root();
+                h.receipts_root = tdb.receipts_root();
+                h.transactions_root = tdb.transactions_root();
+                h.withdrawals_root = tdb.withdrawals_root();
+                h.logs_bloom = compute_bloom({});
+                h.ommers_hash = compute_ommers_hash({});
+            });
+        tdb.finalize(0, NULL_HASH_BLAKE3);
+        tdb.set_block_and_prefix(0);
+    }
+
+    ////////////////////////////////////////
+    // Replay
+    ////////////////////////////////////////
+
+    BlockResult replay_block(
+        PerfCounters const &perf, Chain const &chain, TrieDb &tdb,
+        vm::VM &vm, BlockHashBufferFinalized &block_hash_buffer,
+        fiber::PriorityPool &priority_pool, Block const &block)
+    {
+        BlockResult result{
+            .number = block.header.number,
+            .transactions = block.transactions.size(),
+            .gas_used = 0,
+            .retries = 0,
+            .phases = {}};
+        auto &phases = result.phases;
+        auto const phase = [&](Phase const p) -> PhaseStats & {
+            return phases[static_cast<size_t>(p)];
+        };
+
+        // Sender and authority recovery
+        auto const senders_begin = take_sample(perf);
+        auto const recovered_senders =
+            recover_senders(block.transactions, priority_pool);
+        auto const recovered_authorities =
+            recover_authorities(block.transactions, priority_pool);
+        phase(Phase::senders) =
+            PhaseStats::between(senders_begin, take_sample(perf));
+
+        std::vector<Address> senders(block.transactions.size());
+        for (size_t i = 0; i < recovered_senders.size(); ++i) {
+            MONAD_ASSERT(recovered_senders[i].has_value());
+            senders[i] = recovered_senders[i].value();
+        }
+
+        std::vector<std::vector<CallFrame>> call_frames{
+            block.transactions.size()};
+        std::vector<std::unique_ptr<CallTracerBase>> call_tracers;
+        std::vector<std::unique_ptr<trace::StateTracer>> state_tracers;
+        for (size_t i = 0; i < block.transactions.size(); ++i) {
+            call_tracers.emplace_back(std::make_unique<NoopCallTracer>());
+            state_tracers.emplace_back(
+                std::make_unique<trace::StateTracer>(std::monostate{}));
+        }
+        trace::StateTracer system_call_state_tracer{std::monostate{}};
+
+        // Execution
+        tdb.set_block_and_prefix(block.header.number - 1);
+        BlockMetrics block_metrics;
+        BlockState block_state{tdb, vm};
+        auto const chain_ctx = ChainContext<traits>::debug_empty();
+        auto const execution_begin = take_sample(perf);
+        auto const receipts = execute_block<traits>(
+            chain,
+            block,
+            senders,
+            recovered_authorities,
+            block_state,
+            block_hash_buffer,
+            priority_pool.fiber_group(),
+            block_metrics,
+            call_tracers,
+            state_tracers,
+            system_call_state_tracer,
+            chain_ctx,
+            nullptr);
+        phase(Phase::execution) =
+            PhaseStats::between(execution_begin, take_sample(perf));
+        MONAD_ASSERT(!receipts.has_error());
+        result.retries = block_metrics.num_retries;
+        result.gas_used =
+            receipts.value().empty() ? 0 : receipts.value().back().gas_used;
+
+        // Commit, with the header root population carved out. The two parts
+        // of the commit around it are measured separately, as subtracting
+        // the roots phase could underflow the non-monotonic counters.
+        auto const commit_begin = take_sample(perf);
+        std::optional<Sample> roots_begin;
+        std::optional<Sample> roots_end;
+        auto [state, code, _] = std::move(block_state).release();
+        bytes32_t const block_id{block.header.number};
+        auto builder = make_commit_builder(block.header.number, tdb);
+        builder->add_state_deltas(*state)
+            .add_code(code)
+            .add_receipts(receipts.value())
+            .add_transactions(block.transactions, senders)
+            .add_call_frames(call_frames)
+            .add_ommers(block.ommers);
+        if (block.withdrawals.has_value()) {
+            builder->add_withdrawals(block.withdrawals.value());
+        }
+        tdb.commit(
+            block_id, *builder, block.header, *state, [&](BlockHeader &h) {
+                roots_begin = take_sample(perf);
+                h.receipts_root = tdb.receipts_root();
+                h.state_root = tdb.state_root();
+                h.withdrawals_root = tdb.withdrawals_root();
+                h.transactions_root = tdb.transactions_root();
+                h.gas_used = result.gas_used;
+                h.logs_bloom = compute_bloom(receipts.value());
+                h.ommers_hash = compute_ommers_hash(block.ommers);
+                roots_end = take_sample(perf);
+            });
+        auto const commit_end = take_sample(perf);
+        MONAD_ASSERT(roots_begin.has_value() && roots_end.has_value());
+        phase(Phase::roots) = PhaseStats::between(*roots_begin, *roots_end);
+        phase(Phase::commit) = PhaseStats::between(commit_begin, *roots_begin);
+        phase(Phase::commit) += PhaseStats::between(*roots_end, commit_end);
+
+        tdb.finalize(block.header.number, block_id);
+        block_hash_buffer.set(
+            block.header.number,
+            to_bytes(
+                keccak256(rlp::encode_block_header(tdb.read_eth_header()))));
+        return result;
+    }
+}
+
+int main(int const argc, char const *argv[])
+{
+    WorkloadConfig config{
+        .blocks = 10, .txs_per_block = 1000, .conflict_percent = 0, .seed = 0};
+    uint64_t num_senders = 1000;
+    unsigned threads = 4;
+    unsigned fibers = 256;
+    bool on_disk = false;
+    std::vector<std::filesystem::path> dbname_paths;
+    std::filesystem::path output;
+    bool per_block = false;
+
+    CLI::App cli(
+        "Replay generated blocks through execute_block and commit",
+        "block_replay_bench");
+    cli.add_option("--blocks", config.blocks, "Number of blocks to replay");
+    cli.add_option(
+        "--txs", config.txs_per_block, "Number of transactions per block");
+    cli.add_option(
+        "--senders", num_senders, "Number of distinct sending accounts");
+    cli.add_option(
+           "--conflict-percent",
+           config.conflict_percent,
+           "Percentage of transactions calling a shared counter contract")
+        ->check(CLI::Range(0, 100));
+    cli.add_option("--seed", config.seed, "Seed for the workload generator");
+    cli.add_option("--threads", threads, "Number of fiber pool threads");
+    cli.add_option("--fibers", fibers, "Number of fibers");
+    cli.add_flag("--on-disk", on_disk, "Use an on-disk db (default anonymous)");
+    cli.add_option("--db", dbname_paths, "On-disk db paths, implies --on-disk");
+    cli.add_option("--output", output, "JSON output file (default stdout)");
+    cli.add_flag("--per-block", per_block, "Include per-block results");
+    try {
+        cli.parse(argc, argv);
+    }
+    catch (CLI::ParseError const &e) {
+        return cli.exit(e);
+    }
+    on_disk |= !dbname_paths.empty();
+    MONAD_ASSERT(num_senders > 0);
+
+    // must be opened before any thread is created for inherit to cover it
+    PerfCounters const perf;
+    if (!perf.available()) {
+        std::cerr << "perf events unavailable, reporting wall time only"
+                  << std::endl;
+    }
+
+    secp256k1_context_ptr const secp_context(
+        secp256k1_context_create(SECP256K1_CONTEXT_SIGN),
+        secp256k1_context_destroy);
+    auto senders = make_senders(secp_context.get(), num_senders);
+
+    std::unique_ptr<mpt::Db> const db =
+        on_disk ? std::make_unique<mpt::Db>(
+                      std::make_unique<OnDiskMachine>(),
+                      mpt::OnDiskDbConfig{.dbname_paths = dbname_paths})
+                : std::make_unique<mpt::Db>(
+                      std::make_unique<InMemoryMachine>());
+    TrieDb tdb{*db};
+    vm::VM vm;
+    commit_genesis(tdb, senders);
+
+    auto const blocks = generate_blocks(secp_context.get(), senders, config);
+
+    EthereumMainnet const chain;
+    fiber::PriorityPool priority_pool{threads, fibers};
+    BlockHashBufferFinalized block_hash_buffer;
+    block_hash_buffer.set(
+        0,
+        to_bytes(keccak256(rlp::encode_block_header(tdb.read_eth_header()))));
+
+    std::vector<BlockResult> results;
+    results.reserve(blocks.size());
+    for (auto const &block : blocks) {
+        results.push_back(replay_block(
+            perf, chain, tdb, vm, block_hash_buffer, priority_pool, block));
+    }
+
+    PhaseArray totals{};
+    uint64_t total_txs = 0;
+    uint64_t total_gas = 0;
+    uint64_t total_retries = 0;
+    nlohmann::json per_block_json = nlohmann::json::array();
+    for (auto const &r : results) {
+        for (size_t i = 0; i < totals.size(); ++i) {
+            totals[i] += r.phases[i];
+        }
+        total_txs += r.transactions;
+        total_gas += r.gas_used;
+        total_retries += r.retries;
+        if (per_block) {
+            per_block_json.push_back(
+                {{"number", r.number},
+                 {"transactions", r.transactions},
+                 {"gas_used", r.gas_used},
+                 {"retries", r.retries},
+                 {"phases", phases_to_json(r.phases, perf.available())}});
+        }
+    }
+
+    nlohmann::json report;
+    report["config"] = {
+        {"blocks", config.blocks},
+        {"txs_per_block", config.txs_per_block},
+        {"senders", num_senders},
+        {"conflict_percent", config.conflict_percent},
+        {"seed", config.seed},
+        {"threads", threads},
+        {"fibers", fibers},
+        {"on_disk", on_disk}};
+    report["perf_events"] = perf.available();
+    report["totals"] = {
+        {"transactions", total_txs},
+        {"gas_used", total_gas},
+        {"retries", total_retries},
+        {"phases", phases_to_json(totals, perf.available())}};
+    if (per_block) {
+        report["blocks"] = std::move(per_block_json);
+    }
+
+    if (output.empty()) {
+        std::cout << report.dump(2) << std::endl;
+    }
+    else {
+        std::ofstream out{output};
+        MONAD_ASSERT(out.good());
+        out << report.dump(2) << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,157 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Benchmark for decoding the transaction list of a block body.
+//
+// Encodes a synthetic list of EIP-1559 transactions with access lists and
+// calldata, then measures per iteration:
+//   - owning:      decode_transaction_list into Transaction objects
+//   - view:        decode_transaction_view_list, validating in place
+//   - materialize: the view decoding followed by materialize_transaction
+//                  of every view
+
+#include <category/core/assert.h>
+#include <category/core/byte_string.hpp>
+#include <category/core/bytes.hpp>
+#include <category/core/int.hpp>
+#include <category/execution/ethereum/core/rlp/transaction_rlp.hpp>
+#include <category/execution/ethereum/core/transaction.hpp>
+#include <category/execution/ethereum/core/transaction_view.hpp>
+#include <category/execution/ethereum/rlp/encode2.hpp>
+
+#include <CLI/CLI.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace monad;
+
+namespace
+{
+    byte_string encode_body_transactions(
+        uint64_t const num_transactions, size_t const calldata_bytes)
+    {
+        byte_string encoded;
+        for (uint64_t i = 0; i < num_transactions; ++i) {
+            Address to{};
+            to.bytes[0] = static_cast<uint8_t>(i);
+            to.bytes[19] = static_cast<uint8_t>(i >> 8);
+            Transaction const tx{
+                .sc =
+                    {.signature =
+                         {.r = uint256_t{i + 1} << 200,
+                          .s = uint256_t{i + 2} << 200,
+                          .y_parity = static_cast<uint8_t>(i & 1)},
+                     .chain_id = 143},
+                .nonce = i,
+                .max_fee_per_gas = 100'000'000'000,
+                .gas_limit = 200'000,
+                .value = i,
+                .to = to,
+                .type = TransactionType::eip1559,
+                .data = byte_string(calldata_bytes, static_cast<uint8_t>(i)),
+                .access_list =
+                    {AccessEntry{to, {bytes32_t{i}, bytes32_t{i + 1}}}},
+                .max_priority_fee_per_gas = 1'000'000'000};
+            encoded += rlp::encode_string2(rlp::encode_transaction(tx));
+        }
+        return rlp::encode_list2(encoded);
+    }
+
+    enum class Mode
+    {
+        owning,
+        view,
+        materialize
+    };
+
+    double run_once(byte_string const &encoded, Mode const mode)
+    {
+        byte_string_view enc{encoded};
+        auto const begin = std::chrono::steady_clock::now();
+        switch (mode) {
+        case Mode::owning: {
+            auto const res = rlp::decode_transaction_list(enc);
+            MONAD_ASSERT(!res.has_error());
+            break;
+        }
+        case Mode::view: {
+            auto const res = rlp::decode_transaction_view_list(enc);
+            MONAD_ASSERT(!res.has_error());
+            break;
+        }
+        case Mode::materialize: {
+            auto const res = rlp::decode_transaction_view_list(enc);
+            MONAD_ASSERT(!res.has_error());
+            std::vector<Transaction> transactions;
+            transactions.reserve(res.value().size());
+            for (auto const &view : res.value()) {
+                auto tx = rlp::materialize_transaction(view);
+                MONAD_ASSERT(!tx.has_error());
+                transactions.emplace_back(std::move(tx.value()));
+            }
+            break;
+        }
+        }
+        auto const end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - begin).count();
+    }
+}
+
+int main(int const argc, char const *argv[])
+{
+    uint64_t num_transactions = 10'000;
+    size_t calldata_bytes = 256;
+    unsigned iterations = 20;
+
+    CLI::App cli(
+        "Benchmark for decoding the transactions of a block body",
+        "rlp_decode_bench");
+    cli.add_option(
+        "--transactions", num_transactions, "Transactions in the body");
+    cli.add_option(
+        "--calldata-bytes", calldata_bytes, "Calldata size per transaction");
+    cli.add_option("--iterations", iterations, "Iterations per mode");
+    try {
+        cli.parse(argc, argv);
+    }
+    catch (CLI::ParseError const &e) {
+        return cli.exit(e);
+    }
+
+    auto const encoded =
+        encode_body_transactions(num_transactions, calldata_bytes);
+
+    std::cout << "transactions: " << num_transactions
+              << ", encoded bytes: " << encoded.size() << std::endl;
+    for (auto const [mode, name] :
+         {std::pair{Mode::owning, "owning"},
+          std::pair{Mode::view, "view"},
+          std::pair{Mode::materialize, "materialize"}}) {
+        double total = 0;
+        for (unsigned i = 0; i < iterations; ++i) {
+            total += run_once(encoded, mode);
+        }
+        double const mean = total / iterations;
+        std::cout << "  " << name << ": " << mean << " us, "
+                  << static_cast<double>(encoded.size()) / mean << " MB/s"
+                  << std::endl;
+    }
+    return 0;
+}
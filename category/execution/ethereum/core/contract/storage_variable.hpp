@@ -80,6 +80,16 @@ public:
     {
     }
 
+    // Storage keys backing this variable, e.g. for State::prefetch_storage
+    Slots keys() const noexcept
+    {
+        Slots keys;
+        for (size_t i = 0; i < N; ++i) {
+            keys[i] = store_be_as<bytes32_t>(offset_ + i);
+        }
+        return keys;
+    }
+
     T load() const noexcept
     {
         Slots slots;
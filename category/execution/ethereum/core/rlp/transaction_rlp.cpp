@@ -28,6 +28,7 @@
 #include <category/execution/ethereum/core/rlp/transaction_rlp.hpp>
 #include <category/execution/ethereum/core/signature.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
+#include <category/execution/ethereum/core/transaction_view.hpp>
 #include <category/execution/ethereum/rlp/decode.hpp>
 #include <category/execution/ethereum/rlp/encode2.hpp>
 
@@ -404,4 +405,200 @@ Result<std::vector<Transaction>> decode_transaction_list(byte_string_view &enc)
     return transactions;
 }
 
+// Decode in place
+namespace
+{
+    // The validators below walk a list without materializing it and return
+    // its encoding including the list header
+
+    Result<byte_string_view> validate_access_list(byte_string_view &enc)
+    {
+        BOOST_OUTCOME_TRY(auto const raw, parse_list_metadata_raw(enc));
+        byte_string_view list{raw};
+        BOOST_OUTCOME_TRY(auto payload, parse_list_metadata(list));
+        while (!payload.empty()) {
+            BOOST_OUTCOME_TRY(auto entry, parse_list_metadata(payload));
+            BOOST_OUTCOME_TRY(decode_address(entry));
+            BOOST_OUTCOME_TRY(auto keys, parse_list_metadata(entry));
+            while (!keys.empty()) {
+                BOOST_OUTCOME_TRY(decode_bytes32(keys));
+            }
+            if (MONAD_UNLIKELY(!entry.empty())) {
+                return DecodeError::InputTooLong;
+            }
+        }
+        return raw;
+    }
+
+    Result<byte_string_view>
+    validate_blob_versioned_hashes(byte_string_view &enc)
+    {
+        BOOST_OUTCOME_TRY(auto const raw, parse_list_metadata_raw(enc));
+        byte_string_view list{raw};
+        BOOST_OUTCOME_TRY(auto payload, parse_list_metadata(list));
+        while (payload.size() >= sizeof(bytes32_t)) {
+            BOOST_OUTCOME_TRY(decode_bytes32(payload));
+        }
+        return raw;
+    }
+
+    Result<byte_string_view>
+    validate_authorization_list(byte_string_view &enc)
+    {
+        BOOST_OUTCOME_TRY(auto const raw, parse_list_metadata_raw(enc));
+        byte_string_view list{raw};
+        BOOST_OUTCOME_TRY(auto payload, parse_list_metadata(list));
+        while (!payload.empty()) {
+            BOOST_OUTCOME_TRY(decode_authorization_entry(payload));
+        }
+        return raw;
+    }
+}
+
+Result<TransactionView> decode_transaction_view_legacy(byte_string_view &enc)
+{
+    TransactionView txn;
+    BOOST_OUTCOME_TRY(auto payload, parse_list_metadata(enc));
+
+    txn.type = TransactionType::legacy;
+    BOOST_OUTCOME_TRY(txn.nonce, decode_unsigned<uint64_t>(payload));
+    BOOST_OUTCOME_TRY(txn.max_fee_per_gas, decode_unsigned<uint256_t>(payload));
+    BOOST_OUTCOME_TRY(txn.gas_limit, decode_unsigned<uint64_t>(payload));
+    BOOST_OUTCOME_TRY(txn.to, decode_optional_address(payload));
+    BOOST_OUTCOME_TRY(txn.value, decode_unsigned<uint256_t>(payload));
+    BOOST_OUTCOME_TRY(txn.data, decode_string(payload));
+    BOOST_OUTCOME_TRY(txn.sc, decode_sc(payload));
+    BOOST_OUTCOME_TRY(txn.sc.signature.r, decode_unsigned<uint256_t>(payload));
+    BOOST_OUTCOME_TRY(txn.sc.signature.s, decode_unsigned<uint256_t>(payload));
+
+    if (MONAD_UNLIKELY(!payload.empty())) {
+        return DecodeError::InputTooLong;
+    }
+
+    return txn;
+}
+
+Result<TransactionView> decode_transaction_view_eip2718(byte_string_view &enc)
+{
+    TransactionView txn;
+    MONAD_ASSERT(enc.size());
+    if (MONAD_UNLIKELY(
+            enc[0] >= static_cast<unsigned char>(TransactionType::LAST))) {
+        return DecodeError::InvalidTxnType;
+    }
+    txn.type = static_cast<TransactionType>(enc[0]);
+    enc = enc.substr(1);
+    BOOST_OUTCOME_TRY(auto payload, parse_list_metadata(enc));
+
+    txn.sc.chain_id = uint256_t{};
+    BOOST_OUTCOME_TRY(*txn.sc.chain_id, decode_unsigned<uint256_t>(payload));
+    BOOST_OUTCOME_TRY(txn.nonce, decode_unsigned<uint64_t>(payload));
+
+    if (txn.type == TransactionType::eip1559 ||
+        txn.type == TransactionType::eip4844 ||
+        txn.type == TransactionType::eip7702) {
+        BOOST_OUTCOME_TRY(
+            txn.max_priority_fee_per_gas, decode_unsigned<uint256_t>(payload));
+    }
+
+    BOOST_OUTCOME_TRY(txn.max_fee_per_gas, decode_unsigned<uint256_t>(payload));
+    BOOST_OUTCOME_TRY(txn.gas_limit, decode_unsigned<uint64_t>(payload));
+    BOOST_OUTCOME_TRY(txn.to, decode_optional_address(payload));
+    BOOST_OUTCOME_TRY(txn.value, decode_unsigned<uint256_t>(payload));
+    BOOST_OUTCOME_TRY(txn.data, decode_string(payload));
+    BOOST_OUTCOME_TRY(txn.access_list, validate_access_list(payload));
+
+    if (txn.type == TransactionType::eip4844) {
+        if (!txn.to.has_value()) {
+            return DecodeError::InputTooShort;
+        }
+        BOOST_OUTCOME_TRY(
+            txn.max_fee_per_blob_gas, decode_unsigned<uint256_t>(payload));
+        BOOST_OUTCOME_TRY(
+            txn.blob_versioned_hashes, validate_blob_versioned_hashes(payload));
+    }
+
+    if (txn.type == TransactionType::eip7702) {
+        if (!txn.to.has_value()) {
+            return DecodeError::InputTooShort;
+        }
+
+        BOOST_OUTCOME_TRY(
+            txn.authorization_list, validate_authorization_list(payload));
+    }
+
+    BOOST_OUTCOME_TRY(
+        txn.sc.signature.y_parity, decode_unsigned<uint8_t>(payload));
+    BOOST_OUTCOME_TRY(txn.sc.signature.r, decode_unsigned<uint256_t>(payload));
+    BOOST_OUTCOME_TRY(txn.sc.signature.s, decode_unsigned<uint256_t>(payload));
+
+    if (MONAD_UNLIKELY(!payload.empty())) {
+        return DecodeError::InputTooLong;
+    }
+
+    return txn;
+}
+
+Result<std::vector<TransactionView>>
+decode_transaction_view_list(byte_string_view &enc)
+{
+    std::vector<TransactionView> transactions;
+    BOOST_OUTCOME_TRY(auto ls, parse_list_metadata(enc));
+
+    // Signed transactions rarely take under 100 bytes
+    transactions.reserve(ls.size() / 100);
+    while (!ls.empty()) {
+        if (ls[0] >= 0xc0) {
+            BOOST_OUTCOME_TRY(auto tx, decode_transaction_view_legacy(ls));
+            transactions.emplace_back(std::move(tx));
+        }
+        else {
+            BOOST_OUTCOME_TRY(auto str, parse_string_metadata(ls));
+            if (MONAD_UNLIKELY(str.empty())) {
+                return DecodeError::InputTooShort;
+            }
+            BOOST_OUTCOME_TRY(auto tx, decode_transaction_view_eip2718(str));
+            transactions.emplace_back(std::move(tx));
+        }
+    }
+    MONAD_ASSERT(ls.empty());
+
+    return transactions;
+}
+
+Result<Transaction> materialize_transaction(TransactionView const &view)
+{
+    Transaction txn;
+    txn.sc = view.sc;
+    txn.nonce = view.nonce;
+    txn.max_fee_per_gas = view.max_fee_per_gas;
+    txn.gas_limit = view.gas_limit;
+    txn.value = view.value;
+    txn.to = view.to;
+    txn.type = view.type;
+    txn.data = byte_string{view.data};
+    txn.max_priority_fee_per_gas = view.max_priority_fee_per_gas;
+    txn.max_fee_per_blob_gas = view.max_fee_per_blob_gas;
+
+    if (!view.access_list.empty()) {
+        byte_string_view enc{view.access_list};
+        BOOST_OUTCOME_TRY(txn.access_list, decode_access_list(enc));
+    }
+    if (!view.blob_versioned_hashes.empty()) {
+        byte_string_view enc{view.blob_versioned_hashes};
+        BOOST_OUTCOME_TRY(auto hashes_payload, parse_list_metadata(enc));
+        while (hashes_payload.size() >= sizeof(bytes32_t)) {
+            BOOST_OUTCOME_TRY(auto const hash, decode_bytes32(hashes_payload));
+            txn.blob_versioned_hashes.emplace_back(hash);
+        }
+    }
+    if (!view.authorization_list.empty()) {
+        byte_string_view enc{view.authorization_list};
+        BOOST_OUTCOME_TRY(
+            txn.authorization_list, decode_authorization_list(enc));
+    }
+
+    return txn;
+}
+
 MONAD_RLP_NAMESPACE_END
@@ -20,6 +20,7 @@
 #include <category/core/result.hpp>
 #include <category/core/rlp/config.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
+#include <category/execution/ethereum/core/transaction_view.hpp>
 
 #include <vector>
 
@@ -42,4 +43,12 @@ Result<Transaction> decode_transaction_eip2718(byte_string_view &);
 Result<Transaction> decode_transaction(byte_string_view &);
 Result<std::vector<Transaction>> decode_transaction_list(byte_string_view &enc);
 
+// Single pass decoding of transactions into views of the encoded buffer,
+// see TransactionView
+Result<TransactionView> decode_transaction_view_legacy(byte_string_view &);
+Result<TransactionView> decode_transaction_view_eip2718(byte_string_view &);
+Result<std::vector<TransactionView>>
+decode_transaction_view_list(byte_string_view &enc);
+Result<Transaction> materialize_transaction(TransactionView const &);
+
 MONAD_RLP_NAMESPACE_END
@@ -18,6 +18,8 @@
 #include <category/core/runtime/uint256.hpp>
 #include <category/execution/ethereum/core/rlp/transaction_rlp.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
+#include <category/execution/ethereum/core/transaction_view.hpp>
+#include <category/execution/ethereum/rlp/encode2.hpp>
 
 #include <evmc/evmc.hpp>
 
@@ -25,6 +27,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <vector>
 
 using namespace monad;
 using namespace monad::rlp;
@@ -541,3 +544,109 @@ TEST(Rlp_Transaction, ParseListMetadataLengthOverflow)
     auto result = decode_transaction(enc);
     EXPECT_TRUE(result.has_error());
 }
+
+TEST(Rlp_Transaction, DecodeViewList)
+{
+    static constexpr auto to_addr{
+        0x3535353535353535353535353535353535353535_address};
+    static constexpr auto r{
+        0x28ef61340bd939bc2195fe537567866003e1a15d3c71ff63e1590620aa636276_u256};
+    static constexpr auto s{
+        0x67cbe9d8997f761aecb703304b3800ccf555c9f3dc64214b297fb1966a3b6d83_u256};
+    static constexpr auto key{
+        0x0000000000000000000000000000000000000000000000000000000000000007_bytes32};
+
+    std::vector<Transaction> transactions;
+    transactions.push_back(Transaction{
+        .sc = {.signature = {.r = r, .s = s}},
+        .nonce = 9,
+        .max_fee_per_gas = 20'000'000'000,
+        .gas_limit = 21'000,
+        .value = 1,
+        .to = to_addr,
+        .data = byte_string(100, 0xab)});
+    transactions.push_back(Transaction{
+        .sc = {.signature = {.r = r, .s = s, .y_parity = 1}, .chain_id = 1},
+        .nonce = 10,
+        .max_fee_per_gas = 30'000'000'000,
+        .gas_limit = 50'000,
+        .to = std::nullopt,
+        .type = TransactionType::eip1559,
+        .data = byte_string(1000, 0xcd),
+        .access_list = {AccessEntry{to_addr, {key, key}}},
+        .max_priority_fee_per_gas = 2'000'000'000});
+    transactions.push_back(Transaction{
+        .sc = {.signature = {.r = r, .s = s}, .chain_id = 1},
+        .nonce = 11,
+        .gas_limit = 100'000,
+        .to = to_addr,
+        .type = TransactionType::eip4844,
+        .max_fee_per_blob_gas = 7,
+        .blob_versioned_hashes = {key, key}});
+    transactions.push_back(Transaction{
+        .sc = {.signature = {.r = r, .s = s}, .chain_id = 1},
+        .nonce = 12,
+        .gas_limit = 100'000,
+        .to = to_addr,
+        .type = TransactionType::eip7702,
+        .authorization_list = {AuthorizationEntry{
+            .sc = {.signature = {.r = r, .s = s}, .chain_id = 1},
+            .address = to_addr,
+            .nonce = 3}}});
+
+    byte_string encoded;
+    for (auto const &tx : transactions) {
+        encoded += tx.type == TransactionType::legacy
+                       ? encode_transaction(tx)
+                       : encode_string2(encode_transaction(tx));
+    }
+    encoded = encode_list2(encoded);
+
+    byte_string_view enc{encoded};
+    auto const views = decode_transaction_view_list(enc);
+    ASSERT_FALSE(views.has_error());
+    EXPECT_TRUE(enc.empty());
+    ASSERT_EQ(views.value().size(), transactions.size());
+
+    for (size_t i = 0; i < transactions.size(); ++i) {
+        auto const &view = views.value()[i];
+        // Calldata is not copied out of the encoded list
+        EXPECT_EQ(byte_string{view.data}, transactions[i].data);
+        if (!view.data.empty()) {
+            EXPECT_GE(view.data.data(), encoded.data());
+            EXPECT_LE(
+                view.data.data() + view.data.size(),
+                encoded.data() + encoded.size());
+        }
+        auto const materialized = materialize_transaction(view);
+        ASSERT_FALSE(materialized.has_error());
+        EXPECT_EQ(materialized.value(), transactions[i]);
+    }
+
+    byte_string_view owning_enc{encoded};
+    auto const owning = decode_transaction_list(owning_enc);
+    ASSERT_FALSE(owning.has_error());
+    EXPECT_EQ(owning.value(), transactions);
+}
+
+TEST(Rlp_Transaction, DecodeViewRejectsMalformedAccessList)
+{
+    static constexpr auto to_addr{
+        0x3535353535353535353535353535353535353535_address};
+    Transaction const t{
+        .sc = {.chain_id = 1},
+        .to = to_addr,
+        .type = TransactionType::eip2930,
+        .access_list = {AccessEntry{to_addr, {bytes32_t{}}}}};
+    auto encoded = encode_transaction(t);
+
+    // Shorten the storage key string header from 32 to 31 bytes
+    auto const key_header = encoded.find(static_cast<unsigned char>(0xa0));
+    ASSERT_NE(key_header, byte_string::npos);
+    encoded[key_header] = 0x9f;
+
+    byte_string_view owning_enc{encoded};
+    EXPECT_TRUE(decode_transaction(owning_enc).has_error());
+    byte_string_view view_enc{encoded};
+    EXPECT_TRUE(decode_transaction_view_eip2718(view_enc).has_error());
+}
@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <category/core/config.hpp>
+
+#include <category/core/address.hpp>
+#include <category/core/byte_string.hpp>
+#include <category/core/int.hpp>
+#include <category/execution/ethereum/core/signature.hpp>
+#include <category/execution/ethereum/core/transaction.hpp>
+
+#include <optional>
+
+MONAD_NAMESPACE_BEGIN
+
+/// A transaction decoded in place from its RLP encoding. The fixed size
+/// fields are decoded; calldata and the variable length lists reference the
+/// encoded buffer, which must outlive the view. The lists have already been
+/// validated, so materializing a view into a Transaction cannot fail.
+struct TransactionView
+{
+    SignatureAndChain sc{};
+    uint64_t nonce{};
+    uint256_t max_fee_per_gas{}; // gas_price
+    uint64_t gas_limit{};
+    uint256_t value{};
+    std::optional<Address> to{};
+    TransactionType type{};
+    byte_string_view data{};
+    uint256_t max_priority_fee_per_gas{};
+    uint256_t max_fee_per_blob_gas{};
+
+    // RLP encodings of the lists including their headers; empty when the
+    // transaction type has no such list
+    byte_string_view access_list{};
+    byte_string_view blob_versioned_hashes{};
+    byte_string_view authorization_list{};
+};
+
+MONAD_NAMESPACE_END
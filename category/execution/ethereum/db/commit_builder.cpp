@@ -62,6 +62,17 @@ namespace
     }
 }
 
+EncodedTransactionOutput encode_transaction_output(
+    Receipt const &receipt, size_t const log_index_begin,
+    Transaction const &transaction, Address const &sender)
+{
+    auto const encoded_tx = rlp::encode_transaction(transaction);
+    return EncodedTransactionOutput{
+        .receipt = encode_receipt_db(receipt, log_index_begin),
+        .transaction = encode_transaction_db(encoded_tx, sender),
+        .hash = keccak256(encoded_tx)};
+}
+
 CommitBuilder::CommitBuilder(uint64_t const block_number)
     : block_number_{block_number}
 {
@@ -231,6 +242,71 @@ CommitBuilder &CommitBuilder::add_transactions(
     return *this;
 }
 
+CommitBuilder &CommitBuilder::add_transaction_outputs(
+    std::vector<EncodedTransactionOutput> const &outputs)
+{
+    UpdateList receipt_updates;
+    UpdateList txn_updates;
+    UpdateList txn_hash_updates;
+
+    MONAD_ASSERT(outputs.size() <= std::numeric_limits<uint32_t>::max());
+
+    auto const encoded_block_number =
+        bytes_alloc_.emplace_back(rlp::encode_unsigned(block_number_));
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(outputs.size()); ++i) {
+        auto const &rlp_index =
+            bytes_alloc_.emplace_back(rlp::encode_unsigned(i));
+        auto const &output = outputs[i];
+
+        receipt_updates.push_front(update_alloc_.emplace_back(Update{
+            .key = NibblesView{rlp_index},
+            .value = output.receipt,
+            .incarnation = false,
+            .next = UpdateList{},
+            .version = static_cast<int64_t>(block_number_)}));
+
+        txn_updates.push_front(update_alloc_.emplace_back(Update{
+            .key = NibblesView{rlp_index},
+            .value = output.transaction,
+            .incarnation = false,
+            .next = UpdateList{},
+            .version = static_cast<int64_t>(block_number_)}));
+
+        txn_hash_updates.push_front(update_alloc_.emplace_back(Update{
+            .key = NibblesView{output.hash},
+            .value = bytes_alloc_.emplace_back(
+                rlp::encode_list2(encoded_block_number, rlp_index)),
+            .incarnation = false,
+            .next = UpdateList{},
+            .version = static_cast<int64_t>(block_number_)}));
+    }
+
+    // same subtrie order as add_receipts followed by add_transactions
+    updates_.push_front(update_alloc_.emplace_back(Update{
+        .key = receipt_nibbles,
+        .value = byte_string_view{},
+        .incarnation = true,
+        .next = std::move(receipt_updates),
+        .version = static_cast<int64_t>(block_number_)}));
+
+    updates_.push_front(update_alloc_.emplace_back(Update{
+        .key = transaction_nibbles,
+        .value = byte_string_view{},
+        .incarnation = true,
+        .next = std::move(txn_updates),
+        .version = static_cast<int64_t>(block_number_)}));
+
+    updates_.push_front(update_alloc_.emplace_back(Update{
+        .key = tx_hash_nibbles,
+        .value = byte_string_view{},
+        .incarnation = false,
+        .next = std::move(txn_hash_updates),
+        .version = static_cast<int64_t>(block_number_)}));
+
+    return *this;
+}
+
 CommitBuilder &CommitBuilder::add_call_frames(
     std::vector<std::vector<CallFrame>> const &call_frames)
 {
@@ -15,13 +15,16 @@
 
 #pragma once
 
+#include <category/core/address.hpp>
 #include <category/core/byte_string.hpp>
 #include <category/core/bytes.hpp>
 #include <category/core/config.hpp>
+#include <category/core/keccak.hpp>
 #include <category/execution/ethereum/state2/proposal_post_state.hpp>
 #include <category/execution/ethereum/state2/state_deltas.hpp>
 #include <category/mpt/update.hpp>
 
+#include <cstddef>
 #include <deque>
 #include <vector>
 
@@ -33,6 +36,20 @@ struct BlockHeader;
 struct Receipt;
 struct Withdrawal;
 
+// Receipt and transaction trie leaves of one transaction, encoded by its
+// execution fiber as soon as it merges
+struct EncodedTransactionOutput
+{
+    byte_string receipt;
+    byte_string transaction;
+    hash256 hash;
+};
+
+// `receipt.gas_used` must already be cumulative (YP eq. 22)
+EncodedTransactionOutput encode_transaction_output(
+    Receipt const &, size_t log_index_begin, Transaction const &,
+    Address const &sender);
+
 class CommitBuilder
 {
 protected:
@@ -60,6 +77,12 @@ public:
     CommitBuilder &add_transactions(
         std::vector<Transaction> const &, std::vector<Address> const &);
 
+    // Equivalent to add_receipts followed by add_transactions, but only
+    // assembles the update lists; the leaves are referenced, not copied, so
+    // the outputs must outlive build()
+    CommitBuilder &
+    add_transaction_outputs(std::vector<EncodedTransactionOutput> const &);
+
     CommitBuilder &add_call_frames(std::vector<std::vector<CallFrame>> const &);
 
     CommitBuilder &add_ommers(std::vector<BlockHeader> const &);
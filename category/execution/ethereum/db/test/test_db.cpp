@@ -21,10 +21,12 @@
 #include <category/execution/ethereum/core/rlp/int_rlp.hpp>
 #include <category/execution/ethereum/core/rlp/transaction_rlp.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
+#include <category/execution/ethereum/db/commit_builder.hpp>
 #include <category/execution/ethereum/db/trie_db.hpp>
 #include <category/execution/ethereum/db/util.hpp>
 #include <category/execution/ethereum/rlp/encode2.hpp>
 #include <category/execution/ethereum/trace/rlp/call_frame_rlp.hpp>
+#include <category/execution/monad/db/page_commit_builder.hpp>
 #include <category/mpt/nibbles_view.hpp>
 #include <category/mpt/node.hpp>
 #include <category/mpt/ondisk_db_config.hpp>
@@ -648,6 +650,111 @@ TYPED_TEST(DBTest, commit_receipts_transactions)
     verify_read_and_parse_transaction(second_block);
 }
 
+TYPED_TEST(DBTest, commit_transaction_outputs)
+{
+    TrieDb tdb{this->db};
+    commit_sequential(tdb, StateDeltas({}), Code{}, BlockHeader{});
+
+    std::vector<Receipt> receipts;
+    Receipt rct{
+        .status = 1, .gas_used = 43'092, .type = TransactionType::legacy};
+    rct.add_log(Receipt::Log{
+        .data = 0x1195387bce41fd49_bytes,
+        .topics =
+            {0xf341246adaac6f497bc2a656f546ab9e182111d630394f0c57c710a59a2cb567_bytes32},
+        .address = 0x8d12a197cb00d4747a1fe03395095ce2a5cc6819_address});
+    receipts.push_back(rct);
+    rct.gas_used = 86'184;
+    receipts.push_back(std::move(rct));
+
+    std::vector<Transaction> transactions;
+    Transaction tx{
+        .sc =
+            {.signature =
+                 {.r =
+                      0x28ef61340bd939bc2195fe537567866003e1a15d3c71ff63e1590620aa636276_u256,
+                  .s =
+                      0x67cbe9d8997f761aecb703304b3800ccf555c9f3dc64214b297fb1966a3b6d83_u256},
+             .chain_id = 5},
+        .nonce = 10,
+        .max_fee_per_gas = 20'000'000'000,
+        .gas_limit = 43'092,
+        .value = 0xde0b6b3a7640000_u256,
+        .to = 0x3535353535353535353535353535353535353535_address};
+    transactions.push_back(tx);
+    tx.nonce = 11;
+    transactions.push_back(tx);
+    std::vector<Address> const senders = recover_senders(transactions);
+    std::vector<std::vector<CallFrame>> const call_frames(receipts.size());
+
+    // reference: the receipts and transactions encoded at commit time
+    commit_sequential(
+        tdb,
+        StateDeltas({}),
+        Code{},
+        BlockHeader{.number = 1},
+        receipts,
+        call_frames,
+        senders,
+        transactions);
+    auto const receipts_root = tdb.receipts_root();
+    auto const transactions_root = tdb.transactions_root();
+
+    std::vector<EncodedTransactionOutput> outputs;
+    size_t log_index_begin = 0;
+    for (size_t i = 0; i < receipts.size(); ++i) {
+        outputs.push_back(encode_transaction_output(
+            receipts[i], log_index_begin, transactions[i], senders[i]));
+        log_index_begin += receipts[i].logs.size();
+    }
+    BlockHeader const header{.number = 2};
+    bytes32_t const block_id{header.number};
+    auto builder = make_commit_builder(header.number, tdb);
+    builder->add_state_deltas(StateDeltas({}))
+        .add_code(Code{})
+        .add_transaction_outputs(outputs)
+        .add_call_frames(call_frames)
+        .add_ommers({});
+    tdb.commit(
+        block_id, *builder, header, StateDeltas({}), [&](BlockHeader &h) {
+            h.receipts_root = tdb.receipts_root();
+            h.transactions_root = tdb.transactions_root();
+        });
+    tdb.finalize(header.number, block_id);
+    tdb.set_block_and_prefix(header.number);
+
+    EXPECT_EQ(tdb.receipts_root(), receipts_root);
+    EXPECT_EQ(tdb.transactions_root(), transactions_root);
+
+    auto const receipt_res = this->db.find(
+        tdb.get_root(),
+        mpt::concat(
+            FINALIZED_NIBBLE,
+            RECEIPT_NIBBLE,
+            mpt::NibblesView{rlp::encode_unsigned<unsigned>(1)}),
+        header.number);
+    ASSERT_TRUE(receipt_res.has_value());
+    auto receipt_value = receipt_res.value().node->value();
+    auto const receipt_db = decode_receipt_db(receipt_value);
+    ASSERT_TRUE(receipt_db.has_value());
+    EXPECT_EQ(receipt_db.value().first, receipts[1]);
+    EXPECT_EQ(receipt_db.value().second, size_t{1});
+
+    auto const hash_res = this->db.find(
+        tdb.get_root(),
+        mpt::concat(
+            FINALIZED_NIBBLE,
+            TX_HASH_NIBBLE,
+            mpt::NibblesView{
+                keccak256(rlp::encode_transaction(transactions[1]))}),
+        header.number);
+    ASSERT_TRUE(hash_res.has_value());
+    EXPECT_EQ(
+        hash_res.value().node->value(),
+        rlp::encode_list2(
+            rlp::encode_unsigned(header.number), rlp::encode_unsigned(1u)));
+}
+
 TEST_F(OnDiskTrieDbWithFileFixture, get_transactions)
 {
 
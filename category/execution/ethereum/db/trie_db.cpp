@@ -22,6 +22,7 @@
 #include <category/core/keccak.h>
 #include <category/core/keccak.hpp>
 #include <category/core/log.hpp>
+#include <category/core/metrics/metrics.hpp>
 #include <category/execution/ethereum/core/account.hpp>
 #include <category/execution/ethereum/core/fmt/address_fmt.hpp> // NOLINT
 #include <category/execution/ethereum/core/fmt/bytes_fmt.hpp> // NOLINT
@@ -106,9 +107,16 @@ std::optional<Account> TrieDb::read_account(Address const &addr)
     std::optional<Account> result;
     auto const status = cache_ ? cache_->try_read_account(addr, result)
                                : CacheReadStatus::MissTruncated;
+    if (cache_) {
+        metrics::add(
+            status == CacheReadStatus::Hit
+                ? metrics::Counter::triedb_account_cache_hit
+                : metrics::Counter::triedb_account_cache_miss);
+    }
     if (status == CacheReadStatus::Hit) {
         return result;
     }
+    metrics::ScopedTimer const timer{metrics::Histogram::triedb_read_account};
     auto const res = db_.find(
         curr_root_,
         concat(
@@ -141,6 +149,12 @@ bytes32_t TrieDb::read_storage(
         cache_ ? cache_->try_read_storage(
                      addr, incarnation, lookup_key, lookup_offset, result)
                : CacheReadStatus::MissTruncated;
+    if (cache_) {
+        metrics::add(
+            status == CacheReadStatus::Hit
+                ? metrics::Counter::triedb_storage_cache_hit
+                : metrics::Counter::triedb_storage_cache_miss);
+    }
     if (status == CacheReadStatus::Hit) {
         return result;
     }
@@ -170,6 +184,7 @@ storage_page_t TrieDb::load_storage_page(
     Address const &addr, Incarnation const incarnation,
     bytes32_t const &lookup_key, CacheReadStatus const status)
 {
+    metrics::ScopedTimer const timer{metrics::Histogram::triedb_read_storage};
     auto const res = db_.find(
         curr_root_,
         concat(
@@ -421,6 +436,12 @@ std::string TrieDb::print_stats()
         ret += ",ac=" + cache_->accounts_stats() +
                ",sc=" + cache_->storage_stats();
     }
+    auto const node_mem = mpt::node_allocator_stats();
+    ret += std::format(
+        ",nchk={}MB,nuse={}MB,nlg={}MB",
+        node_mem.chunk_bytes >> 20,
+        node_mem.in_use_bytes >> 20,
+        node_mem.large_bytes >> 20);
     return ret;
 }
 
@@ -68,6 +68,7 @@ enum monad_exec_event_type : uint16_t
     MONAD_EXEC_ACCOUNT_ACCESS,
     MONAD_EXEC_STORAGE_ACCESS,
     MONAD_EXEC_EVM_ERROR,
+    MONAD_EXEC_BLOCK_CONTRACT_PROFILE,
 };
 
 /// Reserved event type used for recording errors
@@ -291,9 +292,32 @@ struct monad_exec_evm_error
     int64_t status_code; ///< Boost.Outcome status code of error
 };
 
+/// Code tier that a profiled contract call was dispatched to
+enum monad_exec_vm_entrypoint : uint8_t
+{
+    MONAD_VM_ENTRYPOINT_INTERPRETER = 0,
+    MONAD_VM_ENTRYPOINT_NATIVE = 1,
+    MONAD_VM_ENTRYPOINT_NATIVE_OPTIMIZED = 2,
+};
+
+/// Sampled execution profile of one contract in a block, emitted before the
+/// block's end event; totals cover only the sampled calls, multiply them by
+/// `sample_period` to estimate the block-wide cost
+struct monad_exec_block_contract_profile
+{
+    monad_c_bytes32 code_hash;             ///< Hash of the contract code
+    enum monad_exec_vm_entrypoint
+        entrypoint;                        ///< Code tier the calls ran in
+    uint32_t sample_period;                ///< One in this many calls sampled
+    uint64_t sample_count;                 ///< Number of sampled calls
+    uint64_t wall_nanos;                   ///< Wall time, incl. nested calls
+    uint64_t gas_used;                     ///< Gas used, incl. nested calls
+    uint64_t storage_reads;                ///< SLOADs, incl. nested calls
+};
+
 // clang-format on
 
-constexpr size_t MONAD_EXEC_EVENT_COUNT = 25;
+constexpr size_t MONAD_EXEC_EVENT_COUNT = 26;
 extern struct monad_event_metadata const
     g_monad_exec_event_metadata[MONAD_EXEC_EVENT_COUNT];
 extern uint8_t const g_monad_exec_event_schema_hash[32];
@@ -172,12 +172,18 @@ struct monad_event_metadata const
              .c_name = "EVM_ERROR",
              .description = "Error occurred in execution process (not a "
                             "validation error)"},
+
+        [MONAD_EXEC_BLOCK_CONTRACT_PROFILE] =
+            {.event_type = MONAD_EXEC_BLOCK_CONTRACT_PROFILE,
+             .c_name = "BLOCK_CONTRACT_PROFILE",
+             .description = "Sampled execution profile of one contract in "
+                            "a block"},
 };
 
 uint8_t const g_monad_exec_event_schema_hash[32] = {
-    0x89, 0x33, 0xf9, 0x07, 0xc4, 0x32, 0xc9, 0x8a, 0xc0, 0xc8, 0xdb,
-    0x62, 0xf9, 0xaa, 0x16, 0x4c, 0x0c, 0x3f, 0x16, 0x72, 0xf4, 0x12,
-    0x90, 0xe4, 0xea, 0x34, 0x08, 0xdf, 0x6c, 0x67, 0x23, 0xf3,
+    0xc3, 0xed, 0x9e, 0x88, 0x28, 0x8a, 0xef, 0x77, 0x94, 0xdf, 0xe7,
+    0xcb, 0x71, 0x14, 0x80, 0x5b, 0x1d, 0x27, 0x95, 0xb8, 0x85, 0x7a,
+    0x60, 0xff, 0xcf, 0x5a, 0x94, 0x0a, 0x39, 0x2c, 0xa2, 0x35,
 };
 
 #ifdef __cplusplus
@@ -0,0 +1,178 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/assert.h>
+#include <category/core/config.hpp>
+#include <category/core/event/event_recorder.hpp>
+#include <category/core/event/event_ring.h>
+#include <category/core/event/event_ring_util.h>
+#include <category/core/log.hpp>
+#include <category/execution/ethereum/event/exec_event_recorder.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <pthread.h>
+
+MONAD_NAMESPACE_BEGIN
+
+/// Worker thread which runs deferred recording functions in FIFO order; the
+/// executing fibers only pay for a queue push, and the recording thread
+/// drains the whole queue each time it wakes up
+class ExecutionEventRecorder::DeferredRecorder
+{
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable idle_cv_;
+    std::deque<std::function<void()>> queue_;
+    bool busy_{false};
+    bool done_{false};
+    std::thread thread_;
+
+    void run()
+    {
+        pthread_setname_np(pthread_self(), "exec event rec");
+        std::deque<std::function<void()>> batch;
+        std::unique_lock lock{mutex_};
+        while (true) {
+            work_cv_.wait(lock, [this] { return done_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            batch.swap(queue_);
+            busy_ = true;
+            lock.unlock();
+            for (auto &fn : batch) {
+                fn();
+            }
+            // Destroy the captured state snapshots here, off the execution
+            // critical path
+            batch.clear();
+            lock.lock();
+            busy_ = false;
+            if (queue_.empty()) {
+                idle_cv_.notify_all();
+            }
+        }
+    }
+
+public:
+    DeferredRecorder()
+        : thread_{[this] { run(); }}
+    {
+    }
+
+    DeferredRecorder(DeferredRecorder const &) = delete;
+    DeferredRecorder &operator=(DeferredRecorder const &) = delete;
+
+    ~DeferredRecorder()
+    {
+        {
+            std::lock_guard const lock{mutex_};
+            done_ = true;
+        }
+        work_cv_.notify_one();
+        thread_.join();
+    }
+
+    void submit(std::function<void()> fn)
+    {
+        {
+            std::lock_guard const lock{mutex_};
+            queue_.push_back(std::move(fn));
+        }
+        work_cv_.notify_one();
+    }
+
+    void flush()
+    {
+        std::unique_lock lock{mutex_};
+        idle_cv_.wait(lock, [this] { return queue_.empty() && !busy_; });
+    }
+};
+
+ExecutionEventRecorder::ExecutionEventRecorder() noexcept
+    : EventRecorder{}
+    , cur_block_start_seqno_{0}
+    , reader_ring_fd_{-1}
+    , recording_{true}
+{
+}
+
+ExecutionEventRecorder::ExecutionEventRecorder(
+    ExecutionEventRecorder &&) noexcept = default;
+
+ExecutionEventRecorder &
+ExecutionEventRecorder::operator=(ExecutionEventRecorder &&) noexcept = default;
+
+ExecutionEventRecorder::~ExecutionEventRecorder() = default;
+
+void ExecutionEventRecorder::require_attached_reader(int const ring_fd)
+{
+    reader_ring_fd_ = ring_fd;
+    (void)update_recording_state();
+}
+
+bool ExecutionEventRecorder::update_recording_state()
+{
+    if (reader_ring_fd_ == -1) {
+        return recording_;
+    }
+    bool has_readers;
+    if (monad_event_ring_query_readers(reader_ring_fd_, &has_readers) != 0) {
+        LOG_WARNING(
+            "cannot query event ring readers, recording anyway -- {}",
+            monad_event_ring_get_last_error());
+        has_readers = true;
+    }
+    if (has_readers != recording_) {
+        LOG_INFO(
+            "execution event recording {}",
+            has_readers ? "resumed, reader attached"
+                        : "suspended, no reader attached");
+        recording_ = has_readers;
+    }
+    return recording_;
+}
+
+void ExecutionEventRecorder::start_deferred_recording()
+{
+    MONAD_ASSERT(!deferred_);
+    deferred_ = std::make_unique<DeferredRecorder>();
+}
+
+void ExecutionEventRecorder::defer(std::function<void()> fn)
+{
+    if (deferred_) {
+        deferred_->submit(std::move(fn));
+    }
+    else {
+        fn();
+    }
+}
+
+void ExecutionEventRecorder::flush_deferred()
+{
+    if (deferred_) {
+        deferred_->flush();
+    }
+}
+
+MONAD_NAMESPACE_END
@@ -33,6 +33,8 @@
 #include <cstdint>
 #include <cstring>
 #include <expected>
+#include <functional>
+#include <memory>
 #include <span>
 #include <system_error>
 #include <utility>
@@ -48,10 +50,12 @@ class ExecutionEventRecorder : private EventRecorder
 public:
     // Not copyable because of the stateful tracking of the current block number
     ExecutionEventRecorder(ExecutionEventRecorder const &) = delete;
-    ExecutionEventRecorder(ExecutionEventRecorder &&) = default;
+    ExecutionEventRecorder(ExecutionEventRecorder &&) noexcept;
 
     ExecutionEventRecorder &operator=(ExecutionEventRecorder const &) = delete;
-    ExecutionEventRecorder &operator=(ExecutionEventRecorder &&) = default;
+    ExecutionEventRecorder &operator=(ExecutionEventRecorder &&) noexcept;
+
+    ~ExecutionEventRecorder();
 
     static std::expected<ExecutionEventRecorder, std::errc>
     from_event_ring(monad_event_ring const *const ring)
@@ -93,19 +97,59 @@ public:
     /// event location, e.g., in a related data stream
     uint64_t record_block_marker_event(monad_exec_event_type);
 
-    /// Record a transaction-level event with no payload in one step
-    uint64_t record_txn_marker_event(monad_exec_event_type, uint32_t txn_num);
+    /// Record a transaction-level event with no payload in one step; a
+    /// non-zero `epoch_nanos` replaces the recording timestamp, for markers
+    /// whose recording was deferred
+    uint64_t record_txn_marker_event(
+        monad_exec_event_type, uint32_t txn_num, uint64_t epoch_nanos = 0);
 
     using EventRecorder::commit;
 
-private:
-    uint64_t cur_block_start_seqno_;
+    /// Only record block and transaction events while some reader is
+    /// attached to the event ring file open on `ring_fd` (see
+    /// monad_event_ring_attach_reader); reader presence is re-checked at the
+    /// start of every block, so that a block's events are either all recorded
+    /// or all skipped. Consensus events (QC, finalized, verified) are small
+    /// and arrive outside the block that carries them, so they are always
+    /// recorded; a reader attaching later still learns every block's fate
+    void require_attached_reader(int ring_fd);
+
+    /// Called at block start; re-checks reader presence if required, and
+    /// returns whether events are recorded for the upcoming block
+    bool update_recording_state();
+
+    /// False when recording is suspended because no reader is attached
+    bool is_recording() const noexcept
+    {
+        return recording_;
+    }
+
+    /// Start a dedicated thread that records transaction output events on
+    /// behalf of the executing fibers, in the order they were deferred
+    void start_deferred_recording();
 
-    ExecutionEventRecorder() noexcept
-        : EventRecorder{}
-        , cur_block_start_seqno_{0}
+    /// True if start_deferred_recording was called
+    bool is_deferring() const noexcept
     {
+        return deferred_ != nullptr;
     }
+
+    /// Run `fn` on the recording thread if one was started, otherwise run it
+    /// immediately on the calling thread
+    void defer(std::function<void()> fn);
+
+    /// Wait until all deferred recording work has completed
+    void flush_deferred();
+
+private:
+    class DeferredRecorder;
+
+    uint64_t cur_block_start_seqno_;
+    int reader_ring_fd_;
+    bool recording_;
+    std::unique_ptr<DeferredRecorder> deferred_;
+
+    ExecutionEventRecorder() noexcept;
 };
 
 inline ReservedEvent<monad_exec_block_start>
@@ -181,7 +225,8 @@ inline uint64_t ExecutionEventRecorder::record_block_marker_event(
 }
 
 inline uint64_t ExecutionEventRecorder::record_txn_marker_event(
-    monad_exec_event_type const event_type, uint32_t const txn_num)
+    monad_exec_event_type const event_type, uint32_t const txn_num,
+    uint64_t const epoch_nanos)
 {
     uint64_t seqno;
     uint8_t *payload_buf;
@@ -191,6 +236,9 @@ inline uint64_t ExecutionEventRecorder::record_txn_marker_event(
     event->content_ext[MONAD_FLOW_BLOCK_SEQNO] = cur_block_start_seqno_;
     event->content_ext[MONAD_FLOW_TXN_ID] = txn_num + 1;
     event->content_ext[MONAD_FLOW_ACCOUNT_INDEX] = 0;
+    if (epoch_nanos != 0) {
+        event->record_epoch_nanos = epoch_nanos;
+    }
     monad_event_recorder_commit(event, seqno);
     return seqno;
 }
@@ -199,11 +247,18 @@ inline uint64_t ExecutionEventRecorder::record_txn_marker_event(
  * Helper free functions for execution event recording
  */
 
+/// True if block and transaction events should be recorded, i.e., there is a
+/// recorder and it is not suspended for lack of readers
+inline bool should_record(ExecutionEventRecorder const *const exec_recorder)
+{
+    return exec_recorder != nullptr && exec_recorder->is_recording();
+}
+
 inline uint64_t record_block_marker_event(
     ExecutionEventRecorder *const exec_recorder,
     monad_exec_event_type const event_type)
 {
-    if (exec_recorder != nullptr) {
+    if (should_record(exec_recorder)) {
         return exec_recorder->record_block_marker_event(event_type);
     }
     return 0;
@@ -213,7 +268,7 @@ inline uint64_t record_txn_marker_event(
     ExecutionEventRecorder *const exec_recorder,
     monad_exec_event_type const event_type, uint32_t const txn_num)
 {
-    if (exec_recorder != nullptr) {
+    if (should_record(exec_recorder)) {
         return exec_recorder->record_txn_marker_event(event_type, txn_num);
     }
     return 0;
@@ -21,13 +21,22 @@
 #include <category/execution/ethereum/event/exec_event_recorder.hpp>
 #include <category/execution/ethereum/event/record_block_events.hpp>
 #include <category/execution/ethereum/validate_block.hpp>
+#include <category/vm/contract_profiler.hpp>
 
 #include <bit>
+#include <cstdint>
 #include <cstring>
 #include <optional>
 
 MONAD_NAMESPACE_BEGIN
 
+static_assert(
+    static_cast<uint8_t>(vm::ContractProfiler::Entrypoint::Interpreter) ==
+    MONAD_VM_ENTRYPOINT_INTERPRETER);
+static_assert(
+    static_cast<uint8_t>(vm::ContractProfiler::Entrypoint::Native) ==
+    MONAD_VM_ENTRYPOINT_NATIVE);
+
 void record_block_start(
     ExecutionEventRecorder *const exec_recorder, bytes32_t const &bft_block_id,
     uint256_t const &chain_id, BlockHeader const &eth_block_header,
@@ -37,7 +46,9 @@ void record_block_start(
     std::optional<monad_c_secp256k1_pubkey> const &opt_block_author,
     std::optional<monad_c_native_block_input> const &opt_monad_input)
 {
-    if (exec_recorder == nullptr) {
+    // Block start is where recording is suspended or resumed, depending on
+    // whether a reader is attached, so that no block is recorded partially
+    if (exec_recorder == nullptr || !exec_recorder->update_recording_state()) {
         return;
     }
 
@@ -78,10 +89,42 @@ void record_block_start(
     exec_recorder->commit(block_start);
 }
 
+void record_block_contract_profile(
+    ExecutionEventRecorder *const exec_recorder,
+    vm::ContractProfiler &profiler)
+{
+    uint32_t const sample_period = profiler.sample_period();
+    if (sample_period == 0) {
+        return;
+    }
+    // Drain even when not recording, so that samples never carry over into
+    // the profile of a later block
+    auto const entries = profiler.drain();
+    if (!should_record(exec_recorder)) {
+        return;
+    }
+    for (vm::ContractProfiler::Entry const &entry : entries) {
+        ReservedEvent const contract_profile =
+            exec_recorder
+                ->reserve_block_event<monad_exec_block_contract_profile>(
+                    MONAD_EXEC_BLOCK_CONTRACT_PROFILE);
+        *contract_profile.payload = monad_exec_block_contract_profile{
+            .code_hash = entry.code_hash,
+            .entrypoint =
+                static_cast<monad_exec_vm_entrypoint>(entry.entrypoint),
+            .sample_period = sample_period,
+            .sample_count = entry.totals.sample_count,
+            .wall_nanos = entry.totals.wall_nanos,
+            .gas_used = entry.totals.gas_used,
+            .storage_reads = entry.totals.storage_reads};
+        exec_recorder->commit(contract_profile);
+    }
+}
+
 Result<BlockExecOutput> record_block_result(
     ExecutionEventRecorder *const exec_recorder, Result<BlockExecOutput> result)
 {
-    if (exec_recorder == nullptr) {
+    if (!should_record(exec_recorder)) {
         return result;
     }
 
@@ -27,6 +27,11 @@
 struct monad_c_secp256k1_pubkey;
 struct monad_c_native_block_input;
 
+namespace monad::vm
+{
+    class ContractProfiler;
+}
+
 MONAD_NAMESPACE_BEGIN
 
 class ExecutionEventRecorder;
@@ -48,6 +53,12 @@ void record_block_start(
     std::optional<monad_c_secp256k1_pubkey> const &,
     std::optional<monad_c_native_block_input> const &);
 
+/// Record a BLOCK_CONTRACT_PROFILE event for each contract sampled by the
+/// VM's profiler since the last call, then reset the profile; this is a
+/// no-op when sampling is disabled
+void record_block_contract_profile(
+    ExecutionEventRecorder *, vm::ContractProfiler &);
+
 /// Record block execution output events (or an execution error event, if
 /// Result::has_error() is true); also clears the active block flow ID
 Result<BlockExecOutput>
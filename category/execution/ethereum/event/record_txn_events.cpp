@@ -17,6 +17,7 @@
 #include <category/core/assert.h>
 #include <category/core/bytes.hpp>
 #include <category/core/config.hpp>
+#include <category/core/event/event_recorder.h>
 #include <category/core/int.hpp>
 #include <category/core/keccak.hpp>
 #include <category/core/result.hpp>
@@ -290,6 +291,80 @@ void record_account_access_events_internal(
     }
 }
 
+// Records everything from TXN_EVM_OUTPUT up to and including TXN_END; this
+// runs either on the executing fiber or on the deferred recording thread
+void record_txn_output_events_internal(
+    ExecutionEventRecorder *const exec_recorder, uint32_t const txn_num,
+    Receipt const &receipt, std::span<CallFrame const> const call_frames,
+    State const &txn_state)
+{
+    // TXN_EVM_OUTPUT
+    ReservedEvent const txn_evm_output =
+        exec_recorder->reserve_txn_event<monad_exec_txn_evm_output>(
+            MONAD_EXEC_TXN_EVM_OUTPUT, txn_num);
+    *txn_evm_output.payload = monad_exec_txn_evm_output{
+        .receipt =
+            {.status = receipt.status == 1,
+             .log_count = static_cast<uint32_t>(receipt.logs.size()),
+             .gas_used = receipt.gas_used},
+        .call_frame_count = static_cast<uint32_t>(call_frames.size())};
+    exec_recorder->commit(txn_evm_output);
+
+    // TXN_LOG
+    for (uint32_t index = 0; auto const &log : receipt.logs) {
+        ReservedEvent const txn_log =
+            exec_recorder->reserve_txn_event<monad_exec_txn_log>(
+                MONAD_EXEC_TXN_LOG,
+                txn_num,
+                as_bytes(std::span{log.topics}),
+                as_bytes(std::span{log.data}));
+        *txn_log.payload = monad_exec_txn_log{
+            .index = index,
+            .address = log.address,
+            .topic_count = static_cast<uint8_t>(log.topics.size()),
+            .data_length = static_cast<uint32_t>(log.data.size())};
+        exec_recorder->commit(txn_log);
+        ++index;
+    }
+
+    // TXN_CALL_FRAME
+    for (uint32_t index = 0; auto const &call_frame : call_frames) {
+        std::span const input_bytes{
+            call_frame.input.data(), call_frame.input.size()};
+        std::span const return_bytes{
+            call_frame.output.data(), call_frame.output.size()};
+
+        ReservedEvent const txn_call_frame =
+            exec_recorder->reserve_txn_event<monad_exec_txn_call_frame>(
+                MONAD_EXEC_TXN_CALL_FRAME,
+                txn_num,
+                as_bytes(input_bytes),
+                as_bytes(return_bytes));
+        *txn_call_frame.payload = monad_exec_txn_call_frame{
+            .index = index,
+            .caller = call_frame.from,
+            .call_target = call_frame.to.value_or(Address{}),
+            .opcode = std::to_underlying(
+                get_call_frame_opcode(call_frame.type, call_frame.flags)),
+            .value = call_frame.value,
+            .gas = call_frame.gas,
+            .gas_used = call_frame.gas_used,
+            .evmc_status = std::to_underlying(call_frame.status),
+            .depth = call_frame.depth,
+            .input_length = call_frame.input.size(),
+            .return_length = call_frame.output.size(),
+        };
+        exec_recorder->commit(txn_call_frame);
+        ++index;
+    }
+
+    // Account access records for the transaction
+    record_account_access_events_internal(
+        exec_recorder, MONAD_ACCT_ACCESS_TRANSACTION, txn_num, txn_state);
+
+    exec_recorder->record_txn_marker_event(MONAD_EXEC_TXN_END, txn_num);
+}
+
 MONAD_ANONYMOUS_NAMESPACE_END
 
 MONAD_NAMESPACE_BEGIN
@@ -299,7 +374,7 @@ void record_txn_header_events(
     Transaction const &transaction, Address const &sender,
     std::span<std::optional<Address> const> const authorities)
 {
-    if (exec_recorder == nullptr) {
+    if (!should_record(exec_recorder)) {
         return;
     }
 
@@ -359,84 +434,30 @@ void record_txn_header_events(
 void record_txn_output_events(
     ExecutionEventRecorder *const exec_recorder, uint32_t const txn_num,
     Receipt const &receipt, std::span<CallFrame const> const call_frames,
-    State const &txn_state)
+    std::shared_ptr<State const> txn_state)
 {
-    if (exec_recorder == nullptr) {
+    if (!should_record(exec_recorder)) {
         return;
     }
-
-    // TXN_EVM_OUTPUT
-    ReservedEvent const txn_evm_output =
-        exec_recorder->reserve_txn_event<monad_exec_txn_evm_output>(
-            MONAD_EXEC_TXN_EVM_OUTPUT, txn_num);
-    *txn_evm_output.payload = monad_exec_txn_evm_output{
-        .receipt =
-            {.status = receipt.status == 1,
-             .log_count = static_cast<uint32_t>(receipt.logs.size()),
-             .gas_used = receipt.gas_used},
-        .call_frame_count = static_cast<uint32_t>(call_frames.size())};
-    exec_recorder->commit(txn_evm_output);
-
-    // TXN_LOG
-    for (uint32_t index = 0; auto const &log : receipt.logs) {
-        ReservedEvent const txn_log =
-            exec_recorder->reserve_txn_event<monad_exec_txn_log>(
-                MONAD_EXEC_TXN_LOG,
-                txn_num,
-                as_bytes(std::span{log.topics}),
-                as_bytes(std::span{log.data}));
-        *txn_log.payload = monad_exec_txn_log{
-            .index = index,
-            .address = log.address,
-            .topic_count = static_cast<uint8_t>(log.topics.size()),
-            .data_length = static_cast<uint32_t>(log.data.size())};
-        exec_recorder->commit(txn_log);
-        ++index;
-    }
-
-    // TXN_CALL_FRAME
-    for (uint32_t index = 0; auto const &call_frame : call_frames) {
-        std::span const input_bytes{
-            call_frame.input.data(), call_frame.input.size()};
-        std::span const return_bytes{
-            call_frame.output.data(), call_frame.output.size()};
-
-        ReservedEvent const txn_call_frame =
-            exec_recorder->reserve_txn_event<monad_exec_txn_call_frame>(
-                MONAD_EXEC_TXN_CALL_FRAME,
-                txn_num,
-                as_bytes(input_bytes),
-                as_bytes(return_bytes));
-        *txn_call_frame.payload = monad_exec_txn_call_frame{
-            .index = index,
-            .caller = call_frame.from,
-            .call_target = call_frame.to.value_or(Address{}),
-            .opcode = std::to_underlying(
-                get_call_frame_opcode(call_frame.type, call_frame.flags)),
-            .value = call_frame.value,
-            .gas = call_frame.gas,
-            .gas_used = call_frame.gas_used,
-            .evmc_status = std::to_underlying(call_frame.status),
-            .depth = call_frame.depth,
-            .input_length = call_frame.input.size(),
-            .return_length = call_frame.output.size(),
-        };
-        exec_recorder->commit(txn_call_frame);
-        ++index;
+    if (!exec_recorder->is_deferring()) {
+        return record_txn_output_events_internal(
+            exec_recorder, txn_num, receipt, call_frames, *txn_state);
     }
-
-    // Account access records for the transaction
-    record_account_access_events_internal(
-        exec_recorder, MONAD_ACCT_ACCESS_TRANSACTION, txn_num, txn_state);
-
-    exec_recorder->record_txn_marker_event(MONAD_EXEC_TXN_END, txn_num);
+    exec_recorder->defer([exec_recorder,
+                          txn_num,
+                          receipt,
+                          call_frames,
+                          txn_state = std::move(txn_state)] {
+        record_txn_output_events_internal(
+            exec_recorder, txn_num, receipt, call_frames, *txn_state);
+    });
 }
 
 void record_txn_error_event(
     ExecutionEventRecorder *const exec_recorder, uint32_t const txn_num,
     Result<Receipt>::error_type const &txn_error)
 {
-    if (exec_recorder == nullptr) {
+    if (!should_record(exec_recorder)) {
         return;
     }
 
@@ -444,27 +465,45 @@ void record_txn_error_event(
     // `ref_txn_error.domain()`, for the purpose of checking if the
     // r.error() domain is a TransactionError. We record these as
     // TXN_REJECT events (invalid transactions) vs. all other cases
-    // which are internal EVM errors (EVM_ERROR)
+    // which are internal EVM errors (EVM_ERROR). The error itself is not
+    // copyable, so everything we need is extracted here, before deferring
     static Result<Receipt>::error_type const ref_txn_error =
         TransactionError::InsufficientBalance;
     static auto const &txn_err_domain = ref_txn_error.domain();
     auto const &error_domain = txn_error.domain();
+    bool const is_txn_error = error_domain == txn_err_domain;
+    uint64_t const domain_id = error_domain.id();
     auto const error_value = txn_error.value();
-    if (error_domain == txn_err_domain) {
-        ReservedEvent const txn_reject =
-            exec_recorder->reserve_txn_event<monad_exec_txn_reject>(
-                MONAD_EXEC_TXN_REJECT, txn_num);
-        *txn_reject.payload = static_cast<uint32_t>(error_value);
-        exec_recorder->commit(txn_reject);
-    }
-    else {
-        ReservedEvent const evm_error =
-            exec_recorder->reserve_txn_event<monad_exec_evm_error>(
-                MONAD_EXEC_EVM_ERROR, txn_num);
-        *evm_error.payload = monad_exec_evm_error{
-            .domain_id = error_domain.id(), .status_code = error_value};
-        exec_recorder->commit(evm_error);
+    exec_recorder->defer([=] {
+        if (is_txn_error) {
+            ReservedEvent const txn_reject =
+                exec_recorder->reserve_txn_event<monad_exec_txn_reject>(
+                    MONAD_EXEC_TXN_REJECT, txn_num);
+            *txn_reject.payload = static_cast<uint32_t>(error_value);
+            exec_recorder->commit(txn_reject);
+        }
+        else {
+            ReservedEvent const evm_error =
+                exec_recorder->reserve_txn_event<monad_exec_evm_error>(
+                    MONAD_EXEC_EVM_ERROR, txn_num);
+            *evm_error.payload = monad_exec_evm_error{
+                .domain_id = domain_id, .status_code = error_value};
+            exec_recorder->commit(evm_error);
+        }
+    });
+}
+
+void record_txn_exit_event(
+    ExecutionEventRecorder *const exec_recorder, uint32_t const txn_num)
+{
+    if (!should_record(exec_recorder)) {
+        return;
     }
+    uint64_t const exit_epoch_nanos = monad_event_get_epoch_nanos();
+    exec_recorder->defer([=] {
+        exec_recorder->record_txn_marker_event(
+            MONAD_EXEC_TXN_PERF_EVM_EXIT, txn_num, exit_epoch_nanos);
+    });
 }
 
 // The externally-visible wrapper of the account-access-recording function that
@@ -474,7 +513,7 @@ void record_account_access_events(
     ExecutionEventRecorder *const exec_recorder,
     monad_exec_account_access_context const ctx, State const &state)
 {
-    if (exec_recorder != nullptr) {
+    if (should_record(exec_recorder)) {
         return record_account_access_events_internal(
             exec_recorder, ctx, std::nullopt, state);
     }
@@ -20,6 +20,7 @@
 #include <category/core/result.hpp>
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <span>
 
@@ -41,10 +42,13 @@ void record_txn_header_events(
     Address const &sender, std::span<std::optional<Address> const> authorities);
 
 /// Record TXN_EVM_OUTPUT, and all subsequent execution output events
-/// (TXN_LOG, TXN_CALL_FRAME, etc.)
+/// (TXN_LOG, TXN_CALL_FRAME, etc.); this takes shared ownership of the
+/// transaction's already-merged state, so that if the recorder is deferring,
+/// the events can be recorded later on its recording thread. In that case the
+/// call frames must outlive the next ExecutionEventRecorder::flush_deferred
 void record_txn_output_events(
     ExecutionEventRecorder *, uint32_t txn_num, Receipt const &,
-    std::span<CallFrame const>, State const &);
+    std::span<CallFrame const>, std::shared_ptr<State const>);
 
 /// Record TXN_REJECT or EVM_ERROR events depending on what happened during
 /// transaction execution
@@ -52,6 +56,10 @@ void record_txn_error_event(
     ExecutionEventRecorder *, uint32_t txn_num,
     Result<Receipt>::error_type const &);
 
+/// Record TXN_PERF_EVM_EXIT; this is deferred like the output events so that
+/// it stays ordered after them, but keeps the timestamp of the actual exit
+void record_txn_exit_event(ExecutionEventRecorder *, uint32_t txn_num);
+
 /// Record all account state accesses (both reads and writes) described by a
 /// State object
 void record_account_access_events(
@@ -53,6 +53,7 @@ EvmcHostBase::EvmcHostBase(
 evmc::bytes32 EvmcHostBase::get_storage(
     evmc::address const &address, evmc::bytes32 const &key) const noexcept
 {
+    count_storage_read();
     MONAD_TRY
     {
         return state_.get_storage(address, key);
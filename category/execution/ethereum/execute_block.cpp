@@ -31,9 +31,11 @@
 #include <category/execution/ethereum/core/receipt.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
 #include <category/execution/ethereum/core/withdrawal.hpp>
+#include <category/execution/ethereum/db/commit_builder.hpp>
 #include <category/execution/ethereum/dispatch_transaction.hpp>
 #include <category/execution/ethereum/event/exec_event_ctypes.h>
 #include <category/execution/ethereum/event/exec_event_recorder.hpp>
+#include <category/execution/ethereum/event/record_block_events.hpp>
 #include <category/execution/ethereum/event/record_txn_events.hpp>
 #include <category/execution/ethereum/execute_block.hpp>
 #include <category/execution/ethereum/execute_block_header.hpp>
@@ -91,6 +93,13 @@ MONAD_NAMESPACE_BEGIN
 std::vector<std::optional<Address>> recover_senders(
     std::span<Transaction const> const transactions,
     fiber::PriorityPool &priority_pool)
+{
+    return recover_senders(transactions, priority_pool.fiber_group(), 0);
+}
+
+std::vector<std::optional<Address>> recover_senders(
+    std::span<Transaction const> const transactions, fiber::FiberGroup &group,
+    uint64_t const priority_base)
 {
     std::vector<std::optional<Address>> senders{transactions.size()};
 
@@ -98,8 +107,8 @@ std::vector<std::optional<Address>> recover_senders(
         new boost::fibers::promise<void>[transactions.size()]};
 
     for (unsigned i = 0; i < transactions.size(); ++i) {
-        priority_pool.submit(
-            i,
+        group.submit(
+            priority_base + i,
             [i = i,
              promises = promises,
              &sender = senders[i],
@@ -119,6 +128,13 @@ std::vector<std::optional<Address>> recover_senders(
 std::vector<std::vector<std::optional<Address>>> recover_authorities(
     std::span<Transaction const> const transactions,
     fiber::PriorityPool &priority_pool)
+{
+    return recover_authorities(transactions, priority_pool.fiber_group(), 0);
+}
+
+std::vector<std::vector<std::optional<Address>>> recover_authorities(
+    std::span<Transaction const> const transactions, fiber::FiberGroup &group,
+    uint64_t const priority_base)
 {
     std::vector<std::vector<std::optional<Address>>> authorities{
         transactions.size()};
@@ -132,8 +148,8 @@ std::vector<std::vector<std::optional<Address>>> recover_authorities(
             new boost::fibers::promise<void>[authorities[i].size()]};
 
         for (auto j = 0u; j < authorities[i].size(); ++j) {
-            priority_pool.submit(
-                i,
+            group.submit(
+                priority_base + i,
                 [j = j,
                  auth_promises = promises[i],
                  &auth = authorities[i][j],
@@ -164,7 +180,8 @@ Result<std::vector<Receipt>> execute_block_transactions(
     std::span<std::unique_ptr<CallTracerBase>> const call_tracers,
     std::span<std::unique_ptr<trace::StateTracer>> const state_tracers,
     ChainContext<traits> const &chain_ctx,
-    ExecutionEventRecorder *const exec_recorder, bool const trace_transfers)
+    ExecutionEventRecorder *const exec_recorder, bool const trace_transfers,
+    std::vector<EncodedTransactionOutput> *const encoded_outputs)
 {
     MONAD_ASSERT(senders.size() == transactions.size());
     MONAD_ASSERT(senders.size() == call_tracers.size());
@@ -178,6 +195,22 @@ Result<std::vector<Receipt>> execute_block_transactions(
         new std::optional<Result<Receipt>>[transactions.size()]};
     size_t const txn_count = transactions.size();
 
+    // Running totals before each transaction. Entry i + 1 is written by
+    // transaction i before it signals promises[i + 1], and every transaction
+    // waits on its promise before merging, so a fiber can read its own entry
+    // as soon as dispatch returns
+    struct Totals
+    {
+        uint64_t gas_used;
+        size_t log_count;
+    };
+
+    std::shared_ptr<Totals[]> const totals{new Totals[txn_count + 1]{}};
+    if (encoded_outputs != nullptr) {
+        encoded_outputs->clear();
+        encoded_outputs->resize(txn_count);
+    }
+
     auto const tx_exec_begin = std::chrono::steady_clock::now();
     for (unsigned i = 0; i < txn_count; ++i) {
         priority_pool.submit(
@@ -186,6 +219,8 @@ Result<std::vector<Receipt>> execute_block_transactions(
              i = i,
              results = results,
              promises = promises,
+             totals = totals,
+             encoded_outputs = encoded_outputs,
              &transaction = transactions[i],
              &sender = senders[i],
              &authorities = authorities[i],
@@ -220,9 +255,25 @@ Result<std::vector<Receipt>> execute_block_transactions(
                     if (results[i]->has_error()) {
                         record_txn_error_event(
                             exec_recorder, i, results[i]->error());
+                        totals[i + 1] = totals[i];
                     }
-                    record_txn_marker_event(
-                        exec_recorder, MONAD_EXEC_TXN_PERF_EVM_EXIT, i);
+                    else {
+                        // YP eq. 22
+                        auto &receipt = results[i]->value();
+                        receipt.gas_used += totals[i].gas_used;
+                        totals[i + 1] = Totals{
+                            .gas_used = receipt.gas_used,
+                            .log_count =
+                                totals[i].log_count + receipt.logs.size()};
+                        if (encoded_outputs != nullptr) {
+                            (*encoded_outputs)[i] = encode_transaction_output(
+                                receipt,
+                                totals[i].log_count,
+                                transaction,
+                                sender);
+                        }
+                    }
+                    record_txn_exit_event(exec_recorder, i);
                     // Call promise.set_value/set_exception the last thing,
                     // because this signals that the transaction is finished.
                     promises[i + 1].set_value();
@@ -234,10 +285,18 @@ Result<std::vector<Receipt>> execute_block_transactions(
     }
 
     auto const last = static_cast<ptrdiff_t>(transactions.size());
-    promises[last].get_future().get();
+    auto last_future = promises[last].get_future();
+    last_future.wait();
     block_metrics.tx_exec_time =
         std::chrono::duration_cast<std::chrono::microseconds>(
             std::chrono::steady_clock::now() - tx_exec_begin);
+    // Transaction output events may still be queued on the recording thread;
+    // they reference the call tracers, and must precede any block-level
+    // events recorded after this returns
+    if (exec_recorder != nullptr) {
+        exec_recorder->flush_deferred();
+    }
+    last_future.get();
 
     std::vector<Receipt> retvals;
     for (unsigned i = 0; i < transactions.size(); ++i) {
@@ -254,13 +313,6 @@ Result<std::vector<Receipt>> execute_block_transactions(
         retvals.push_back(std::move(retval));
     }
 
-    // YP eq. 22
-    uint64_t cumulative_gas_used = 0;
-    for (auto &receipt : retvals) {
-        cumulative_gas_used += receipt.gas_used;
-        receipt.gas_used = cumulative_gas_used;
-    }
-
     return retvals;
 }
 
@@ -275,7 +327,8 @@ Result<std::vector<Receipt>> execute_block(
     std::span<std::unique_ptr<trace::StateTracer>> const state_tracers,
     trace::StateTracer &system_call_state_tracer,
     ChainContext<traits> const &chain_ctx,
-    ExecutionEventRecorder *const exec_recorder, bool const trace_transfers)
+    ExecutionEventRecorder *const exec_recorder, bool const trace_transfers,
+    std::vector<EncodedTransactionOutput> *const encoded_outputs)
 {
     static_assert(traits::evm_rev() >= MONAD_ETH_SPURIOUS_DRAGON);
 
@@ -303,7 +356,8 @@ Result<std::vector<Receipt>> execute_block(
             state_tracers,
             chain_ctx,
             exec_recorder,
-            trace_transfers));
+            trace_transfers,
+            encoded_outputs));
 
     State state{
         block_state, Incarnation{block.header.number, Incarnation::LAST_TX}};
@@ -345,6 +399,8 @@ Result<std::vector<Receipt>> execute_block(
     block_state.merge(state);
     record_account_access_events(
         exec_recorder, MONAD_ACCT_ACCESS_BLOCK_EPILOGUE, state);
+    record_block_contract_profile(
+        exec_recorder, block_state.vm().contract_profiler());
 
     return retvals;
 }
@@ -27,6 +27,7 @@
 
 #include <evmc/evmc.h>
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <span>
@@ -40,6 +41,7 @@ class ExecutionEventRecorder;
 class State;
 struct Block;
 struct Chain;
+struct EncodedTransactionOutput;
 
 namespace fiber
 {
@@ -56,8 +58,12 @@ Result<std::vector<Receipt>> execute_block_transactions(
     std::span<std::unique_ptr<CallTracerBase>>,
     std::span<std::unique_ptr<trace::StateTracer>> state_tracers,
     ChainContext<traits> const &chain_ctx, ExecutionEventRecorder *,
-    bool trace_transfers = false);
+    bool trace_transfers = false,
+    std::vector<EncodedTransactionOutput> *encoded_outputs = nullptr);
 
+// When `encoded_outputs` is given, each transaction fiber also encodes its
+// receipt and transaction trie leaves right after merging (see
+// CommitBuilder::add_transaction_outputs)
 template <Traits traits>
 Result<std::vector<Receipt>> execute_block(
     Chain const &, Block const &, std::span<Address const> senders,
@@ -67,7 +73,8 @@ Result<std::vector<Receipt>> execute_block(
     std::span<std::unique_ptr<trace::StateTracer>> state_tracers,
     trace::StateTracer &system_call_state_tracer,
     ChainContext<traits> const &chain_ctx, ExecutionEventRecorder *,
-    bool trace_transfers = false);
+    bool trace_transfers = false,
+    std::vector<EncodedTransactionOutput> *encoded_outputs = nullptr);
 
 std::vector<std::optional<Address>>
 recover_senders(std::span<Transaction const>, fiber::PriorityPool &);
@@ -75,4 +82,18 @@ recover_senders(std::span<Transaction const>, fiber::PriorityPool &);
 std::vector<std::vector<std::optional<Address>>>
 recover_authorities(std::span<Transaction const>, fiber::PriorityPool &);
 
+// Recover on `group`, transaction i at priority `priority_base + i`. A
+// group starts its tasks in submission order whatever their priority, so
+// the priority only orders ready fibers across the groups sharing a
+// thread pool: recovery on a group of its own with a high base gets the
+// threads that fibers of other groups leave idle, it does not wait for
+// those groups to drain
+std::vector<std::optional<Address>> recover_senders(
+    std::span<Transaction const>, fiber::FiberGroup &,
+    uint64_t priority_base);
+
+std::vector<std::vector<std::optional<Address>>> recover_authorities(
+    std::span<Transaction const>, fiber::FiberGroup &,
+    uint64_t priority_base);
+
 MONAD_NAMESPACE_END
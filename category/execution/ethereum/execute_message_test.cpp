@@ -1374,6 +1374,95 @@ TYPED_TEST(TraitsTest, cold_account_access)
     EXPECT_EQ(gas_used, balance_gas + 3); // +3 for PUSH20
 }
 
+// A cold SLOAD that cannot pay for the cold access runs out of gas before the
+// host reads the slot
+TYPED_TEST(TraitsTest, cold_storage_load_out_of_gas)
+{
+    static_assert(TestFixture::Trait::evm_rev() >= MONAD_ETH_BERLIN);
+
+    mpt::Db db{std::make_unique<InMemoryMachine>()};
+    db_t tdb{db};
+    vm::VM vm;
+    BlockState bs{tdb, vm};
+    State s{bs, Incarnation{0, 0}};
+
+    static constexpr auto from{
+        0x00000000000000000000000000000000bbbbbbbb_address};
+
+    static constexpr auto contract{
+        0x00000000000000000000000000000000cccccccc_address};
+
+    // PUSH1 1; SLOAD; STOP
+    auto const code = from_hex("0x60015400").value();
+    auto const icode = vm::make_shared_intercode(code);
+    auto const code_hash = to_bytes(keccak256(code));
+
+    commit_sequential(
+        tdb,
+        StateDeltas(
+            {{from,
+              StateDelta{
+                  .account =
+                      {std::nullopt,
+                       Account{
+                           .balance = 10'000'000'000,
+                       }}}},
+             {contract,
+              StateDelta{
+                  .account =
+                      {std::nullopt,
+                       Account{
+                           .code_hash = code_hash,
+                       }}}}}),
+        Code{
+            {code_hash, icode},
+        },
+        BlockHeader{});
+
+    BlockHashBufferFinalized const block_hash_buffer;
+    NoopCallTracer call_tracer;
+    Transaction tx{};
+    auto const chain_ctx =
+        ChainContext<typename TestFixture::Trait>::debug_empty();
+    uint256_t base_fee{0};
+    trace::StateTracer noop_state_tracer = std::monostate{};
+    EvmcHost<typename TestFixture::Trait> h{
+        call_tracer,
+        noop_state_tracer,
+        EMPTY_TX_CONTEXT,
+        block_hash_buffer,
+        s,
+        tx,
+        base_fee,
+        0,
+        chain_ctx};
+    init_rb_for_test<typename TestFixture::Trait>(s, h, Address{from});
+
+    auto const call = [&](int64_t const gas) {
+        auto msg_memory = vm.message_memory_ref();
+        evmc_message const m{
+            .kind = EVMC_CALL,
+            .gas = gas,
+            .recipient = contract,
+            .sender = from,
+            .code_address = contract,
+            .memory_handle = msg_memory.get(),
+            .memory = msg_memory.get(),
+            .memory_capacity = vm.message_memory_capacity(),
+        };
+        return h.call(m).status_code;
+    };
+
+    // Enough for PUSH1 and the warm part of SLOAD, not the cold surcharge
+    EXPECT_EQ(
+        call(TestFixture::Trait::cold_storage_cost()), EVMC_OUT_OF_GAS);
+    EXPECT_EQ(h.storage_read_count(), 0u);
+
+    // With enough gas the same load reaches the host
+    EXPECT_EQ(call(1'000'000), EVMC_SUCCESS);
+    EXPECT_EQ(h.storage_read_count(), 1u);
+}
+
 TYPED_TEST(TraitsTest, defensive_delegation_check)
 {
     mpt::Db db{std::make_unique<InMemoryMachine>()};
@@ -423,12 +423,6 @@ Receipt ExecuteTransaction<traits>::execute_final(
 
     call_tracer_.on_finish(receipt.gas_used);
     trace::run_tracer<traits>(state_tracer_, state);
-    record_txn_output_events(
-        exec_recorder_,
-        static_cast<uint32_t>(this->i_),
-        receipt,
-        call_tracer_.get_call_frames(),
-        state);
 
     return receipt;
 }
@@ -454,25 +448,32 @@ Result<Receipt> ExecuteTransaction<traits>::operator()()
     {
         TRACE_TXN_EVENT(StartExecution);
 
-        State state{block_state_, Incarnation{header_.number, i_ + 1}};
-        state.set_original_nonce(sender_, tx_.nonce);
+        auto state = std::make_shared<State>(
+            block_state_, Incarnation{header_.number, i_ + 1});
+        state->set_original_nonce(sender_, tx_.nonce);
 
         call_tracer_.reset();
         trace::reset(state_tracer_);
 
-        auto result = execute_impl2(state);
+        auto result = execute_impl2(*state);
 
         {
             TRACE_TXN_EVENT(StartStall);
             prev_.get_future().wait();
         }
 
-        if (block_state_.can_merge(state)) {
+        if (block_state_.can_merge(*state)) {
             if (result.has_error()) {
                 return std::move(result.error());
             }
-            auto const receipt = execute_final(state, result.value());
-            block_state_.merge(state);
+            auto const receipt = execute_final(*state, result.value());
+            block_state_.merge(*state);
+            record_txn_output_events(
+                exec_recorder_,
+                static_cast<uint32_t>(i_),
+                receipt,
+                call_tracer_.get_call_frames(),
+                std::move(state));
             return receipt;
         }
     }
@@ -480,19 +481,26 @@ Result<Receipt> ExecuteTransaction<traits>::operator()()
     {
         TRACE_TXN_EVENT(StartRetry);
 
-        State state{block_state_, Incarnation{header_.number, i_ + 1}};
+        auto state = std::make_shared<State>(
+            block_state_, Incarnation{header_.number, i_ + 1});
 
         call_tracer_.reset();
         trace::reset(state_tracer_);
 
-        auto result = execute_impl2(state);
+        auto result = execute_impl2(*state);
 
-        MONAD_ASSERT(block_state_.can_merge(state));
+        MONAD_ASSERT(block_state_.can_merge(*state));
         if (result.has_error()) {
             return std::move(result.error());
         }
-        auto const receipt = execute_final(state, result.value());
-        block_state_.merge(state);
+        auto const receipt = execute_final(*state, result.value());
+        block_state_.merge(*state);
+        record_txn_output_events(
+            exec_recorder_,
+            static_cast<uint32_t>(i_),
+            receipt,
+            call_tracer_.get_call_frames(),
+            std::move(state));
         return receipt;
     }
 }
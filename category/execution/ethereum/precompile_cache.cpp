@@ -0,0 +1,153 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/address.hpp>
+#include <category/core/assert.h>
+#include <category/core/byte_string.hpp>
+#include <category/core/bytes.hpp>
+#include <category/core/config.hpp>
+#include <category/execution/ethereum/precompile_cache.hpp>
+#include <category/execution/ethereum/precompiles.hpp>
+
+#include <blake3.h>
+
+#include <evmc/evmc.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <optional>
+#include <string>
+
+MONAD_NAMESPACE_BEGIN
+
+namespace
+{
+    std::unique_ptr<PrecompileCache> g_precompile_cache;
+}
+
+PrecompileCache::PrecompileCache(
+    size_t const max_entries, uint64_t const min_gas_cost)
+    : cache_{max_entries}
+    , min_gas_cost_{min_gas_cost}
+{
+    MONAD_ASSERT(max_entries > 0);
+}
+
+bytes32_t
+PrecompileCache::make_key(Address const &address, byte_string_view const input)
+{
+    bytes32_t key;
+    static_assert(sizeof(key.bytes) == BLAKE3_OUT_LEN);
+
+    blake3_hasher hasher;
+    blake3_hasher_init(&hasher);
+    blake3_hasher_update(&hasher, address.bytes, sizeof(address.bytes));
+    blake3_hasher_update(&hasher, input.data(), input.size());
+    blake3_hasher_finalize(&hasher, key.bytes, BLAKE3_OUT_LEN);
+    return key;
+}
+
+std::optional<PrecompileResult> PrecompileCache::find(bytes32_t const &key)
+{
+    Cache::ConstAccessor acc;
+    if (!cache_.find(acc, key)) {
+        n_miss_.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+    n_hit_.fetch_add(1, std::memory_order_relaxed);
+
+    CachedOutput const &cached = acc->second.value_;
+    uint8_t *obuf = nullptr;
+    if (!cached.output.empty()) {
+        obuf = static_cast<uint8_t *>(std::malloc(cached.output.size()));
+        MONAD_ASSERT(obuf != nullptr);
+        std::memcpy(obuf, cached.output.data(), cached.output.size());
+    }
+    return PrecompileResult{
+        .status_code = cached.status_code,
+        .obuf = obuf,
+        .output_size = cached.output.size(),
+    };
+}
+
+void PrecompileCache::insert(
+    bytes32_t const &key, PrecompileResult const &result)
+{
+    if (result.output_size > MAX_OUTPUT_SIZE) {
+        n_skip_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    cache_.insert(
+        key,
+        CachedOutput{
+            .status_code = result.status_code,
+            .output = byte_string{result.obuf, result.output_size},
+        });
+}
+
+PrecompileResult PrecompileCache::execute(
+    Address const &address, byte_string_view const input,
+    uint64_t const gas_cost, precompiled_execute_fn *const execute_func)
+{
+    if (!is_cacheable(gas_cost)) {
+        return execute_func(input);
+    }
+    bytes32_t const key = make_key(address, input);
+    if (auto const hit = find(key); hit.has_value()) {
+        return *hit;
+    }
+    PrecompileResult const result = execute_func(input);
+    insert(key, result);
+    return result;
+}
+
+std::string PrecompileCache::print_stats() const
+{
+    uint64_t const hits = n_hit_.load(std::memory_order_relaxed);
+    uint64_t const misses = n_miss_.load(std::memory_order_relaxed);
+    uint64_t const lookups = hits + misses;
+    return std::format(
+        "precompile cache: size={} hits={} misses={} skipped={} "
+        "hit_rate={:.2f}%",
+        cache_.size(),
+        hits,
+        misses,
+        n_skip_.load(std::memory_order_relaxed),
+        lookups ? 100.0 * static_cast<double>(hits) /
+                      static_cast<double>(lookups)
+                : 0.0);
+}
+
+void init_precompile_cache(size_t const max_entries, uint64_t const min_gas_cost)
+{
+    if (max_entries == 0) {
+        g_precompile_cache.reset();
+        return;
+    }
+    g_precompile_cache =
+        std::make_unique<PrecompileCache>(max_entries, min_gas_cost);
+}
+
+PrecompileCache *precompile_cache()
+{
+    return g_precompile_cache.get();
+}
+
+MONAD_NAMESPACE_END
@@ -0,0 +1,118 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <category/core/address.hpp>
+#include <category/core/byte_string.hpp>
+#include <category/core/bytes.hpp>
+#include <category/core/bytes_hash_compare.hpp>
+#include <category/core/config.hpp>
+#include <category/core/lru/lru_cache.hpp>
+#include <category/execution/ethereum/precompiles.hpp>
+
+#include <evmc/evmc.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+MONAD_NAMESPACE_BEGIN
+
+/// Bounded memoization of precompile outputs keyed by (precompile address,
+/// input hash). Precompile execution is a pure function of its input, so
+/// serving a cached output is indistinguishable from re-running it; gas is
+/// still charged by the caller on every call. Only calls whose gas cost is at
+/// least `min_gas_cost` are cached, so cheap precompiles never pay for the
+/// input hash.
+class PrecompileCache
+{
+    struct CachedOutput
+    {
+        evmc_status_code status_code;
+        byte_string output;
+    };
+
+    using Cache = LruCache<bytes32_t, CachedOutput, BytesHashCompare<bytes32_t>>;
+
+    Cache cache_;
+    uint64_t min_gas_cost_;
+    std::atomic<uint64_t> n_hit_{0};
+    std::atomic<uint64_t> n_miss_{0};
+    std::atomic<uint64_t> n_skip_{0};
+
+public:
+    static constexpr size_t DEFAULT_MAX_ENTRIES = 16'384;
+    static constexpr uint64_t DEFAULT_MIN_GAS_COST = 3'000;
+
+    // Large outputs (identity, expmod with huge moduli) are cheap relative to
+    // the copy and would let a single entry pin a lot of memory
+    static constexpr size_t MAX_OUTPUT_SIZE = 1024;
+
+    PrecompileCache(size_t max_entries, uint64_t min_gas_cost);
+
+    PrecompileCache(PrecompileCache const &) = delete;
+    PrecompileCache &operator=(PrecompileCache const &) = delete;
+
+    bool is_cacheable(uint64_t const gas_cost) const
+    {
+        return gas_cost >= min_gas_cost_;
+    }
+
+    static bytes32_t make_key(Address const &, byte_string_view input);
+
+    /// On a hit, returns a result whose output buffer is a fresh malloc(3)
+    /// copy, so it can be released by evmc_free_result_memory like any
+    /// freshly executed precompile result
+    std::optional<PrecompileResult> find(bytes32_t const &key);
+
+    void insert(bytes32_t const &key, PrecompileResult const &);
+
+    /// Execute through the cache: serves a hit or runs `execute` and
+    /// memoizes its output
+    PrecompileResult execute(
+        Address const &, byte_string_view input, uint64_t gas_cost,
+        precompiled_execute_fn *execute_func);
+
+    uint64_t hits() const
+    {
+        return n_hit_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t misses() const
+    {
+        return n_miss_.load(std::memory_order_relaxed);
+    }
+
+    size_t size() const
+    {
+        return cache_.size();
+    }
+
+    std::string print_stats() const;
+};
+
+/// Enable the process-wide precompile cache. Must be called before any
+/// transaction is executed; a `max_entries` of zero leaves it disabled
+void init_precompile_cache(
+    size_t max_entries = PrecompileCache::DEFAULT_MAX_ENTRIES,
+    uint64_t min_gas_cost = PrecompileCache::DEFAULT_MIN_GAS_COST);
+
+/// Returns the process-wide precompile cache, or nullptr if it is disabled
+PrecompileCache *precompile_cache();
+
+MONAD_NAMESPACE_END
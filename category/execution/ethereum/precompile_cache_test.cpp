@@ -0,0 +1,132 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/byte_string.hpp>
+#include <category/core/bytes.hpp>
+#include <category/execution/ethereum/precompile_cache.hpp>
+#include <category/execution/ethereum/precompiles.hpp>
+
+#include <evmc/evmc.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+using namespace monad;
+
+namespace
+{
+    unsigned n_executions = 0;
+
+    PrecompileResult counting_execute(byte_string_view const input)
+    {
+        ++n_executions;
+        auto *const obuf = static_cast<uint8_t *>(std::malloc(input.size()));
+        std::memcpy(obuf, input.data(), input.size());
+        return {
+            .status_code = EVMC_SUCCESS,
+            .obuf = obuf,
+            .output_size = input.size(),
+        };
+    }
+
+    PrecompileResult failing_execute(byte_string_view)
+    {
+        ++n_executions;
+        return PrecompileResult::failure();
+    }
+} // namespace
+
+TEST(PrecompileCache, key_depends_on_address_and_input)
+{
+    byte_string const input(64, 0xab);
+    byte_string const other(64, 0xcd);
+    auto const key = PrecompileCache::make_key(Address{1}, input);
+    EXPECT_EQ(key, PrecompileCache::make_key(Address{1}, input));
+    EXPECT_NE(key, PrecompileCache::make_key(Address{8}, input));
+    EXPECT_NE(key, PrecompileCache::make_key(Address{1}, other));
+}
+
+TEST(PrecompileCache, hit_returns_owned_copy)
+{
+    PrecompileCache cache{16, 100};
+    byte_string const input(96, 0x42);
+
+    n_executions = 0;
+    auto const first =
+        cache.execute(Address{8}, input, 45'000, counting_execute);
+    auto const second =
+        cache.execute(Address{8}, input, 45'000, counting_execute);
+    EXPECT_EQ(n_executions, 1);
+    EXPECT_EQ(cache.hits(), 1);
+    EXPECT_EQ(cache.misses(), 1);
+
+    EXPECT_EQ(second.status_code, EVMC_SUCCESS);
+    ASSERT_EQ(second.output_size, input.size());
+    EXPECT_NE(first.obuf, second.obuf);
+    EXPECT_EQ(
+        byte_string_view(second.obuf, second.output_size),
+        byte_string_view(input));
+    std::free(first.obuf);
+    std::free(second.obuf);
+}
+
+TEST(PrecompileCache, below_threshold_is_not_cached)
+{
+    PrecompileCache cache{16, 3'000};
+    byte_string const input(32, 0x01);
+
+    n_executions = 0;
+    for (int i = 0; i < 3; ++i) {
+        auto const r = cache.execute(Address{2}, input, 72, counting_execute);
+        std::free(r.obuf);
+    }
+    EXPECT_EQ(n_executions, 3);
+    EXPECT_EQ(cache.hits(), 0);
+    EXPECT_EQ(cache.misses(), 0);
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(PrecompileCache, failure_is_cached)
+{
+    PrecompileCache cache{16, 100};
+    byte_string const input(10, 0xff);
+
+    n_executions = 0;
+    auto const first = cache.execute(Address{6}, input, 150, failing_execute);
+    auto const second = cache.execute(Address{6}, input, 150, failing_execute);
+    EXPECT_EQ(n_executions, 1);
+    EXPECT_EQ(first.status_code, EVMC_PRECOMPILE_FAILURE);
+    EXPECT_EQ(second.status_code, EVMC_PRECOMPILE_FAILURE);
+    EXPECT_EQ(second.obuf, nullptr);
+    EXPECT_EQ(second.output_size, 0);
+}
+
+TEST(PrecompileCache, large_output_is_not_cached)
+{
+    PrecompileCache cache{16, 100};
+    byte_string const input(PrecompileCache::MAX_OUTPUT_SIZE + 1, 0x07);
+
+    n_executions = 0;
+    for (int i = 0; i < 2; ++i) {
+        auto const r =
+            cache.execute(Address{5}, input, 10'000, counting_execute);
+        std::free(r.obuf);
+    }
+    EXPECT_EQ(n_executions, 2);
+    EXPECT_EQ(cache.size(), 0);
+}
@@ -18,6 +18,7 @@
 #include <category/core/byte_string.hpp>
 #include <category/core/config.hpp>
 #include <category/core/likely.h>
+#include <category/execution/ethereum/precompile_cache.hpp>
 #include <category/execution/ethereum/precompiles.hpp>
 #include <category/execution/ethereum/state3/state.hpp>
 #include <category/vm/evm/explicit_traits.hpp>
@@ -162,7 +163,10 @@ std::optional<evmc::Result> check_call_eth_precompile(evmc_message const &msg)
         return evmc::Result{evmc_status_code::EVMC_OUT_OF_GAS};
     }
 
-    auto const [status_code, output_buffer, output_size] = execute_func(input);
+    PrecompileCache *const cache = precompile_cache();
+    auto const [status_code, output_buffer, output_size] =
+        cache ? cache->execute(address, input, cost.value(), execute_func)
+              : execute_func(input);
     return evmc::Result{evmc_result{
         .status_code = status_code,
         .gas_left = (status_code == EVMC_SUCCESS)
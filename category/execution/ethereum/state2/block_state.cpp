@@ -17,6 +17,7 @@
 #include <category/core/assert.h>
 #include <category/core/bytes.hpp>
 #include <category/core/config.hpp>
+#include <category/core/fiber/stack_pool.hpp>
 #include <category/core/likely.h>
 #include <category/core/log.hpp>
 #include <category/execution/ethereum/core/account.hpp>
@@ -40,13 +41,31 @@
 
 #include <quill/std/Optional.h>
 
+#include <boost/fiber/fiber.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <optional>
+#include <span>
 #include <utility>
 #include <vector>
 
 MONAD_NAMESPACE_BEGIN
 
+namespace
+{
+    // Batches are read on short-lived fibers, whose stacks are reused across
+    // batches and blocks instead of being mapped anew for every fiber
+    fiber::StackPool &storage_read_stacks()
+    {
+        static fiber::StackPool pool{
+            1024 * 1024, BlockState::MAX_CONCURRENT_STORAGE_READS};
+        return pool;
+    }
+}
+
 BlockState::BlockState(Db &db, vm::VM &monad_vm, Db *const secondary_db)
     : db_{db}
     , secondary_db_{secondary_db}
@@ -91,11 +110,9 @@ bytes32_t BlockState::read_storage(
             return {};
         }
         auto const &storage = it->second.storage;
-        {
-            StorageDeltas::const_accessor it2{};
-            if (MONAD_LIKELY(storage.find(it2, key))) {
-                return it2->second.second;
-            }
+        if (auto const it2 = storage.find(key);
+            MONAD_LIKELY(it2 != storage.end())) {
+            return it2->second.second;
         }
         auto const &orig_account = it->second.account.first;
         if (orig_account && incarnation == orig_account->incarnation) {
@@ -118,11 +135,43 @@ bytes32_t BlockState::read_storage(
             return result;
         }
         auto &storage = it->second.storage;
-        {
-            StorageDeltas::const_accessor it2{};
-            storage.emplace(it2, key, std::make_pair(result, result));
-            return it2->second.second;
+        auto const it2 =
+            storage.try_emplace(key, std::make_pair(result, result)).first;
+        return it2->second.second;
+    }
+}
+
+void BlockState::read_storage(
+    Address const &address, Incarnation const incarnation,
+    std::span<bytes32_t const> const keys, std::span<bytes32_t> const values)
+{
+    MONAD_ASSERT(keys.size() == values.size());
+    size_t const n_fibers =
+        std::min(keys.size(), MAX_CONCURRENT_STORAGE_READS);
+    if (n_fibers <= 1) {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            values[i] = read_storage(address, incarnation, keys[i]);
         }
+        return;
+    }
+    // fibers may be stolen by other threads of the pool
+    std::atomic<size_t> next{0};
+    std::vector<boost::fibers::fiber> fibers;
+    fibers.reserve(n_fibers);
+    for (size_t i = 0; i < n_fibers; ++i) {
+        fibers.emplace_back(
+            std::allocator_arg,
+            fiber::PooledStack{storage_read_stacks()},
+            [&] {
+                for (size_t j = next.fetch_add(1, std::memory_order_relaxed);
+                     j < keys.size();
+                     j = next.fetch_add(1, std::memory_order_relaxed)) {
+                    values[j] = read_storage(address, incarnation, keys[j]);
+                }
+            });
+    }
+    for (auto &fiber : fibers) {
+        fiber.join();
     }
 }
 
@@ -174,9 +223,10 @@ bool BlockState::can_merge(State &state) const
             }
         }
         // TODO account.has_value()???
+        auto const &block_storage = it->second.storage;
         for (auto const &[key, value] : storage) {
-            StorageDeltas::const_accessor it2{};
-            if (it->second.storage.find(it2, key)) {
+            auto const it2 = block_storage.find(key);
+            if (it2 != block_storage.end()) {
                 if (value != it2->second.second) {
                     return false;
                 }
@@ -224,15 +274,13 @@ void BlockState::merge(State const &state)
         MONAD_ASSERT(state_->find(it, address));
         it->second.account.second = account;
         if (account.has_value()) {
+            auto &block_storage = it->second.storage;
             for (auto const &[key, value] : storage) {
-                StorageDeltas::accessor it2{};
-                if (it->second.storage.find(it2, key)) {
+                auto const [it2, inserted] = block_storage.try_emplace(
+                    key, std::make_pair(bytes32_t{}, value));
+                if (!inserted) {
                     it2->second.second = value;
                 }
-                else {
-                    it->second.storage.emplace(
-                        key, std::make_pair(bytes32_t{}, value));
-                }
             }
         }
         else {
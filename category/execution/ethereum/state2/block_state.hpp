@@ -28,7 +28,9 @@
 
 #include <ankerl/unordered_dense.h>
 
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <vector>
 
 MONAD_NAMESPACE_BEGIN
@@ -73,6 +75,14 @@ public:
 
     bytes32_t read_storage(Address const &, Incarnation, bytes32_t const &key);
 
+    /// Reads `keys` into `values` on up to MAX_CONCURRENT_STORAGE_READS
+    /// fibers so that the database lookups of a batch overlap
+    void read_storage(
+        Address const &, Incarnation, std::span<bytes32_t const> keys,
+        std::span<bytes32_t> values);
+
+    static constexpr size_t MAX_CONCURRENT_STORAGE_READS = 64;
+
     vm::SharedVarcode read_code(bytes32_t const &);
 
     bool can_merge(State &) const;
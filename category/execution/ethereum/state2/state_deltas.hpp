@@ -24,6 +24,8 @@
 #include <category/execution/ethereum/core/account.hpp>
 #include <category/vm/code.hpp>
 
+#include <ankerl/unordered_dense.h>
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #include <oneapi/tbb/concurrent_hash_map.h>
@@ -48,10 +50,15 @@ using StorageDelta = Delta<bytes32_t>;
 static_assert(sizeof(StorageDelta) == 64);
 static_assert(alignof(StorageDelta) == 1);
 
-using StorageDeltas = oneapi::tbb::concurrent_hash_map<
-    bytes32_t, StorageDelta, BytesHashCompare<bytes32_t>>;
+// Storage deltas of one account. This is a flat table rather than a
+// concurrent one: it is only ever accessed through an accessor on the owning
+// StateDeltas entry, which already serializes writers against readers. An
+// empty table does not allocate, so accounts whose storage is never touched
+// (e.g. EOAs in plain transfers) only pay for the table header.
+using StorageDeltas = ankerl::unordered_dense::
+    map<bytes32_t, StorageDelta, BytesHashCompare<bytes32_t>>;
 
-static_assert(sizeof(StorageDeltas) == 576);
+static_assert(sizeof(StorageDeltas) <= 64);
 static_assert(alignof(StorageDeltas) == 8);
 
 struct StateDelta
@@ -60,7 +67,7 @@ struct StateDelta
     StorageDeltas storage{};
 };
 
-static_assert(sizeof(StateDelta) == 752);
+static_assert(sizeof(StateDelta) <= 240);
 static_assert(alignof(StateDelta) == 8);
 
 using StateDeltas = oneapi::tbb::concurrent_hash_map<
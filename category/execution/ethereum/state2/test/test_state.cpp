@@ -55,6 +55,7 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 using namespace monad;
 using namespace monad::test;
@@ -1058,6 +1059,109 @@ TYPED_TEST(InMemoryStateTraitsTest, access_storage)
     EXPECT_EQ(s.access_storage<Trait>(b, key2), EVMC_ACCESS_WARM);
 }
 
+TYPED_TEST(InMemoryStateTraitsTest, nested_frames_revert)
+{
+    using Trait = typename TestFixture::Trait;
+
+    BlockState bs{this->tdb, this->vm};
+    commit_sequential(
+        this->tdb,
+        StateDeltas{
+            {a,
+             StateDelta{
+                 .account = {std::nullopt, Account{.balance = 100}},
+                 .storage = {{key1, {bytes32_t{}, value1}}}}}},
+        Code{},
+        BlockHeader{});
+
+    State s{bs, Incarnation{1, 1}};
+    s.push();
+    s.add_to_balance(a, 10);
+    EXPECT_EQ(s.set_storage(a, key1, value2), EVMC_STORAGE_MODIFIED);
+    EXPECT_EQ(s.access_storage<Trait>(a, key1), EVMC_ACCESS_COLD);
+    s.set_transient_storage(a, key1, value1);
+
+    s.push();
+    s.add_to_balance(a, 5);
+    s.add_to_balance(c, 1);
+    EXPECT_EQ(s.set_storage(a, key1, value3), EVMC_STORAGE_ASSIGNED);
+    EXPECT_EQ(s.set_storage(a, key2, value1), EVMC_STORAGE_ADDED);
+    EXPECT_EQ(s.access_storage<Trait>(a, key2), EVMC_ACCESS_COLD);
+    s.set_transient_storage(a, key1, value2);
+    s.set_transient_storage(a, key2, value2);
+    s.pop_reject();
+
+    EXPECT_EQ(s.get_balance(a), 110);
+    EXPECT_FALSE(s.account_exists(c));
+    EXPECT_EQ(s.get_storage(a, key1), value2);
+    EXPECT_EQ(s.get_storage(a, key2), null);
+    EXPECT_EQ(s.get_transient_storage(a, key1), value1);
+    EXPECT_EQ(s.get_transient_storage(a, key2), null);
+    EXPECT_EQ(s.access_storage<Trait>(a, key1), EVMC_ACCESS_WARM);
+    EXPECT_EQ(s.access_storage<Trait>(a, key2), EVMC_ACCESS_COLD);
+
+    s.push();
+    EXPECT_EQ(s.set_storage(a, key2, value3), EVMC_STORAGE_ADDED);
+    s.pop_accept();
+    s.pop_accept();
+
+    EXPECT_EQ(s.get_balance(a), 110);
+    EXPECT_EQ(s.get_storage(a, key1), value2);
+    EXPECT_EQ(s.get_storage(a, key2), value3);
+
+    s.push();
+    s.set_nonce(a, 7);
+    EXPECT_EQ(s.set_storage(a, key1, null), EVMC_STORAGE_MODIFIED_DELETED);
+    s.pop_reject();
+
+    EXPECT_EQ(s.get_nonce(a), 0);
+    EXPECT_EQ(s.get_storage(a, key1), value2);
+}
+
+TYPED_TEST(InMemoryStateTraitsTest, nested_frames_accept_into_rejected_parent)
+{
+    using Trait = typename TestFixture::Trait;
+
+    BlockState bs{this->tdb, this->vm};
+    commit_sequential(
+        this->tdb,
+        StateDeltas{
+            {a,
+             StateDelta{
+                 .account = {std::nullopt, Account{.balance = 100}},
+                 .storage = {{key1, {bytes32_t{}, value1}}}}}},
+        Code{},
+        BlockHeader{});
+
+    State s{bs, Incarnation{1, 1}};
+    s.push();
+    s.push();
+    s.add_to_balance(a, 5);
+    s.add_to_balance(b, 1);
+    EXPECT_EQ(s.set_storage(a, key1, value2), EVMC_STORAGE_MODIFIED);
+    EXPECT_EQ(s.set_storage(a, key2, value3), EVMC_STORAGE_ADDED);
+    EXPECT_EQ(s.access_storage<Trait>(a, key3), EVMC_ACCESS_COLD);
+    s.set_transient_storage(a, key1, value1);
+    s.pop_accept();
+
+    // changes accepted into the parent frame are visible there
+    EXPECT_EQ(s.get_balance(a), 105);
+    EXPECT_TRUE(s.account_exists(b));
+    EXPECT_EQ(s.get_storage(a, key1), value2);
+    EXPECT_EQ(s.get_storage(a, key2), value3);
+    EXPECT_EQ(s.get_transient_storage(a, key1), value1);
+
+    // and rejecting the parent reverts them as well
+    s.pop_reject();
+
+    EXPECT_EQ(s.get_balance(a), 100);
+    EXPECT_FALSE(s.account_exists(b));
+    EXPECT_EQ(s.get_storage(a, key1), value1);
+    EXPECT_EQ(s.get_storage(a, key2), null);
+    EXPECT_EQ(s.get_transient_storage(a, key1), null);
+    EXPECT_EQ(s.access_storage<Trait>(a, key3), EVMC_ACCESS_COLD);
+}
+
 TEST_F(InMemoryStateTest, get_storage)
 {
     BlockState bs{this->tdb, this->vm};
@@ -1088,6 +1192,42 @@ TEST_F(InMemoryStateTest, get_storage)
     EXPECT_EQ(s.get_storage(b, key3), null);
 }
 
+TEST_F(InMemoryStateTest, prefetch_storage)
+{
+    BlockState bs{this->tdb, this->vm};
+    commit_sequential(
+        this->tdb,
+        StateDeltas(
+            {{a,
+              StateDelta{
+                  .account = {std::nullopt, Account{}},
+                  .storage =
+                      {{key1, {bytes32_t{}, value1}},
+                       {key2, {bytes32_t{}, value2}}}}}}),
+        Code{},
+        BlockHeader{});
+
+    State s{bs, Incarnation{1, 1}};
+    EXPECT_EQ(s.get_storage(a, key1), value1);
+
+    std::vector<bytes32_t> const keys{key1, key2, key3, key2};
+    s.prefetch_storage(a, keys);
+    auto const &storage = s.original().find(a)->second.storage_;
+    EXPECT_EQ(storage.size(), 3);
+    ASSERT_NE(storage.find(key2), nullptr);
+    EXPECT_EQ(*storage.find(key2), value2);
+    ASSERT_NE(storage.find(key3), nullptr);
+    EXPECT_EQ(*storage.find(key3), null);
+
+    EXPECT_EQ(s.get_storage(a, key1), value1);
+    EXPECT_EQ(s.get_storage(a, key2), value2);
+    EXPECT_EQ(s.get_storage(a, key3), null);
+
+    // nonexistent account: nothing to load
+    s.prefetch_storage(b, keys);
+    EXPECT_EQ(s.original().find(b)->second.storage_.size(), 0);
+}
+
 TEST_F(InMemoryStateTest, set_storage_modified)
 {
     BlockState bs{this->tdb, this->vm};
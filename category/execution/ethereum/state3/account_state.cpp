@@ -17,6 +17,7 @@
 
 #include <category/core/bytes.hpp>
 #include <category/core/config.hpp>
+#include <category/execution/ethereum/state3/state_map.hpp>
 
 #include <evmc/evmc.h>
 
@@ -39,7 +40,7 @@ evmc_storage_status AccountState::zero_out_key(
         return EVMC_STORAGE_MODIFIED_DELETED;
     }();
 
-    storage_ = storage_.insert({key, bytes32_t{}});
+    put(storage_, key, bytes32_t{});
 
     return status;
 }
@@ -67,7 +68,7 @@ evmc_storage_status AccountState::set_current_value(
         return EVMC_STORAGE_ASSIGNED;
     }();
 
-    storage_ = storage_.insert({key, value});
+    put(storage_, key, value);
 
     return status;
 }
@@ -23,15 +23,10 @@
 #include <category/execution/ethereum/core/account.hpp>
 #include <category/execution/ethereum/state3/account_substate.hpp>
 #include <category/execution/ethereum/state3/page_tracker.hpp>
+#include <category/execution/ethereum/state3/state_map.hpp>
 
 #include <evmc/evmc.h>
 
-// TODO immer known to trigger incorrect warning
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-#include <immer/map.hpp>
-#pragma GCC diagnostic pop
-
 #include <cstdint>
 #include <optional>
 #include <utility>
@@ -50,8 +45,7 @@ namespace trace
 class AccountState : public AccountSubstate
 {
 public: // TODO
-    using StorageMap = immer::map<
-        bytes32_t, bytes32_t, ankerl::unordered_dense::hash<monad::bytes32_t>>;
+    using StorageMap = StateMap<bytes32_t>;
 
 protected:
     std::optional<Account> account_{};
@@ -151,11 +145,11 @@ public:
 
     void set_transient_storage(bytes32_t const &key, bytes32_t const &value)
     {
-        transient_storage_ = transient_storage_.insert({key, value});
+        put(transient_storage_, key, value);
     }
 };
 
-static_assert(sizeof(AccountState) == 160);
+static_assert(use_state_journal || sizeof(AccountState) == 160);
 
 // RELAXED MERGE
 // track the min original balance needed at start of transaction and if the
@@ -17,22 +17,16 @@
 
 #include <category/core/bytes.hpp>
 #include <category/core/config.hpp>
+#include <category/execution/ethereum/state3/state_map.hpp>
 
 #include <evmc/evmc.h>
 
-// TODO immer known to trigger incorrect warning
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-#include <immer/set.hpp>
-#pragma GCC diagnostic pop
-
 MONAD_NAMESPACE_BEGIN
 
 // YP 6.1
 class AccountSubstate
 {
-    using Set =
-        immer::set<bytes32_t, ankerl::unordered_dense::hash<monad::bytes32_t>>;
+    using Set = StateSet;
 
     bool destructed_{false}; // A_s
     bool touched_{false}; // A_t
@@ -40,6 +34,14 @@ class AccountSubstate
     Set accessed_storage_{}; // A_K
 
 public:
+    // A_s, A_t and A_a, saved and restored as a unit by the state journal
+    struct Flags
+    {
+        bool destructed;
+        bool touched;
+        bool accessed;
+    };
+
     AccountSubstate() = default;
     AccountSubstate(AccountSubstate &&) noexcept = default;
     AccountSubstate(AccountSubstate const &) = default;
@@ -59,11 +61,26 @@ public:
     }
 
     // A_K
-    Set get_accessed_storage() const
+    Set const &get_accessed_storage() const
     {
         return accessed_storage_;
     }
 
+    Flags flags() const
+    {
+        return {
+            .destructed = destructed_,
+            .touched = touched_,
+            .accessed = accessed_};
+    }
+
+    void restore_flags(Flags const &flags)
+    {
+        destructed_ = flags.destructed;
+        touched_ = flags.touched;
+        accessed_ = flags.accessed;
+    }
+
     // A_s
     bool destruct()
     {
@@ -93,13 +110,19 @@ public:
     evmc_access_status access_storage(bytes32_t const &key)
     {
         if (accessed_storage_.count(key) == 0) {
-            accessed_storage_ = accessed_storage_.insert(key);
+            put(accessed_storage_, key);
             return EVMC_ACCESS_COLD;
         }
         return EVMC_ACCESS_WARM;
     }
+
+    // Undo a cold access_storage(key)
+    void forget_storage_access(bytes32_t const &key)
+    {
+        erase_key(accessed_storage_, key);
+    }
 };
 
-static_assert(sizeof(AccountSubstate) == 24);
+static_assert(use_state_journal || sizeof(AccountSubstate) == 24);
 
 MONAD_NAMESPACE_END
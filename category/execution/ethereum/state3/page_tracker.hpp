@@ -17,20 +17,20 @@
 
 #include <category/core/bytes.hpp>
 #include <category/core/config.hpp>
+#include <category/execution/ethereum/state3/state_map.hpp>
 #include <category/execution/monad/db/storage_page.hpp>
 #include <category/vm/host.hpp>
 
 #include <evmc/evmc.h>
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-#include <immer/map.hpp>
-#pragma GCC diagnostic pop
+#include <cstdint>
+#include <optional>
 
 MONAD_NAMESPACE_BEGIN
 
 class PageTracker
 {
+public:
     struct PageState
     {
         bool accessed{false}; // read
@@ -39,8 +39,15 @@ class PageTracker
         int16_t current_growth{0};
     };
 
-    using PageMap = immer::map<
-        bytes32_t, PageState, ankerl::unordered_dense::hash<monad::bytes32_t>>;
+    // State of one page before a change, for the state journal
+    struct Snapshot
+    {
+        bytes32_t page_key;
+        std::optional<PageState> state;
+    };
+
+private:
+    using PageMap = StateMap<PageState>;
 
     PageMap pages_{};
 
@@ -51,6 +58,23 @@ class PageTracker
     }
 
 public:
+    Snapshot snapshot(bytes32_t const &key) const
+    {
+        auto const pkey = compute_page_key(key);
+        auto const *cur = pages_.find(pkey);
+        return {pkey, cur ? std::optional{*cur} : std::nullopt};
+    }
+
+    void restore(Snapshot const &snapshot)
+    {
+        if (snapshot.state.has_value()) {
+            put(pages_, snapshot.page_key, *snapshot.state);
+        }
+        else {
+            erase_key(pages_, snapshot.page_key);
+        }
+    }
+
     evmc_access_status access_page(bytes32_t const &key)
     {
         auto const pkey = compute_page_key(key);
@@ -59,7 +83,7 @@ public:
             return EVMC_ACCESS_WARM;
         }
         s.accessed = true;
-        pages_ = pages_.set(pkey, s);
+        put(pages_, pkey, s);
         return EVMC_ACCESS_COLD;
     }
 
@@ -96,7 +120,7 @@ public:
             ps.peak_growth = ps.current_growth;
         }
         if (value_changed) {
-            pages_ = pages_.set(pkey, ps);
+            put(pages_, pkey, ps);
         }
 
         return {first_page_write, grew_state};
@@ -28,6 +28,8 @@
 #include <category/execution/ethereum/core/receipt.hpp>
 #include <category/execution/ethereum/state2/block_state.hpp>
 #include <category/execution/ethereum/state3/account_state.hpp>
+#include <category/execution/ethereum/state3/state_journal.hpp>
+#include <category/execution/ethereum/state3/state_map.hpp>
 #include <category/execution/ethereum/state3/version_stack.hpp>
 #include <category/execution/ethereum/types/incarnation.hpp>
 #include <category/vm/code.hpp>
@@ -45,7 +47,10 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <span>
+#include <type_traits>
 #include <utility>
+#include <variant>
 #include <vector>
 
 MONAD_NAMESPACE_BEGIN
@@ -79,14 +84,103 @@ AccountState &State::current_account_state(Address const &address)
     if (MONAD_UNLIKELY(it == current_.end())) {
         // original
         auto const &account_state = original_account_state(address);
-        it = current_.try_emplace(address, account_state, version_).first;
+        if constexpr (use_state_journal) {
+            // Storage reads fall through to the original state, so only the
+            // account is copied and the current storage holds just the
+            // written keys
+            AccountState current{account_state.account_};
+            it = current_.try_emplace(address, std::move(current), version_)
+                     .first;
+            if (journal_.active()) {
+                journal_.record(StateJournal::AccountCreated{address});
+            }
+        }
+        else {
+            it = current_.try_emplace(address, account_state, version_).first;
+        }
     }
     if (!dirty_.empty()) {
         dirty_.back().emplace(address);
     }
+    if constexpr (use_state_journal) {
+        auto &stack = it->second;
+        auto &account_state = stack.recent();
+        if (stack.version() < version_) {
+            journal_.record(StateJournal::AccountChanged{
+                .address = address,
+                .account = account_state.account_,
+                .flags = account_state.flags(),
+                .version = stack.version()});
+            stack.retag(version_);
+        }
+        return account_state;
+    }
     return it->second.current(version_);
 }
 
+void State::journal_storage_change(
+    Address const &address, AccountState const &account_state,
+    bytes32_t const &key, bool const transient)
+{
+    if (!journal_.active()) {
+        return;
+    }
+    auto const &storage = transient ? account_state.transient_storage_
+                                    : account_state.storage_;
+    auto const *const value = storage.find(key);
+    journal_.record(StateJournal::StorageChanged{
+        .address = address,
+        .key = key,
+        .value = value ? std::optional{*value} : std::nullopt,
+        .transient = transient});
+}
+
+void State::undo(StateJournal::Entry const &entry)
+{
+    std::visit(
+        [this]<typename E>(E const &e) {
+            if constexpr (std::is_same_v<E, StateJournal::AccountCreated>) {
+                current_.erase(e.address);
+            }
+            else {
+                auto const it = current_.find(e.address);
+                MONAD_ASSERT(it != current_.end());
+                auto &account_state = it->second.recent();
+                if constexpr (std::is_same_v<
+                                  E,
+                                  StateJournal::AccountChanged>) {
+                    account_state.account_ = e.account;
+                    account_state.restore_flags(e.flags);
+                    it->second.retag(e.version);
+                }
+                else if constexpr (std::is_same_v<
+                                       E,
+                                       StateJournal::StorageChanged>) {
+                    auto &storage = e.transient
+                                        ? account_state.transient_storage_
+                                        : account_state.storage_;
+                    if (e.value.has_value()) {
+                        put(storage, e.key, *e.value);
+                    }
+                    else {
+                        erase_key(storage, e.key);
+                    }
+                }
+                else if constexpr (std::is_same_v<
+                                       E,
+                                       StateJournal::StorageAccessed>) {
+                    account_state.forget_storage_access(e.key);
+                }
+                else {
+                    static_assert(
+                        std::is_same_v<E, StateJournal::PageChanged>);
+                    account_state.page_tracker_.restore(e.snapshot);
+                }
+            }
+        },
+        entry);
+}
+
 std::optional<Account> &State::current_account(Address const &address)
 {
     return current_account_state(address).account_;
@@ -131,6 +225,9 @@ void State::push()
 
     ++version_;
     dirty_.emplace_back();
+    if constexpr (use_state_journal) {
+        journal_.mark();
+    }
 }
 
 void State::pop_accept()
@@ -143,11 +240,23 @@ void State::pop_accept()
     for (auto const &dirty_address : accounts) {
         auto const it = current_.find(dirty_address);
         MONAD_ASSERT(it != current_.end());
-        it->second.pop_accept(version_);
+        if constexpr (use_state_journal) {
+            // The journal entries of this frame now belong to the parent
+            // frame, and cover this account's writes in it
+            if (it->second.version() == version_) {
+                it->second.retag(version_ - 1);
+            }
+        }
+        else {
+            it->second.pop_accept(version_);
+        }
         if (!dirty_.empty()) {
             dirty_.back().emplace(dirty_address);
         }
     }
+    if constexpr (use_state_journal) {
+        journal_.accept();
+    }
 
     logs_.pop_accept(version_);
 
@@ -159,24 +268,29 @@ void State::pop_reject()
     MONAD_ASSERT(version_);
     MONAD_ASSERT(dirty_.size() == version_);
 
-    std::vector<Address> removals;
     auto accounts = std::move(dirty_.back());
     dirty_.pop_back();
-    for (auto const &dirty_address : accounts) {
-        auto const it = current_.find(dirty_address);
-        MONAD_ASSERT(it != current_.end());
-        if (it->second.pop_reject(version_)) {
-            removals.push_back(it->first);
+    if constexpr (use_state_journal) {
+        journal_.reject(
+            [this](StateJournal::Entry const &entry) { undo(entry); });
+    }
+    else {
+        std::vector<Address> removals;
+        for (auto const &dirty_address : accounts) {
+            auto const it = current_.find(dirty_address);
+            MONAD_ASSERT(it != current_.end());
+            if (it->second.pop_reject(version_)) {
+                removals.push_back(it->first);
+            }
+        }
+        while (removals.size()) {
+            current_.erase(removals.back());
+            removals.pop_back();
         }
     }
 
     logs_.pop_reject(version_);
 
-    while (removals.size()) {
-        current_.erase(removals.back());
-        removals.pop_back();
-    }
-
     rb_.on_pop_reject(accounts);
 
     --version_;
@@ -287,7 +401,7 @@ bytes32_t State::get_storage(Address const &address, bytes32_t const &key)
         else {
             bytes32_t const value = block_state_.read_storage(
                 address, account.value().incarnation, key);
-            storage = storage.insert({key, value});
+            put(storage, key, value);
             return value;
         }
     }
@@ -315,12 +429,37 @@ bytes32_t State::get_storage(Address const &address, bytes32_t const &key)
         else {
             bytes32_t const value = block_state_.read_storage(
                 address, account.value().incarnation, key);
-            original_storage = original_storage.insert({key, value});
+            put(original_storage, key, value);
             return value;
         }
     }
 }
 
+void State::prefetch_storage(
+    Address const &address, std::span<bytes32_t const> const keys)
+{
+    auto &account_state = original_account_state(address);
+    auto const &account = account_state.account_;
+    if (!account.has_value()) {
+        return;
+    }
+    auto &storage = account_state.storage_;
+    Set<bytes32_t> seen;
+    std::vector<bytes32_t> missing;
+    missing.reserve(keys.size());
+    for (auto const &key : keys) {
+        if (!storage.find(key) && seen.insert(key).second) {
+            missing.push_back(key);
+        }
+    }
+    std::vector<bytes32_t> values(missing.size());
+    block_state_.read_storage(
+        address, account.value().incarnation, missing, values);
+    for (size_t i = 0; i < missing.size(); ++i) {
+        put(storage, missing[i], values[i]);
+    }
+}
+
 bytes32_t
 State::get_transient_storage(Address const &address, bytes32_t const &key)
 {
@@ -393,12 +532,13 @@ evmc_storage_status State::set_storage(
             Incarnation const incarnation = account_state.account_->incarnation;
             bytes32_t const value =
                 block_state_.read_storage(address, incarnation, key);
-            storage = storage.insert({key, value});
+            put(storage, key, value);
             original_value = value;
         }
     }
     // state
     {
+        journal_storage_change(address, account_state, key, false);
         auto const result =
             account_state.set_storage(key, value, original_value);
         return result;
@@ -408,7 +548,9 @@ evmc_storage_status State::set_storage(
 void State::set_transient_storage(
     Address const &address, bytes32_t const &key, bytes32_t const &value)
 {
-    current_account_state(address).set_transient_storage(key, value);
+    auto &account_state = current_account_state(address);
+    journal_storage_change(address, account_state, key, true);
+    account_state.set_transient_storage(key, value);
 }
 
 void State::touch(Address const &address)
@@ -429,7 +571,24 @@ State::access_storage(Address const &address, bytes32_t const &key)
 {
     auto &account_state = current_account_state(address);
     auto const slot_status = account_state.access_storage(key);
+    if constexpr (use_state_journal) {
+        if (slot_status == EVMC_ACCESS_COLD && journal_.active()) {
+            journal_.record(StateJournal::StorageAccessed{address, key});
+        }
+    }
     if constexpr (traits::mip_8_active()) {
+        if constexpr (use_state_journal) {
+            if (journal_.active()) {
+                auto snapshot = account_state.page_tracker_.snapshot(key);
+                auto const page_status =
+                    account_state.page_tracker_.access_page(key);
+                if (page_status == EVMC_ACCESS_COLD) {
+                    journal_.record(StateJournal::PageChanged{
+                        address, std::move(snapshot)});
+                }
+                return page_status;
+            }
+        }
         return account_state.page_tracker_.access_page(key);
     }
     return slot_status;
@@ -442,6 +601,13 @@ vm::Host::PageStorageStatus State::update_page(
     evmc_storage_status const status)
 {
     auto &account_state = current_account_state(address);
+    if constexpr (use_state_journal) {
+        // update_page only writes the page when the slot value changed
+        if (status != EVMC_STORAGE_ASSIGNED && journal_.active()) {
+            journal_.record(StateJournal::PageChanged{
+                address, account_state.page_tracker_.snapshot(key)});
+        }
+    }
     return account_state.page_tracker_.update_page(key, status);
 }
 
@@ -23,6 +23,7 @@
 #include <category/execution/ethereum/core/receipt.hpp>
 #include <category/execution/ethereum/reserve_balance.hpp>
 #include <category/execution/ethereum/state3/account_state.hpp>
+#include <category/execution/ethereum/state3/state_journal.hpp>
 #include <category/execution/ethereum/state3/version_stack.hpp>
 #include <category/execution/ethereum/types/incarnation.hpp>
 #include <category/execution/monad/reserve_balance.hpp>
@@ -39,6 +40,7 @@
 #include <cstdint>
 #include <deque>
 #include <optional>
+#include <span>
 
 MONAD_NAMESPACE_BEGIN
 
@@ -68,6 +70,11 @@ class State
 
     std::deque<Set<Address>> dirty_;
 
+    // Only used by the MONAD_STATE_JOURNAL backend, where every stack in
+    // `current_` holds a single entry tagged with the depth of its last
+    // journaled write
+    StateJournal journal_{};
+
     bool const relaxed_validation_{false};
     ReserveBalance rb_;
 
@@ -92,6 +99,12 @@ private:
 
     std::optional<Account> &current_account(Address const &);
 
+    void journal_storage_change(
+        Address const &, AccountState const &, bytes32_t const &key,
+        bool transient);
+
+    void undo(StateJournal::Entry const &);
+
 public:
     State(BlockState &, Incarnation, bool relaxed_validation = false);
 
@@ -147,6 +160,10 @@ public:
 
     bytes32_t get_storage(Address const &, bytes32_t const &key);
 
+    // Load the original values of `keys` with one batched block state read,
+    // so that subsequent get_storage calls for them do not touch the db
+    void prefetch_storage(Address const &, std::span<bytes32_t const> keys);
+
     bytes32_t get_transient_storage(Address const &, bytes32_t const &key);
 
     bool is_touched(Address const &);
@@ -0,0 +1,130 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#pragma once
+
+#include <category/core/address.hpp>
+#include <category/core/assert.h>
+#include <category/core/bytes.hpp>
+#include <category/core/config.hpp>
+#include <category/execution/ethereum/core/account.hpp>
+#include <category/execution/ethereum/state3/account_substate.hpp>
+#include <category/execution/ethereum/state3/page_tracker.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
+MONAD_NAMESPACE_BEGIN
+
+// Undo log of the MONAD_STATE_JOURNAL backend. Instead of copying an account
+// at every call depth that writes to it, State mutates a single AccountState
+// in place and records here how to revert each change. A call frame costs a
+// mark; rejecting the frame replays the entries above the mark in reverse.
+class StateJournal
+{
+public:
+    // The account was first loaded into the current state
+    struct AccountCreated
+    {
+        Address address;
+    };
+
+    // First write to the account's scalar fields within a frame
+    struct AccountChanged
+    {
+        Address address;
+        std::optional<Account> account;
+        AccountSubstate::Flags flags;
+        unsigned version;
+    };
+
+    struct StorageChanged
+    {
+        Address address;
+        bytes32_t key;
+        std::optional<bytes32_t> value;
+        bool transient;
+    };
+
+    // A storage key became warm
+    struct StorageAccessed
+    {
+        Address address;
+        bytes32_t key;
+    };
+
+    struct PageChanged
+    {
+        Address address;
+        PageTracker::Snapshot snapshot;
+    };
+
+    using Entry = std::variant<
+        AccountCreated, AccountChanged, StorageChanged, StorageAccessed,
+        PageChanged>;
+
+private:
+    std::vector<Entry> entries_{};
+    std::vector<size_t> marks_{};
+
+public:
+    // Whether changes can still be reverted, i.e. some frame is open
+    bool active() const
+    {
+        return !marks_.empty();
+    }
+
+    void mark()
+    {
+        marks_.push_back(entries_.size());
+    }
+
+    void record(Entry &&entry)
+    {
+        MONAD_ASSERT(active());
+
+        entries_.push_back(std::move(entry));
+    }
+
+    // Fold the top frame into its parent; entries are dropped once the
+    // outermost frame is accepted
+    void accept()
+    {
+        MONAD_ASSERT(active());
+
+        marks_.pop_back();
+        if (marks_.empty()) {
+            entries_.clear();
+        }
+    }
+
+    // Pass the entries of the top frame to `undo`, newest first
+    template <typename F>
+    void reject(F &&undo)
+    {
+        MONAD_ASSERT(active());
+
+        size_t const mark = marks_.back();
+        marks_.pop_back();
+        while (entries_.size() > mark) {
+            undo(entries_.back());
+            entries_.pop_back();
+        }
+    }
+};
+
+MONAD_NAMESPACE_END
@@ -0,0 +1,221 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#pragma once
+
+#include <category/core/bytes.hpp>
+#include <category/core/config.hpp>
+
+#include <ankerl/unordered_dense.h>
+
+// TODO immer known to trigger incorrect warning
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#include <immer/map.hpp>
+#include <immer/set.hpp>
+#pragma GCC diagnostic pop
+
+#include <cstddef>
+
+MONAD_NAMESPACE_BEGIN
+
+// Container backend of the per-transaction State.
+//
+// By default account storage, transient storage, accessed slots and storage
+// pages are persistent (immer) maps, and State keeps a copy of an account
+// for each call depth that writes to it; copies are cheap because the maps
+// share structure. With MONAD_STATE_JOURNAL the maps are flat open-addressing
+// tables mutated in place, and State instead records an undo journal that
+// pop_reject() replays backwards (see StateJournal).
+#ifdef MONAD_STATE_JOURNAL
+inline constexpr bool use_state_journal = true;
+#else
+inline constexpr bool use_state_journal = false;
+#endif
+
+template <typename K, typename V>
+class FlatMap
+{
+    using Table = ankerl::unordered_dense::map<K, V>;
+
+    Table table_{};
+
+public:
+    using const_iterator = typename Table::const_iterator;
+
+    V const *find(K const &key) const
+    {
+        auto const it = table_.find(key);
+        return it == table_.end() ? nullptr : &it->second;
+    }
+
+    size_t count(K const &key) const
+    {
+        return table_.count(key);
+    }
+
+    size_t size() const
+    {
+        return table_.size();
+    }
+
+    bool empty() const
+    {
+        return table_.empty();
+    }
+
+    const_iterator begin() const
+    {
+        return table_.begin();
+    }
+
+    const_iterator end() const
+    {
+        return table_.end();
+    }
+
+    void set(K const &key, V const &value)
+    {
+        table_.insert_or_assign(key, value);
+    }
+
+    void erase(K const &key)
+    {
+        table_.erase(key);
+    }
+};
+
+template <typename K>
+class FlatSet
+{
+    using Table = ankerl::unordered_dense::set<K>;
+
+    Table table_{};
+
+public:
+    using const_iterator = typename Table::const_iterator;
+
+    size_t count(K const &key) const
+    {
+        return table_.count(key);
+    }
+
+    size_t size() const
+    {
+        return table_.size();
+    }
+
+    bool empty() const
+    {
+        return table_.empty();
+    }
+
+    const_iterator begin() const
+    {
+        return table_.begin();
+    }
+
+    const_iterator end() const
+    {
+        return table_.end();
+    }
+
+    bool insert(K const &key)
+    {
+        return table_.insert(key).second;
+    }
+
+    void erase(K const &key)
+    {
+        table_.erase(key);
+    }
+
+    friend bool operator==(FlatSet const &a, FlatSet const &b)
+    {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (auto const &key : a) {
+            if (!b.count(key)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+template <typename V>
+using PersistentMap =
+    immer::map<bytes32_t, V, ankerl::unordered_dense::hash<monad::bytes32_t>>;
+
+using PersistentSet =
+    immer::set<bytes32_t, ankerl::unordered_dense::hash<monad::bytes32_t>>;
+
+#ifdef MONAD_STATE_JOURNAL
+template <typename V>
+using StateMap = FlatMap<bytes32_t, V>;
+using StateSet = FlatSet<bytes32_t>;
+#else
+template <typename V>
+using StateMap = PersistentMap<V>;
+using StateSet = PersistentSet;
+#endif
+
+// In-place updates with the same spelling for both backends
+
+template <typename V>
+void put(FlatMap<bytes32_t, V> &map, bytes32_t const &key, V const &value)
+{
+    map.set(key, value);
+}
+
+template <typename V>
+void put(PersistentMap<V> &map, bytes32_t const &key, V const &value)
+{
+    map = map.set(key, value);
+}
+
+inline void put(FlatSet<bytes32_t> &set, bytes32_t const &key)
+{
+    set.insert(key);
+}
+
+inline void put(PersistentSet &set, bytes32_t const &key)
+{
+    set = set.insert(key);
+}
+
+template <typename V>
+void erase_key(FlatMap<bytes32_t, V> &map, bytes32_t const &key)
+{
+    map.erase(key);
+}
+
+template <typename V>
+void erase_key(PersistentMap<V> &map, bytes32_t const &key)
+{
+    map = map.erase(key);
+}
+
+inline void erase_key(FlatSet<bytes32_t> &set, bytes32_t const &key)
+{
+    set.erase(key);
+}
+
+inline void erase_key(PersistentSet &set, bytes32_t const &key)
+{
+    set = set.erase(key);
+}
+
+MONAD_NAMESPACE_END
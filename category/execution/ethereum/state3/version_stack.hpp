@@ -77,6 +77,15 @@ public:
         return stack_.back().second;
     }
 
+    // Re-tag a single-entry stack whose changes are tracked by an undo log
+    // rather than by stacked copies (see StateJournal)
+    void retag(unsigned const version)
+    {
+        MONAD_ASSERT(stack_.size() == 1);
+
+        stack_.back().first = version;
+    }
+
     void pop_accept(unsigned const version)
     {
         MONAD_ASSERT(version);
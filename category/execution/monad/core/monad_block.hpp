@@ -20,6 +20,7 @@
 #include <category/core/config.hpp>
 #include <category/execution/ethereum/core/block.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
+#include <category/execution/ethereum/core/transaction_view.hpp>
 #include <category/execution/ethereum/core/withdrawal.hpp>
 
 #include <cstdint>
@@ -169,6 +170,16 @@ struct MonadConsensusBlockBody
 static_assert(sizeof(MonadConsensusBlockBody) == 72);
 static_assert(alignof(MonadConsensusBlockBody) == 8);
 
+/// A body validated in a single pass whose transactions reference the
+/// encoded body, see TransactionView. Ommers and withdrawals are few and
+/// small, so they are decoded as usual.
+struct MonadConsensusBlockBodyView
+{
+    std::vector<TransactionView> transactions{};
+    std::vector<BlockHeader> ommers{};
+    std::vector<Withdrawal> withdrawals{};
+};
+
 template <class MonadConsensusBlockHeader>
 struct MonadConsensusBlock
 {
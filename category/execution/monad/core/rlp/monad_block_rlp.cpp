@@ -23,6 +23,7 @@
 #include <category/execution/ethereum/rlp/decode.hpp>
 #include <category/execution/monad/core/rlp/monad_block_rlp.hpp>
 
+#include <utility>
 #include <vector>
 
 MONAD_RLP_ANONYMOUS_NAMESPACE_BEGIN
@@ -174,6 +175,49 @@ decode_consensus_block_body(byte_string_view &enc)
     return body;
 }
 
+Result<MonadConsensusBlockBodyView>
+decode_consensus_block_body_view(byte_string_view &enc)
+{
+    MonadConsensusBlockBodyView body;
+
+    BOOST_OUTCOME_TRY(auto consensus_body_payload, parse_list_metadata(enc));
+    if (MONAD_UNLIKELY(!enc.empty())) {
+        return DecodeError::InputTooLong;
+    }
+
+    BOOST_OUTCOME_TRY(
+        auto execution_payload, parse_list_metadata(consensus_body_payload));
+    if (MONAD_UNLIKELY(!consensus_body_payload.empty())) {
+        return DecodeError::InputTooLong;
+    }
+
+    BOOST_OUTCOME_TRY(
+        body.transactions, decode_transaction_view_list(execution_payload));
+    BOOST_OUTCOME_TRY(
+        body.ommers, decode_block_header_vector(execution_payload));
+    BOOST_OUTCOME_TRY(
+        body.withdrawals, decode_withdrawal_list(execution_payload));
+    if (MONAD_UNLIKELY(!execution_payload.empty())) {
+        return DecodeError::InputTooLong;
+    }
+
+    return body;
+}
+
+Result<MonadConsensusBlockBody>
+materialize_consensus_block_body(MonadConsensusBlockBodyView const &view)
+{
+    MonadConsensusBlockBody body;
+    body.transactions.reserve(view.transactions.size());
+    for (auto const &txn : view.transactions) {
+        BOOST_OUTCOME_TRY(auto materialized, materialize_transaction(txn));
+        body.transactions.emplace_back(std::move(materialized));
+    }
+    body.ommers = view.ommers;
+    body.withdrawals = view.withdrawals;
+    return body;
+}
+
 template <class MonadConsensusBlockHeader>
 Result<MonadConsensusBlockHeader>
 decode_consensus_block_header(byte_string_view &enc)
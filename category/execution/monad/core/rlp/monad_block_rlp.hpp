@@ -24,6 +24,10 @@ MONAD_RLP_NAMESPACE_BEGIN
 
 Result<uint64_t> decode_consensus_block_header_timestamp_s(byte_string_view &);
 Result<MonadConsensusBlockBody> decode_consensus_block_body(byte_string_view &);
+Result<MonadConsensusBlockBodyView>
+decode_consensus_block_body_view(byte_string_view &);
+Result<MonadConsensusBlockBody>
+materialize_consensus_block_body(MonadConsensusBlockBodyView const &);
 template <class MonadConsensusBlockHeader>
 Result<MonadConsensusBlockHeader>
 decode_consensus_block_header(byte_string_view &);
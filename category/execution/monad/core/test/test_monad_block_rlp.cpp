@@ -18,6 +18,11 @@
 #include <category/core/hex.hpp>
 #include <category/execution/ethereum/core/block.hpp>
 #include <category/execution/ethereum/core/rlp/block_rlp.hpp>
+#include <category/execution/ethereum/core/rlp/transaction_rlp.hpp>
+#include <category/execution/ethereum/core/rlp/withdrawal_rlp.hpp>
+#include <category/execution/ethereum/core/transaction.hpp>
+#include <category/execution/ethereum/core/withdrawal.hpp>
+#include <category/execution/ethereum/rlp/encode2.hpp>
 #include <category/execution/monad/chain/monad_testnet.hpp>
 #include <category/execution/monad/core/monad_block.hpp>
 #include <category/execution/monad/core/rlp/monad_block_rlp.hpp>
@@ -181,3 +186,46 @@ TEST(Rlp_Block, MonadConsensusBlock)
     EXPECT_TRUE(consensus_body.ommers.empty());
     EXPECT_TRUE(consensus_body.withdrawals.empty());
 }
+
+TEST(Rlp_Block, MonadConsensusBlockBodyView)
+{
+    static constexpr auto to_addr{
+        0x3535353535353535353535353535353535353535_address};
+    static constexpr auto key{
+        0x0000000000000000000000000000000000000000000000000000000000000007_bytes32};
+
+    Transaction const txn{
+        .sc = {.signature = {.r = 1, .s = 2, .y_parity = 1}, .chain_id = 1},
+        .nonce = 10,
+        .max_fee_per_gas = 30'000'000'000,
+        .gas_limit = 50'000,
+        .to = to_addr,
+        .type = TransactionType::eip1559,
+        .data = byte_string(1000, 0xcd),
+        .access_list = {AccessEntry{to_addr, {key}}},
+        .max_priority_fee_per_gas = 2'000'000'000};
+    Withdrawal const withdrawal{
+        .index = 1, .validator_index = 2, .amount = 3, .recipient = to_addr};
+
+    byte_string const encoded = rlp::encode_list2(rlp::encode_list2(
+        rlp::encode_list2(rlp::encode_string2(rlp::encode_transaction(txn))),
+        rlp::encode_list2(),
+        rlp::encode_list2(rlp::encode_withdrawal(withdrawal))));
+
+    byte_string_view enc{encoded};
+    auto const view = rlp::decode_consensus_block_body_view(enc);
+    ASSERT_FALSE(view.has_error());
+    ASSERT_EQ(view.value().transactions.size(), 1);
+
+    // Calldata is not copied out of the encoded body
+    auto const data = view.value().transactions[0].data;
+    EXPECT_GE(data.data(), encoded.data());
+    EXPECT_LE(data.data() + data.size(), encoded.data() + encoded.size());
+
+    auto const body = rlp::materialize_consensus_block_body(view.value());
+    ASSERT_FALSE(body.has_error());
+    byte_string_view enc2{encoded};
+    EXPECT_EQ(body.value(), rlp::decode_consensus_block_body(enc2).value());
+    EXPECT_EQ(body.value().transactions[0], txn);
+    EXPECT_EQ(body.value().withdrawals[0], withdrawal);
+}
@@ -40,11 +40,16 @@ void commit_block(
     BlockCommitAncillaries const &anc)
 {
     auto add_common_deltas = [&](CommitBuilder &b) {
-        b.add_code(anc.code)
-            .add_receipts(anc.receipts)
-            .add_transactions(anc.transactions, anc.senders)
-            .add_call_frames(anc.call_frames)
-            .add_ommers(anc.ommers);
+        b.add_code(anc.code);
+        if (anc.encoded_outputs != nullptr) {
+            MONAD_ASSERT(anc.encoded_outputs->size() == anc.receipts.size());
+            b.add_transaction_outputs(*anc.encoded_outputs);
+        }
+        else {
+            b.add_receipts(anc.receipts)
+                .add_transactions(anc.transactions, anc.senders);
+        }
+        b.add_call_frames(anc.call_frames).add_ommers(anc.ommers);
         if (anc.withdrawals.has_value()) {
             b.add_withdrawals(anc.withdrawals.value());
         }
@@ -32,6 +32,7 @@ struct Receipt;
 struct Transaction;
 struct Withdrawal;
 struct Db;
+struct EncodedTransactionOutput;
 
 // Per-block ancillary inputs that the dual commit path forwards to the
 // shared CommitBuilder helpers. State deltas are passed separately because
@@ -46,6 +47,9 @@ struct BlockCommitAncillaries
     std::vector<std::vector<CallFrame>> const &call_frames;
     std::vector<BlockHeader> const &ommers;
     std::optional<std::vector<Withdrawal>> const &withdrawals;
+    // Receipt and transaction leaves pre-encoded during execution; when set,
+    // the commit assembles these instead of encoding receipts/transactions
+    std::vector<EncodedTransactionOutput> const *encoded_outputs{nullptr};
 };
 
 template <Traits traits>
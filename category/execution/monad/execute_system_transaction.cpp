@@ -42,8 +42,9 @@
 #include <evmc/evmc.h>
 
 #include <cstdint>
-
+#include <memory>
 #include <optional>
+#include <utility>
 
 MONAD_NAMESPACE_BEGIN
 
@@ -102,25 +103,32 @@ Result<Receipt> ExecuteSystemTransaction<traits>::operator()()
     {
         TRACE_TXN_EVENT(StartExecution);
 
-        State state{block_state_, Incarnation{header_.number, i_ + 1}};
-        state.set_original_nonce(sender_, tx_.nonce);
+        auto state = std::make_shared<State>(
+            block_state_, Incarnation{header_.number, i_ + 1});
+        state->set_original_nonce(sender_, tx_.nonce);
 
         call_tracer_.reset();
         trace::reset(state_tracer_);
 
-        auto result = execute(state);
+        auto result = execute(*state);
 
         {
             TRACE_TXN_EVENT(StartStall);
             prev_.get_future().wait();
         }
 
-        if (block_state_.can_merge(state)) {
+        if (block_state_.can_merge(*state)) {
             if (result.has_error()) {
                 return std::move(result.error());
             }
-            auto const receipt = execute_final(state);
-            block_state_.merge(state);
+            auto const receipt = execute_final(*state);
+            block_state_.merge(*state);
+            record_txn_output_events(
+                exec_recorder_,
+                static_cast<uint32_t>(i_),
+                receipt,
+                call_tracer_.get_call_frames(),
+                std::move(state));
             return receipt;
         }
     }
@@ -128,19 +136,26 @@ Result<Receipt> ExecuteSystemTransaction<traits>::operator()()
     {
         TRACE_TXN_EVENT(StartRetry);
 
-        State state{block_state_, Incarnation{header_.number, i_ + 1}};
+        auto state = std::make_shared<State>(
+            block_state_, Incarnation{header_.number, i_ + 1});
 
         call_tracer_.reset();
         trace::reset(state_tracer_);
 
-        auto result = execute(state);
+        auto result = execute(*state);
 
-        MONAD_ASSERT(block_state_.can_merge(state));
+        MONAD_ASSERT(block_state_.can_merge(*state));
         if (result.has_error()) {
             return std::move(result.error());
         }
-        auto const receipt = execute_final(state);
-        block_state_.merge(state);
+        auto const receipt = execute_final(*state);
+        block_state_.merge(*state);
+        record_txn_output_events(
+            exec_recorder_,
+            static_cast<uint32_t>(i_),
+            receipt,
+            call_tracer_.get_call_frames(),
+            std::move(state));
         return receipt;
     }
 }
@@ -196,12 +211,6 @@ Receipt ExecuteSystemTransaction<traits>::execute_final(State &state)
     }
     call_tracer_.on_finish(receipt.gas_used);
     trace::run_tracer<traits>(state_tracer_, state);
-    record_txn_output_events(
-        exec_recorder_,
-        static_cast<uint32_t>(this->i_),
-        receipt,
-        call_tracer_.get_call_frames(),
-        state);
     return receipt;
 }
 
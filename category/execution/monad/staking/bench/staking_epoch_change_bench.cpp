@@ -0,0 +1,218 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Benchmark for the storage reads of StakingContract::syscall_on_epoch_change.
+//
+// Populates an on-disk db with a synthetic validator set, then for each
+// iteration measures on a fresh BlockState:
+//   - sequential: one State::get_storage per slot touched by the syscall
+//   - prefetch:   the same slots loaded with one State::prefetch_storage
+//   - syscall:    the full epoch change, which prefetches internally
+
+#include <category/core/assert.h>
+#include <category/core/bytes.hpp>
+#include <category/core/int.hpp>
+#include <category/execution/ethereum/core/account.hpp>
+#include <category/execution/ethereum/core/block.hpp>
+#include <category/execution/ethereum/core/contract/abi_encode.hpp>
+#include <category/execution/ethereum/core/contract/big_endian.hpp>
+#include <category/execution/ethereum/db/test/commit_simple.hpp>
+#include <category/execution/ethereum/db/trie_db.hpp>
+#include <category/execution/ethereum/state2/block_state.hpp>
+#include <category/execution/ethereum/state2/state_deltas.hpp>
+#include <category/execution/ethereum/state3/state.hpp>
+#include <category/execution/ethereum/trace/call_tracer.hpp>
+#include <category/execution/ethereum/types/incarnation.hpp>
+#include <category/execution/monad/staking/staking_contract.hpp>
+#include <category/execution/monad/staking/util/constants.hpp>
+#include <category/mpt/db.hpp>
+#include <category/mpt/ondisk_db_config.hpp>
+#include <category/vm/vm.hpp>
+
+#include <CLI/CLI.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+using namespace monad;
+using namespace monad::staking;
+using namespace monad::test;
+
+namespace
+{
+    constexpr u64_be START_EPOCH{1};
+
+    void populate(TrieDb &tdb, vm::VM &vm, uint64_t const num_validators)
+    {
+        commit_simple(
+            tdb,
+            StateDeltas(
+                {{STAKING_CA,
+                  StateDelta{
+                      .account =
+                          {std::nullopt, Account{.balance = 0, .nonce = 1}}}}}),
+            Code{},
+            NULL_HASH_BLAKE3,
+            BlockHeader{});
+        tdb.finalize(0, NULL_HASH_BLAKE3);
+        tdb.set_block_and_prefix(0);
+
+        BlockState bs{tdb, vm};
+        {
+            State state{bs, Incarnation{1, 0}};
+            NoopCallTracer call_tracer{};
+            StakingContract contract{state, call_tracer};
+            state.add_to_balance(STAKING_CA, 0);
+            contract.vars.epoch.store(START_EPOCH);
+            for (uint64_t id = 1; id <= num_validators; ++id) {
+                u64_be const val_id{id};
+                contract.vars.valset_snapshot.push(val_id);
+                contract.vars.val_execution(val_id)
+                    .accumulated_reward_per_token()
+                    .store(u256_be{id});
+                for (uint64_t const epoch : {2, 3}) {
+                    contract.vars
+                        .accumulated_reward_per_token(epoch, val_id)
+                        .store({.value = {}, .refcount = u256_be{1}});
+                }
+            }
+            MONAD_ASSERT(bs.can_merge(state));
+            bs.merge(state);
+        }
+        auto [state_deltas, code, _] = std::move(bs).release();
+        commit_simple(
+            tdb,
+            *state_deltas,
+            code,
+            bytes32_t{1},
+            BlockHeader{.number = 1});
+        tdb.finalize(1, bytes32_t{1});
+        tdb.set_block_and_prefix(1);
+    }
+
+    std::vector<bytes32_t> epoch_change_keys(StakingContract &contract)
+    {
+        std::vector<bytes32_t> keys;
+        auto const add_keys = [&keys](auto const &var) {
+            auto const var_keys = var.keys();
+            keys.insert(keys.end(), var_keys.begin(), var_keys.end());
+        };
+        auto &vars = contract.vars;
+        uint64_t const num_validators = vars.valset_snapshot.length();
+        for (uint64_t i = 0; i < num_validators; ++i) {
+            add_keys(vars.valset_snapshot.get(i));
+        }
+        for (uint64_t i = 0; i < num_validators; ++i) {
+            auto const val_id = vars.valset_snapshot.get(i).load();
+            add_keys(vars.val_execution(val_id).accumulated_reward_per_token());
+            add_keys(vars.accumulated_reward_per_token(u64_be{2}, val_id));
+            add_keys(vars.accumulated_reward_per_token(u64_be{3}, val_id));
+        }
+        return keys;
+    }
+
+    enum class Mode
+    {
+        sequential,
+        prefetch,
+        syscall
+    };
+
+    double run_once(
+        TrieDb &tdb, vm::VM &vm, Mode const mode,
+        std::vector<bytes32_t> const &keys)
+    {
+        BlockState bs{tdb, vm};
+        State state{bs, Incarnation{2, 0}};
+        NoopCallTracer call_tracer{};
+        StakingContract contract{state, call_tracer};
+        (void)state.get_balance(STAKING_CA);
+
+        auto const begin = std::chrono::steady_clock::now();
+        switch (mode) {
+        case Mode::sequential:
+            for (auto const &key : keys) {
+                (void)state.get_storage(STAKING_CA, key);
+            }
+            break;
+        case Mode::prefetch:
+            state.prefetch_storage(STAKING_CA, keys);
+            break;
+        case Mode::syscall: {
+            auto const input = abi_encode_uint(u64_be{2});
+            auto const res = contract.syscall_on_epoch_change(
+                byte_string_view{input.bytes, sizeof(input)}, 0);
+            MONAD_ASSERT(!res.has_error());
+            break;
+        }
+        }
+        auto const end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - begin).count();
+    }
+}
+
+int main(int const argc, char const *argv[])
+{
+    uint64_t num_validators = 1000;
+    unsigned iterations = 10;
+
+    CLI::App cli(
+        "Benchmark for the storage reads of the staking epoch change",
+        "staking_epoch_change_bench");
+    cli.add_option(
+        "--validators", num_validators, "Size of the validator set snapshot");
+    cli.add_option("--iterations", iterations, "Iterations per mode");
+    try {
+        cli.parse(argc, argv);
+    }
+    catch (CLI::ParseError const &e) {
+        return cli.exit(e);
+    }
+
+    vm::VM vm;
+    mpt::Db db{std::make_unique<OnDiskMachine>(), mpt::OnDiskDbConfig{}};
+    TrieDb tdb{db};
+    populate(tdb, vm, num_validators);
+
+    std::vector<bytes32_t> keys;
+    {
+        BlockState bs{tdb, vm};
+        State state{bs, Incarnation{2, 0}};
+        NoopCallTracer call_tracer{};
+        StakingContract contract{state, call_tracer};
+        (void)state.get_balance(STAKING_CA);
+        keys = epoch_change_keys(contract);
+    }
+
+    std::cout << "validators: " << num_validators
+              << ", storage slots: " << keys.size() << std::endl;
+    for (auto const [mode, name] :
+         {std::pair{Mode::sequential, "sequential"},
+          std::pair{Mode::prefetch, "prefetch"},
+          std::pair{Mode::syscall, "syscall"}}) {
+        double total = 0;
+        for (unsigned i = 0; i < iterations; ++i) {
+            total += run_once(tdb, vm, mode, keys);
+        }
+        std::cout << "  " << name << ": " << total / iterations << " us"
+                  << std::endl;
+    }
+    return 0;
+}
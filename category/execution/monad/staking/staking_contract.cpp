@@ -42,6 +42,7 @@
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <vector>
 
 MONAD_STAKING_ANONYMOUS_NAMESPACE_BEGIN
 using namespace monad::literals;
@@ -1623,6 +1624,42 @@ Result<byte_string> StakingContract::precompile_external_reward(
 //  System Calls  //
 ////////////////////
 
+std::vector<u64_be> StakingContract::prefetch_epoch_change_storage(
+    u64_be const next_epoch, u64_be const next_next_epoch)
+{
+    std::vector<bytes32_t> keys;
+    auto const add_keys = [&keys](auto const &var) {
+        auto const var_keys = var.keys();
+        keys.insert(keys.end(), var_keys.begin(), var_keys.end());
+    };
+
+    // 1. validator ids of the snapshot
+    auto const valset = vars.valset_snapshot;
+    uint64_t const num_active_vals = valset.length();
+    keys.reserve(num_active_vals);
+    for (uint64_t i = 0; i < num_active_vals; ++i) {
+        add_keys(valset.get(i));
+    }
+    state_.prefetch_storage(STAKING_CA, keys);
+
+    std::vector<u64_be> val_ids;
+    val_ids.reserve(num_active_vals);
+    for (uint64_t i = 0; i < num_active_vals; ++i) {
+        val_ids.push_back(valset.get(i).load());
+    }
+
+    // 2. per validator reward accumulators
+    keys.clear();
+    for (auto const &val_id : val_ids) {
+        add_keys(vars.val_execution(val_id).accumulated_reward_per_token());
+        add_keys(vars.accumulated_reward_per_token(next_epoch, val_id));
+        add_keys(vars.accumulated_reward_per_token(next_next_epoch, val_id));
+    }
+    state_.prefetch_storage(STAKING_CA, keys);
+
+    return val_ids;
+}
+
 Result<void> StakingContract::syscall_on_epoch_change(
     byte_string_view input, uint256_t const &value)
 {
@@ -1646,10 +1683,9 @@ Result<void> StakingContract::syscall_on_epoch_change(
 
     emit_epoch_changed_event(last_epoch, next_epoch);
 
-    auto const valset = vars.valset_snapshot;
-    uint64_t const num_active_vals = valset.length();
-    for (uint64_t i = 0; i < num_active_vals; ++i) {
-        auto const val_id = valset.get(i).load();
+    std::vector<u64_be> const valset =
+        prefetch_epoch_change_storage(next_epoch, next_next_epoch);
+    for (auto const &val_id : valset) {
         auto val = vars.val_execution(val_id);
 
         // TODO: once Maged's speculative execution is merged, move this
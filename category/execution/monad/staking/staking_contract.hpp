@@ -37,6 +37,7 @@
 #include <cstdint>
 #include <optional>
 #include <string_view>
+#include <vector>
 
 MONAD_NAMESPACE_BEGIN
 
@@ -538,6 +539,10 @@ private:
     template <Traits traits>
     Result<void> delegate(u64_be, uint256_t const &, Address const &);
 
+    // Batch loads the storage touched by syscall_on_epoch_change so that its
+    // per validator reads hit the State cache. Returns the valset snapshot.
+    std::vector<u64_be> prefetch_epoch_change_storage(u64_be, u64_be);
+
     // Helper function for getting a valset. used by the three valset getters.
     Result<byte_string>
     get_valset(byte_string_view, StorageArray<u64_be> const &);
@@ -0,0 +1,306 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "ledger_watcher.hpp"
+#include "file_io.hpp"
+
+#include <category/core/assert.h>
+#include <category/core/blake3.hpp>
+#include <category/core/hex.hpp>
+#include <category/core/log.hpp>
+#include <category/execution/monad/chain/monad_chain.hpp>
+#include <category/execution/monad/core/rlp/monad_block_rlp.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+MONAD_NAMESPACE_BEGIN
+
+namespace
+{
+    // Consensus writes ledger files in place or renames them into the
+    // directory; either way the file is complete once one of these fires.
+    // Head pointer updates only wake the runloop.
+    constexpr uint32_t WATCH_MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+    constexpr uint32_t COMPLETE_MASK = IN_CLOSE_WRITE | IN_MOVED_TO;
+
+    // How often the runloop polls the ledger when the headers directory,
+    // which also holds the head pointers, cannot be watched
+    constexpr auto UNWATCHED_POLL_TIME = std::chrono::microseconds(100);
+}
+
+LedgerWatcher::LedgerWatcher(
+    MonadChain const &chain, std::filesystem::path const &ledger_dir,
+    size_t const header_capacity, size_t const body_capacity)
+    : chain_{chain}
+    , header_dir_{ledger_dir / "headers"}
+    , body_dir_{ledger_dir / "bodies"}
+    , header_capacity_{header_capacity}
+    , body_capacity_{body_capacity}
+    , body_bytes_{0}
+    , inotify_fd_{inotify_init1(IN_NONBLOCK | IN_CLOEXEC)}
+    , header_wd_{-1}
+    , body_wd_{-1}
+{
+    MONAD_ASSERT(header_capacity_ > 0);
+    MONAD_ASSERT_PRINTF(
+        inotify_fd_ != -1, "inotify_init1 failed: %s", strerror(errno));
+    header_wd_ = add_watch(header_dir_);
+    body_wd_ = add_watch(body_dir_);
+}
+
+LedgerWatcher::~LedgerWatcher()
+{
+    (void)close(inotify_fd_);
+}
+
+int LedgerWatcher::add_watch(std::filesystem::path const &dir)
+{
+    int const wd = inotify_add_watch(inotify_fd_, dir.c_str(), WATCH_MASK);
+    if (MONAD_UNLIKELY(wd == -1)) {
+        // Without a header watch wait() polls at UNWATCHED_POLL_TIME, and
+        // without a body watch bodies are read on demand
+        LOG_WARNING(
+            "Not watching ledger directory {}: {}",
+            dir.string(),
+            strerror(errno));
+    }
+    return wd;
+}
+
+LedgerWatcher::Header const &LedgerWatcher::header(bytes32_t const &id)
+{
+    if (auto const it = headers_.find(id); it != headers_.end()) {
+        return it->second.header;
+    }
+    auto const data = read_file(id, header_dir_);
+    return insert_header(id, decode_header(id, data));
+}
+
+MonadConsensusBlockBody LedgerWatcher::take_body(bytes32_t const &id)
+{
+    if (auto const it = bodies_.find(id); it != bodies_.end()) {
+        auto res = rlp::materialize_consensus_block_body(it->second.body);
+        MONAD_ASSERT_PRINTF(
+            !res.has_error(),
+            "Could not materialize body: %s",
+            to_hex(id).c_str());
+        body_bytes_ -= it->second.data->size();
+        bodies_.erase(it);
+        return std::move(res.value());
+    }
+    return read_body(id, body_dir_);
+}
+
+void LedgerWatcher::finalize(uint64_t const seqno)
+{
+    // A body is only reachable through its header, so it goes with it
+    std::erase_if(
+        headers_,
+        [this, seqno](std::pair<bytes32_t, CachedHeader> const &entry) {
+            if (entry.second.seqno >= seqno) {
+                return false;
+            }
+            bytes32_t const body_id = std::visit(
+                [](auto const &h) { return h.block_body_id; },
+                entry.second.header);
+            if (auto const it = bodies_.find(body_id); it != bodies_.end()) {
+                body_bytes_ -= it->second.data->size();
+                bodies_.erase(it);
+            }
+            return true;
+        });
+}
+
+void LedgerWatcher::wait(std::chrono::milliseconds const timeout)
+{
+    if (MONAD_UNLIKELY(header_wd_ == -1)) {
+        std::this_thread::sleep_for(
+            std::min<std::chrono::microseconds>(timeout, UNWATCHED_POLL_TIME));
+        drain_events();
+        return;
+    }
+    pollfd pfd{.fd = inotify_fd_, .events = POLLIN, .revents = 0};
+    int const r = poll(&pfd, 1, static_cast<int>(timeout.count()));
+    MONAD_ASSERT_PRINTF(
+        r != -1 || errno == EINTR, "poll failed: %s", strerror(errno));
+    if (r > 0) {
+        drain_events();
+    }
+}
+
+void LedgerWatcher::drain_events()
+{
+    alignas(inotify_event) char buf[4096];
+    while (true) {
+        auto const n = read(inotify_fd_, buf, sizeof(buf));
+        if (n == -1) {
+            MONAD_ASSERT_PRINTF(
+                errno == EAGAIN || errno == EINTR,
+                "inotify read failed: %s",
+                strerror(errno));
+            return;
+        }
+        for (char const *p = buf; p < buf + n;) {
+            auto const *const event =
+                reinterpret_cast<inotify_event const *>(p);
+            p += sizeof(inotify_event) + event->len;
+
+            // An overflowed queue loses nothing: the runloop walks the
+            // ledger from the head pointers and reads what is not cached
+            if (!(event->mask & COMPLETE_MASK) || event->len == 0) {
+                continue;
+            }
+            std::string_view const name{event->name};
+            if (name.size() != 2 * sizeof(bytes32_t)) {
+                continue;
+            }
+            auto const id = from_hex<bytes32_t>(name);
+            if (!id.has_value()) {
+                continue;
+            }
+            if (event->wd == header_wd_) {
+                prefetch_header(id.value());
+            }
+            else if (event->wd == body_wd_) {
+                prefetch_body(id.value());
+            }
+        }
+    }
+}
+
+void LedgerWatcher::prefetch_header(bytes32_t const &id)
+{
+    if (headers_.contains(id)) {
+        return;
+    }
+    auto const data = try_read_file(id, header_dir_);
+    if (data.has_value()) {
+        insert_header(id, decode_header(id, data.value()));
+    }
+}
+
+void LedgerWatcher::prefetch_body(bytes32_t const &id)
+{
+    if (bodies_.contains(id)) {
+        return;
+    }
+    auto data = try_read_file(id, body_dir_);
+    if (!data.has_value()) {
+        return;
+    }
+    auto encoded = std::make_unique<byte_string const>(std::move(data.value()));
+    byte_string_view view{*encoded};
+    auto res = rlp::decode_consensus_block_body_view(view);
+    MONAD_ASSERT_PRINTF(
+        !res.has_error(), "Could not rlp decode body: %s", to_hex(id).c_str());
+    insert_body(
+        id,
+        CachedBody{.data = std::move(encoded), .body = std::move(res.value())});
+}
+
+std::optional<byte_string> LedgerWatcher::try_read_file(
+    bytes32_t const &id, std::filesystem::path const &dir) const
+{
+    std::ifstream is(dir / to_hex(id));
+    if (!is) {
+        return std::nullopt;
+    }
+    byte_string data{
+        std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+    // A file that is still being written is picked up on a later event or
+    // read by the runloop once a head pointer references it
+    if (to_bytes(blake3(data)) != id) {
+        return std::nullopt;
+    }
+    return data;
+}
+
+LedgerWatcher::Header LedgerWatcher::decode_header(
+    bytes32_t const &id, byte_string_view const data) const
+{
+    byte_string_view ts_view{data};
+    auto const ts = rlp::decode_consensus_block_header_timestamp_s(ts_view);
+    MONAD_ASSERT_PRINTF(
+        !ts.has_error(),
+        "Could not rlp decode timestamp from header: %s",
+        to_hex(id).c_str());
+
+    auto const decode = [&]<class MonadConsensusBlockHeader>() -> Header {
+        byte_string_view view{data};
+        auto const res =
+            rlp::decode_consensus_block_header<MonadConsensusBlockHeader>(
+                view);
+        MONAD_ASSERT_PRINTF(
+            !res.has_error(),
+            "Could not rlp decode header: %s",
+            to_hex(id).c_str());
+        return res.value();
+    };
+
+    auto const rev = chain_.get_monad_revision(ts.value());
+    if (rev >= MONAD_FOUR) {
+        return decode.template operator()<MonadConsensusBlockHeaderV2>();
+    }
+    if (rev >= MONAD_THREE) {
+        return decode.template operator()<MonadConsensusBlockHeaderV1>();
+    }
+    return decode.template operator()<MonadConsensusBlockHeaderV0>();
+}
+
+LedgerWatcher::Header const &
+LedgerWatcher::insert_header(bytes32_t const &id, Header header)
+{
+    uint64_t const seqno =
+        std::visit([](auto const &h) { return h.seqno; }, header);
+    // Only full with blocks that never get finalized, e.g. abandoned
+    // proposals, so which entry goes does not matter
+    if (headers_.size() >= header_capacity_) {
+        headers_.erase(headers_.begin());
+    }
+    auto const [it, inserted] = headers_.emplace(
+        id, CachedHeader{.seqno = seqno, .header = std::move(header)});
+    MONAD_ASSERT(inserted);
+    return it->second.header;
+}
+
+void LedgerWatcher::insert_body(bytes32_t const &id, CachedBody body)
+{
+    size_t const size = body.data->size();
+    // A body larger than the whole cache is read again when executed
+    if (size > body_capacity_) {
+        return;
+    }
+    while (body_bytes_ + size > body_capacity_) {
+        auto const it = bodies_.begin();
+        body_bytes_ -= it->second.data->size();
+        bodies_.erase(it);
+    }
+    body_bytes_ += size;
+    bodies_.emplace(id, std::move(body));
+}
+
+MONAD_NAMESPACE_END
@@ -0,0 +1,125 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <category/core/byte_string.hpp>
+#include <category/core/bytes.hpp>
+#include <category/core/config.hpp>
+#include <category/execution/monad/core/monad_block.hpp>
+
+#include <ankerl/unordered_dense.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <variant>
+
+MONAD_NAMESPACE_BEGIN
+
+struct MonadChain;
+
+/// Watches the `headers` and `bodies` directories of the consensus ledger
+/// with inotify, and caches the decoded contents of the files in them by
+/// block id. Files announced by inotify are decoded ahead of being asked
+/// for, and `wait` returns as soon as consensus writes a new file or moves
+/// a head pointer, instead of the runloop polling the directories.
+///
+/// Headers are capped by count. Bodies are validated when prefetched but
+/// kept encoded, with their transactions as views of the encoding, so they
+/// are capped by the size of that encoding. Both are dropped once their
+/// header falls below the finalized block.
+class LedgerWatcher
+{
+public:
+    using Header = std::variant<
+        MonadConsensusBlockHeaderV0, MonadConsensusBlockHeaderV1,
+        MonadConsensusBlockHeaderV2>;
+
+    LedgerWatcher(
+        MonadChain const &, std::filesystem::path const &ledger_dir,
+        size_t header_capacity = 1024, size_t body_capacity = 256 << 20);
+    ~LedgerWatcher();
+
+    LedgerWatcher(LedgerWatcher const &) = delete;
+    LedgerWatcher &operator=(LedgerWatcher const &) = delete;
+
+    std::filesystem::path const &header_dir() const noexcept
+    {
+        return header_dir_;
+    }
+
+    std::filesystem::path const &body_dir() const noexcept
+    {
+        return body_dir_;
+    }
+
+    /// Decoded header, read from disk on a cache miss. The reference is
+    /// invalidated by the next call into the watcher.
+    Header const &header(bytes32_t const &id);
+
+    /// Decoded body, read from disk on a cache miss. Bodies are executed
+    /// once, so the cache entry is materialized and dropped.
+    MonadConsensusBlockBody take_body(bytes32_t const &id);
+
+    /// Drop the headers and bodies of blocks below a newly finalized block
+    void finalize(uint64_t seqno);
+
+    /// Block until the ledger changes or `timeout` elapses, decoding the
+    /// files written in the meantime. If the headers directory is not
+    /// watched, return after a short sleep so the caller keeps polling.
+    void wait(std::chrono::milliseconds timeout);
+
+private:
+    struct CachedHeader
+    {
+        uint64_t seqno;
+        Header header;
+    };
+
+    struct CachedBody
+    {
+        // Referenced by the views in `body`, so it must not move
+        std::unique_ptr<byte_string const> data;
+        MonadConsensusBlockBodyView body;
+    };
+
+    int add_watch(std::filesystem::path const &);
+    void drain_events();
+    void prefetch_header(bytes32_t const &);
+    void prefetch_body(bytes32_t const &);
+    std::optional<byte_string>
+    try_read_file(bytes32_t const &, std::filesystem::path const &) const;
+    Header decode_header(bytes32_t const &, byte_string_view) const;
+    Header const &insert_header(bytes32_t const &, Header);
+    void insert_body(bytes32_t const &, CachedBody);
+
+    MonadChain const &chain_;
+    std::filesystem::path header_dir_;
+    std::filesystem::path body_dir_;
+    size_t header_capacity_;
+    size_t body_capacity_;
+    size_t body_bytes_;
+    int inotify_fd_;
+    int header_wd_;
+    int body_wd_;
+    ankerl::unordered_dense::segmented_map<bytes32_t, CachedHeader> headers_;
+    ankerl::unordered_dense::segmented_map<bytes32_t, CachedBody> bodies_;
+};
+
+MONAD_NAMESPACE_END
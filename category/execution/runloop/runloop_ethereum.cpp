@@ -161,6 +161,7 @@ Result<void> process_ethereum_block(
     BlockState block_state(db, vm);
 
     ChainContext<traits> const chain_ctx{};
+    std::vector<EncodedTransactionOutput> encoded_outputs;
     record_block_marker_event(exec_recorder, MONAD_EXEC_BLOCK_PERF_EVM_ENTER);
     BOOST_OUTCOME_TRY(
         auto const receipts,
@@ -177,7 +178,9 @@ Result<void> process_ethereum_block(
             state_tracers,
             system_call_state_tracer,
             chain_ctx,
-            exec_recorder));
+            exec_recorder,
+            /*trace_transfers=*/false,
+            &encoded_outputs));
     record_block_marker_event(exec_recorder, MONAD_EXEC_BLOCK_PERF_EVM_EXIT);
 
     // Database commit of state changes (incl. Merkle root calculations)
@@ -188,8 +191,7 @@ Result<void> process_ethereum_block(
     CommitBuilder builder(block.header.number);
     builder.add_state_deltas(*state)
         .add_code(code)
-        .add_receipts(receipts)
-        .add_transactions(block.transactions, senders)
+        .add_transaction_outputs(encoded_outputs)
         .add_call_frames(call_frames)
         .add_ommers(block.ommers);
     if (block.withdrawals.has_value()) {
@@ -15,15 +15,18 @@
 
 #include "runloop_monad.hpp"
 #include "file_io.hpp"
+#include "ledger_watcher.hpp"
 
 #include <category/core/assert.h>
 #include <category/core/blake3.hpp>
 #include <category/core/bytes.hpp>
 #include <category/core/config.hpp>
+#include <category/core/fiber/fiber_group.hpp>
 #include <category/core/fiber/priority_pool.hpp>
 #include <category/core/hex.hpp>
 #include <category/core/keccak.hpp>
 #include <category/core/log.hpp>
+#include <category/core/metrics/metrics.hpp>
 #include <category/core/procfs/statm.h>
 #include <category/execution/ethereum/block_hash_buffer.hpp>
 #include <category/execution/ethereum/core/block.hpp>
@@ -45,7 +48,6 @@
 #include <category/execution/ethereum/validate_transaction.hpp>
 #include <category/execution/monad/chain/monad_chain.hpp>
 #include <category/execution/monad/core/monad_block.hpp>
-#include <category/execution/monad/core/rlp/monad_block_rlp.hpp>
 #include <category/execution/monad/db/commit_block_migration.hpp>
 #include <category/execution/monad/event/record_consensus_events.hpp>
 #include <category/execution/monad/reserve_balance.hpp>
@@ -62,8 +64,8 @@
 #include <chrono>
 #include <deque>
 #include <filesystem>
+#include <future>
 #include <optional>
-#include <thread>
 #include <variant>
 #include <vector>
 
@@ -86,6 +88,12 @@ using BlockCache =
 static ankerl::unordered_dense::segmented_set<Address>
     empty_senders_and_authorities{};
 
+// Queued proposals recover their senders on a fiber group of their own, so
+// that the transactions of the proposal executing ahead of them are not
+// queued behind the recovery tasks. This priority puts recovery fibers
+// behind transaction fibers ready to run on the shared threads.
+constexpr uint64_t QUEUED_RECOVERY_PRIORITY = uint64_t{1} << 32;
+
 void log_tps(
     uint64_t const block_num, bytes32_t const &block_id, uint64_t const ntxs,
     uint64_t const gas, std::chrono::steady_clock::time_point const begin)
@@ -113,6 +121,35 @@ void log_tps(
 
 #pragma GCC diagnostic pop
 
+struct RecoveredBody
+{
+    MonadConsensusBlockBody body;
+    std::vector<std::optional<Address>> senders;
+    std::vector<std::vector<std::optional<Address>>> authorities;
+};
+
+// Signature recovery only depends on the body, so it can overlap the
+// execution and commit of the proposals ahead in the queue, which are its
+// ancestors and leave the pool partly idle while merkleizing
+std::future<RecoveredBody> recover_body_async(
+    MonadConsensusBlockBody body, fiber::FiberGroup &recovery_group)
+{
+    return std::async(
+        std::launch::async,
+        [body = std::move(body), &recovery_group]() mutable {
+            RecoveredBody recovered{.body = std::move(body)};
+            recovered.senders = recover_senders(
+                recovered.body.transactions,
+                recovery_group,
+                QUEUED_RECOVERY_PRIORITY);
+            recovered.authorities = recover_authorities(
+                recovered.body.transactions,
+                recovery_group,
+                QUEUED_RECOVERY_PRIORITY);
+            return recovered;
+        });
+}
+
 template <class MonadConsensusBlockHeader>
 bool has_executed(
     mpt::Db const &db, MonadConsensusBlockHeader const &header,
@@ -180,6 +217,10 @@ template <Traits traits, class MonadConsensusBlockHeader>
 Result<BlockExecOutput> propose_block(
     bytes32_t const &block_id,
     MonadConsensusBlockHeader const &consensus_header, Block block,
+    std::vector<std::optional<Address>> const &recovered_senders,
+    std::vector<std::vector<std::optional<Address>>> const
+        &recovered_authorities,
+    std::chrono::microseconds const sender_recovery_time,
     BlockHashChain &block_hash_chain, MonadChain const &chain, Db &db,
     vm::VM &vm, fiber::PriorityPool &priority_pool, bool const is_first_block,
     bool const enable_tracing, BlockCache &block_cache,
@@ -195,15 +236,8 @@ Result<BlockExecOutput> propose_block(
     BOOST_OUTCOME_TRY(static_validate_consensus_header(consensus_header));
     BOOST_OUTCOME_TRY(static_validate_block<traits>(chain, block));
 
-    // Sender and EIP-7702 authorities recovery
-    auto const sender_recovery_begin = std::chrono::steady_clock::now();
-    auto const recovered_senders =
-        recover_senders(block.transactions, priority_pool);
-    auto const recovered_authorities =
-        recover_authorities(block.transactions, priority_pool);
-    [[maybe_unused]] auto const sender_recovery_time =
-        std::chrono::duration_cast<std::chrono::microseconds>(
-            std::chrono::steady_clock::now() - sender_recovery_begin);
+    // Sender and EIP-7702 authorities recovery, started by the runloop
+    // while the proposal ahead of this one executed
     std::vector<Address> senders(block.transactions.size());
     for (unsigned i = 0; i < recovered_senders.size(); ++i) {
         if (recovered_senders[i].has_value()) {
@@ -304,6 +338,7 @@ Result<BlockExecOutput> propose_block(
     BlockMetrics block_metrics;
 
     BlockState block_state(db, vm, secondary_db);
+    std::vector<EncodedTransactionOutput> encoded_outputs;
     record_block_marker_event(exec_recorder, MONAD_EXEC_BLOCK_PERF_EVM_ENTER);
     BOOST_OUTCOME_TRY(
         auto const results,
@@ -320,7 +355,9 @@ Result<BlockExecOutput> propose_block(
             state_tracers,
             system_call_state_tracer,
             chain_context,
-            exec_recorder));
+            exec_recorder,
+            /*trace_transfers=*/false,
+            &encoded_outputs));
     record_block_marker_event(exec_recorder, MONAD_EXEC_BLOCK_PERF_EVM_EXIT);
 
     // Database commit of state changes (incl. Merkle root calculations)
@@ -339,7 +376,8 @@ Result<BlockExecOutput> propose_block(
         .senders = senders,
         .call_frames = call_frames,
         .ommers = block.ommers,
-        .withdrawals = block.withdrawals};
+        .withdrawals = block.withdrawals,
+        .encoded_outputs = &encoded_outputs};
     commit_block<traits>(db, secondary_db, block_id, block.header, *state, anc);
     [[maybe_unused]] auto const commit_time =
         std::chrono::duration_cast<std::chrono::microseconds>(
@@ -388,6 +426,17 @@ Result<BlockExecOutput> propose_block(
     [[maybe_unused]] auto const block_time =
         std::chrono::duration_cast<std::chrono::microseconds>(
             std::chrono::steady_clock::now() - block_begin);
+    metrics::add(metrics::Counter::blocks_executed);
+    metrics::add(
+        metrics::Counter::transactions_executed, block.transactions.size());
+    metrics::add(
+        metrics::Counter::transaction_retries, block_metrics.num_retries);
+    metrics::record(
+        metrics::Histogram::block_sender_recovery, sender_recovery_time);
+    metrics::record(
+        metrics::Histogram::block_tx_exec, block_metrics.tx_exec_time);
+    metrics::record(metrics::Histogram::block_commit, commit_time);
+    metrics::record(metrics::Histogram::block_total, block_time);
     LOG_INFO(
         "__exec_block,bl={:8},id={},ts={}"
         ",tx={:5},rt={:4},rtp={:5.2f}%"
@@ -422,32 +471,13 @@ Result<BlockExecOutput> propose_block(
     return exec_output;
 }
 
-template <class MonadConsensusBlockHeader, class Fn>
-std::optional<bytes32_t> handle_header(
-    bytes32_t const &id, byte_string_view data, uint64_t const start_exclusive,
-    uint64_t const end_inclusive, Fn const &fn)
-{
-    auto const header_res =
-        rlp::decode_consensus_block_header<MonadConsensusBlockHeader>(data);
-    MONAD_ASSERT_PRINTF(
-        !header_res.has_error(),
-        "Could not rlp decode header: %s",
-        to_hex(id).c_str());
-    auto const &header = header_res.value();
-    if (header.seqno > start_exclusive && header.seqno <= end_inclusive) {
-        fn(id, header);
-    }
-    if (header.seqno <= (start_exclusive + 1)) {
-        return std::nullopt;
-    }
-    return header.parent_id();
-}
-
+// Walks the ledger from `head` down to the first block after
+// `start_exclusive`, calling `fn` on the headers of the blocks up to
+// `end_inclusive`
 template <class Fn>
 bytes32_t for_each_header(
-    std::filesystem::path const &head, std::filesystem::path const &header_dir,
-    MonadChain const &chain, uint64_t const start_exclusive,
-    uint64_t const end_inclusive, Fn const &fn)
+    std::filesystem::path const &head, LedgerWatcher &ledger,
+    uint64_t const start_exclusive, uint64_t const end_inclusive, Fn const &fn)
 {
     bytes32_t const head_id = head_pointer_to_id(head);
     if (MONAD_UNLIKELY(head_id == bytes32_t{})) {
@@ -455,44 +485,22 @@ bytes32_t for_each_header(
     }
     bytes32_t id = head_id;
     while (true) {
-        auto const data = read_file(id, header_dir);
-        byte_string_view view{data};
-        auto const ts = rlp::decode_consensus_block_header_timestamp_s(view);
-        MONAD_ASSERT_PRINTF(
-            !ts.has_error(),
-            "Could not rlp decode timestamp from header: %s",
-            to_hex(id).c_str());
-        auto const rev = chain.get_monad_revision(ts.value());
-
-        auto const body = [&]<Traits traits> {
-            std::optional<bytes32_t> next_id;
-            if constexpr (traits::monad_rev() >= MONAD_FOUR) {
-                next_id = handle_header<MonadConsensusBlockHeaderV2>(
-                    id, data, start_exclusive, end_inclusive, fn);
-            }
-            else if constexpr (traits::monad_rev() >= MONAD_THREE) {
-                next_id = handle_header<MonadConsensusBlockHeaderV1>(
-                    id, data, start_exclusive, end_inclusive, fn);
-            }
-            else {
-                next_id = handle_header<MonadConsensusBlockHeaderV0>(
-                    id, data, start_exclusive, end_inclusive, fn);
-            }
-            if (!next_id.has_value()) {
-                return false;
-            }
-            id = next_id.value();
-            return true;
-        };
-
-        auto const keep_going = [&] {
-            SWITCH_MONAD_TRAITS(body.template operator());
-            MONAD_ASSERT(false);
-        }();
-
-        if (!keep_going) {
+        std::optional<bytes32_t> const next_id = std::visit(
+            [&](auto const &header) -> std::optional<bytes32_t> {
+                if (header.seqno > start_exclusive &&
+                    header.seqno <= end_inclusive) {
+                    fn(id, header);
+                }
+                if (header.seqno <= (start_exclusive + 1)) {
+                    return std::nullopt;
+                }
+                return header.parent_id();
+            },
+            ledger.header(id));
+        if (!next_id.has_value()) {
             break;
         }
+        id = next_id.value();
     }
     return head_id;
 }
@@ -510,16 +518,19 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
     bool const enable_tracing, ExecutionEventRecorder *const exec_recorder,
     Db *secondary_db, RunloopMonadOverride const runloop_override)
 {
-    constexpr auto SLEEP_TIME = std::chrono::microseconds(100);
+    // Upper bound on the time to notice a ledger change inotify missed
+    constexpr auto WAIT_TIME = std::chrono::milliseconds(10);
     uint64_t const start_block_num =
         runloop_override.start_block_num(block_num);
     uint256_t const chain_id = chain.get_chain_id();
     BlockHashChain block_hash_chain(block_hash_buffer);
 
-    auto const body_dir = ledger_dir / "bodies";
-    auto const header_dir = ledger_dir / "headers";
-    auto const proposed_head = header_dir / "proposed_head";
-    auto const finalized_head = header_dir / "finalized_head";
+    LedgerWatcher ledger{chain, ledger_dir};
+    // Declared before any recovery future, which must finish with it
+    auto const recovery_group =
+        priority_pool.create_fiber_group(priority_pool.num_threads());
+    auto const proposed_head = ledger.header_dir() / "proposed_head";
+    auto const finalized_head = ledger.header_dir() / "finalized_head";
 
     uint64_t last_finalized_block_number =
         raw_db.get_latest_finalized_version();
@@ -529,14 +540,13 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
     BlockCache block_cache;
     for_each_header(
         finalized_head,
-        header_dir,
-        chain,
+        ledger,
         last_finalized_block_number > 2 ? last_finalized_block_number - 2 : 0,
         last_finalized_block_number,
-        [&block_cache, &priority_pool, body_dir](
+        [&block_cache, &priority_pool, &ledger](
             bytes32_t const &id, auto const &header) {
             MonadConsensusBlockBody const body =
-                read_body(header.block_body_id, body_dir);
+                ledger.take_body(header.block_body_id);
             std::vector<std::optional<Address>> const recovered =
                 recover_senders(body.transactions, priority_pool);
             std::vector<Address> senders;
@@ -569,10 +579,7 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
     struct ToExecute
     {
         bytes32_t block_id;
-        std::variant<
-            MonadConsensusBlockHeaderV0, MonadConsensusBlockHeaderV1,
-            MonadConsensusBlockHeaderV2>
-            header;
+        LedgerWatcher::Header header;
     };
 
     struct ToFinalize
@@ -597,8 +604,7 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
         // read from finalized head if we are behind
         bytes32_t const finalized_head_id = for_each_header(
             finalized_head,
-            header_dir,
-            chain,
+            ledger,
             last_finalized_block_number,
             end_block_num,
             [&raw_db, &to_execute, &to_finalize](
@@ -622,8 +628,7 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
         if (to_finalize.empty()) {
             for_each_header(
                 proposed_head,
-                header_dir,
-                chain,
+                ledger,
                 last_finalized_block_number,
                 end_block_num,
                 [&raw_db,
@@ -645,12 +650,12 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
         }
 
         if (MONAD_UNLIKELY(to_execute.empty() && to_finalize.empty())) {
-            std::this_thread::sleep_for(SLEEP_TIME);
+            ledger.wait(WAIT_TIME);
             continue;
         }
 
         auto const handle_to_execute =
-            [&body_dir,
+            [&ledger,
              &block_hash_chain,
              &db,
              &chain,
@@ -665,7 +670,9 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
              secondary_db,
              runloop_override](
                 bytes32_t const &block_id,
-                auto const &header) -> Result<std::pair<uint64_t, uint64_t>> {
+                auto const &header,
+                std::future<RecoveredBody> recovery)
+            -> Result<std::pair<uint64_t, uint64_t>> {
             auto const block_time_start = std::chrono::steady_clock::now();
 
             db.update_voted_metadata(header.seqno - 1, header.parent_id());
@@ -676,7 +683,12 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
             record_block_qc(exec_recorder, header, last_finalized_block_number);
 
             uint64_t const block_number = header.execution_inputs.number;
-            auto body = read_body(header.block_body_id, body_dir);
+            auto const sender_recovery_begin = std::chrono::steady_clock::now();
+            RecoveredBody recovered = recovery.get();
+            auto const sender_recovery_time =
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - sender_recovery_begin);
+            auto &body = recovered.body;
             auto const ntxns = body.transactions.size();
 
             auto const &block_hash_buffer =
@@ -716,6 +728,9 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
                         .transactions = std::move(body.transactions),
                         .ommers = std::move(body.ommers),
                         .withdrawals = std::move(body.withdrawals)},
+                    recovered.senders,
+                    recovered.authorities,
+                    sender_recovery_time,
                     block_hash_chain,
                     chain,
                     db,
@@ -748,10 +763,29 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
             return outcome::success();
         };
 
-        for (auto const &[block_id, consensus_header] : to_execute) {
+        // Recovery of the next proposal runs while the current one executes
+        auto const recover_next = [&](size_t const i) {
+            return recover_body_async(
+                ledger.take_body(std::visit(
+                    [](auto const &header) { return header.block_body_id; },
+                    to_execute[i].header)),
+                *recovery_group);
+        };
+        std::future<RecoveredBody> next_recovery;
+        if (!to_execute.empty()) {
+            next_recovery = recover_next(0);
+        }
+        for (size_t i = 0; i < to_execute.size(); ++i) {
+            std::future<RecoveredBody> recovery = std::move(next_recovery);
+            if (i + 1 < to_execute.size()) {
+                next_recovery = recover_next(i + 1);
+            }
+            auto const &[block_id, consensus_header] = to_execute[i];
             BOOST_OUTCOME_TRY(std::visit(
-                [&block_id, handle_to_execute](auto const &header) {
-                    return handle_to_execute(block_id, header);
+                [&block_id, &recovery, &handle_to_execute](
+                    auto const &header) {
+                    return handle_to_execute(
+                        block_id, header, std::move(recovery));
                 },
                 consensus_header));
         }
@@ -780,6 +814,7 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
         }
 
         if (!to_finalize.empty()) {
+            ledger.finalize(to_finalize.back().block);
             std::erase_if(
                 block_cache,
                 [last_finalized = to_finalize.back().block](
@@ -215,6 +215,7 @@ Result<void> process_monad_block(
 
     BlockMetrics block_metrics;
     BlockState block_state(db, vm);
+    std::vector<EncodedTransactionOutput> encoded_outputs;
     record_block_marker_event(exec_recorder, MONAD_EXEC_BLOCK_PERF_EVM_ENTER);
     BOOST_OUTCOME_TRY(
         auto const receipts,
@@ -231,7 +232,9 @@ Result<void> process_monad_block(
             state_tracers,
             system_call_state_tracer,
             chain_context,
-            exec_recorder));
+            exec_recorder,
+            /*trace_transfers=*/false,
+            &encoded_outputs));
     record_block_marker_event(exec_recorder, MONAD_EXEC_BLOCK_PERF_EVM_EXIT);
 
     // Database commit of state changes (incl. Merkle root calculations)
@@ -246,7 +249,8 @@ Result<void> process_monad_block(
         .senders = senders,
         .call_frames = call_frames,
         .ommers = block.ommers,
-        .withdrawals = block.withdrawals};
+        .withdrawals = block.withdrawals,
+        .encoded_outputs = &encoded_outputs};
     commit_block<traits>(db, nullptr, block_id, block.header, *state, anc);
 
     [[maybe_unused]] auto const commit_time =
@@ -0,0 +1,338 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/assert.h>
+#include <category/core/blake3.hpp>
+#include <category/core/byte_string.hpp>
+#include <category/core/bytes.hpp>
+#include <category/core/hex.hpp>
+#include <category/execution/monad/chain/monad_testnet.hpp>
+#include <category/execution/monad/core/monad_block.hpp>
+#include <category/execution/runloop/ledger_watcher.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <string>
+#include <system_error>
+#include <variant>
+
+#include <stdlib.h>
+
+using namespace monad;
+
+namespace
+{
+    // V0 consensus header with seqno 5, from test_monad_block_rlp.cpp
+    constexpr unsigned char HEADER[] = {
+        0xf9, 0x04, 0x3f, 0x0a, 0x05, 0xf8, 0xae, 0xf8, 0x45, 0xa0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xa0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf8, 0x65, 0xc2, 0x80, 0x80, 0xb8,
+        0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xa1, 0x03, 0x1b, 0x84, 0xc5, 0x56, 0x7b, 0x12, 0x64, 0x40, 0x99,
+        0x5d, 0x3e, 0xd5, 0xaa, 0xba, 0x05, 0x65, 0xd7, 0x1e, 0x18, 0x34, 0x60,
+        0x48, 0x19, 0xff, 0x9c, 0x17, 0xf5, 0xe9, 0xd5, 0xdd, 0x07, 0x8f, 0x05,
+        0x86, 0x01, 0x93, 0x08, 0xba, 0x6a, 0x98, 0xb8, 0x60, 0x90, 0xaf, 0xa6,
+        0x6b, 0xb8, 0x68, 0x67, 0xd3, 0x51, 0xfc, 0x71, 0xac, 0xe3, 0x5b, 0xd2,
+        0x23, 0x35, 0x98, 0xa7, 0x32, 0xbd, 0x68, 0xbb, 0x2c, 0x0c, 0x7b, 0x82,
+        0x41, 0xa4, 0xdf, 0x05, 0xbb, 0xcc, 0x5a, 0x35, 0x0a, 0x30, 0x82, 0xb0,
+        0x4c, 0xbc, 0xb5, 0xb1, 0x35, 0x79, 0xb9, 0x9e, 0x44, 0x04, 0x2d, 0x8d,
+        0x93, 0xc6, 0xfe, 0x7f, 0x8d, 0x6a, 0x83, 0x40, 0xfa, 0xa0, 0xbd, 0x83,
+        0x37, 0x94, 0xec, 0x76, 0x62, 0xeb, 0x84, 0xea, 0x86, 0x39, 0x3a, 0xe0,
+        0x62, 0xf8, 0x61, 0x8c, 0x75, 0x4e, 0xb4, 0xd8, 0x70, 0x5d, 0xe6, 0x3c,
+        0x26, 0xfb, 0xb6, 0x64, 0x9e, 0x8d, 0x5f, 0x17, 0xe3, 0xf9, 0x01, 0xf0,
+        0xf9, 0x01, 0xed, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xa0, 0x1d, 0xcc, 0x4d, 0xe8, 0xde, 0xc7, 0x5d, 0x7a, 0xab, 0x85, 0xb5,
+        0x67, 0xb6, 0xcc, 0xd4, 0x1a, 0xd3, 0x12, 0x45, 0x1b, 0x94, 0x8a, 0x74,
+        0x13, 0xf0, 0xa1, 0x42, 0xfd, 0x40, 0xd4, 0x93, 0x47, 0x94, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x56, 0xe8, 0x1f, 0x17, 0x1b,
+        0xcc, 0x55, 0xa6, 0xff, 0x83, 0x45, 0xe6, 0x92, 0xc0, 0xf8, 0x6e, 0x5b,
+        0x48, 0xe0, 0x1b, 0x99, 0x6c, 0xad, 0xc0, 0x01, 0x62, 0x2f, 0xb5, 0xe3,
+        0x63, 0xb4, 0x21, 0xa0, 0x56, 0xe8, 0x1f, 0x17, 0x1b, 0xcc, 0x55, 0xa6,
+        0xff, 0x83, 0x45, 0xe6, 0x92, 0xc0, 0xf8, 0x6e, 0x5b, 0x48, 0xe0, 0x1b,
+        0x99, 0x6c, 0xad, 0xc0, 0x01, 0x62, 0x2f, 0xb5, 0xe3, 0x63, 0xb4, 0x21,
+        0xa0, 0x56, 0xe8, 0x1f, 0x17, 0x1b, 0xcc, 0x55, 0xa6, 0xff, 0x83, 0x45,
+        0xe6, 0x92, 0xc0, 0xf8, 0x6e, 0x5b, 0x48, 0xe0, 0x1b, 0x99, 0x6c, 0xad,
+        0xc0, 0x01, 0x62, 0x2f, 0xb5, 0xe3, 0x63, 0xb4, 0x21, 0xb9, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0xa0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xf8, 0xeb, 0xa0, 0x1d, 0xcc, 0x4d, 0xe8, 0xde,
+        0xc7, 0x5d, 0x7a, 0xab, 0x85, 0xb5, 0x67, 0xb6, 0xcc, 0xd4, 0x1a, 0xd3,
+        0x12, 0x45, 0x1b, 0x94, 0x8a, 0x74, 0x13, 0xf0, 0xa1, 0x42, 0xfd, 0x40,
+        0xd4, 0x93, 0x47, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xa0, 0x56, 0xe8, 0x1f, 0x17, 0x1b, 0xcc, 0x55, 0xa6, 0xff, 0x83, 0x45,
+        0xe6, 0x92, 0xc0, 0xf8, 0x6e, 0x5b, 0x48, 0xe0, 0x1b, 0x99, 0x6c, 0xad,
+        0xc0, 0x01, 0x62, 0x2f, 0xb5, 0xe3, 0x63, 0xb4, 0x21, 0x80, 0x05, 0x80,
+        0x80, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x80, 0xa0, 0x56, 0xe8, 0x1f, 0x17, 0x1b, 0xcc,
+        0x55, 0xa6, 0xff, 0x83, 0x45, 0xe6, 0x92, 0xc0, 0xf8, 0x6e, 0x5b, 0x48,
+        0xe0, 0x1b, 0x99, 0x6c, 0xad, 0xc0, 0x01, 0x62, 0x2f, 0xb5, 0xe3, 0x63,
+        0xb4, 0x21, 0x80, 0x80, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xa0, 0xfb, 0xc5, 0x04, 0xe9, 0x52, 0x03, 0x2b, 0xc4, 0x95, 0x84,
+        0x7f, 0x49, 0x94, 0x92, 0x18, 0xb8, 0x0a, 0xe1, 0xd9, 0xfc, 0x52, 0xda,
+        0xc3, 0x11, 0x52, 0x45, 0x6b, 0xc7, 0x17, 0x4a, 0xfd, 0xf4};
+
+    // Offset of the single byte seqno in HEADER
+    constexpr size_t SEQNO_OFFSET = 215;
+
+    constexpr unsigned char BODY[] = {0xc4, 0xc3, 0xc0, 0xc0, 0xc0};
+
+    // Body with a single zero withdrawal at `index`, 30 bytes for any index
+    // below 0x80
+    byte_string body_with_withdrawal(uint8_t const index)
+    {
+        byte_string body{0xdd, 0xdc, 0xc0, 0xc0, 0xd9, 0xd8, index, 0x80, 0x94};
+        body.append(20, 0x00); // recipient
+        body.push_back(0x80);
+        return body;
+    }
+
+    byte_string header_with_seqno(uint8_t const seqno)
+    {
+        byte_string header{HEADER, sizeof(HEADER)};
+        header[SEQNO_OFFSET] = seqno;
+        return header;
+    }
+
+    // The body id is the last field of a V0 header
+    byte_string
+    header_with_body(uint8_t const seqno, bytes32_t const &body_id)
+    {
+        byte_string header = header_with_seqno(seqno);
+        std::copy_n(
+            body_id.bytes,
+            sizeof(body_id.bytes),
+            header.end() - sizeof(body_id.bytes));
+        return header;
+    }
+
+    uint64_t seqno_of(LedgerWatcher::Header const &header)
+    {
+        return std::visit([](auto const &h) { return h.seqno; }, header);
+    }
+
+    struct LedgerWatcherTest : public ::testing::Test
+    {
+        std::filesystem::path ledger_dir;
+        MonadTestnet chain;
+
+        LedgerWatcherTest()
+        {
+            std::string tmpl = (std::filesystem::temp_directory_path() /
+                                "monad_ledger_watcher_test_XXXXXX")
+                                   .string();
+            char const *const result = ::mkdtemp(tmpl.data());
+            MONAD_ASSERT(result != nullptr);
+            ledger_dir = result;
+            std::filesystem::create_directory(ledger_dir / "headers");
+            std::filesystem::create_directory(ledger_dir / "bodies");
+        }
+
+        ~LedgerWatcherTest() override
+        {
+            std::error_code ec;
+            std::filesystem::remove_all(ledger_dir, ec);
+        }
+
+        // Write like consensus does, so that the file is complete when it
+        // appears in the watched directory
+        bytes32_t write_file(
+            std::filesystem::path const &dir, byte_string_view const data,
+            bytes32_t const &id) const
+        {
+            auto const tmp = ledger_dir / "tmp";
+            {
+                std::ofstream os{tmp, std::ios::binary};
+                os.write(
+                    reinterpret_cast<char const *>(data.data()),
+                    static_cast<std::streamsize>(data.size()));
+            }
+            std::filesystem::rename(tmp, dir / to_hex(id));
+            return id;
+        }
+
+        bytes32_t write_file(
+            std::filesystem::path const &dir, byte_string_view const data) const
+        {
+            return write_file(dir, data, to_bytes(blake3(data)));
+        }
+
+        void remove_files() const
+        {
+            for (auto const *const dir : {"headers", "bodies"}) {
+                for (auto const &entry :
+                     std::filesystem::directory_iterator(ledger_dir / dir)) {
+                    std::filesystem::remove(entry.path());
+                }
+            }
+        }
+    };
+}
+
+TEST_F(LedgerWatcherTest, wait_prefetches_new_files)
+{
+    LedgerWatcher watcher{chain, ledger_dir};
+    auto const header_id =
+        write_file(watcher.header_dir(), header_with_seqno(5));
+    auto const body_id =
+        write_file(watcher.body_dir(), to_byte_string_view(BODY));
+    watcher.wait(std::chrono::milliseconds(1000));
+
+    // Served from the cache, reading the removed files would assert
+    remove_files();
+    EXPECT_EQ(seqno_of(watcher.header(header_id)), 5);
+    auto const body = watcher.take_body(body_id);
+    EXPECT_TRUE(body.transactions.empty());
+    EXPECT_TRUE(body.ommers.empty());
+    EXPECT_TRUE(body.withdrawals.empty());
+}
+
+TEST_F(LedgerWatcherTest, wait_skips_file_failing_checksum)
+{
+    LedgerWatcher watcher{chain, ledger_dir};
+    auto const header = header_with_seqno(5);
+    auto const id = to_bytes(blake3(header));
+
+    // A partially written file is not decoded
+    write_file(watcher.header_dir(), header.substr(0, 100), id);
+    watcher.wait(std::chrono::milliseconds(1000));
+
+    // and the complete file is picked up once it lands
+    write_file(watcher.header_dir(), header, id);
+    watcher.wait(std::chrono::milliseconds(1000));
+    remove_files();
+    EXPECT_EQ(seqno_of(watcher.header(id)), 5);
+}
+
+TEST_F(LedgerWatcherTest, finalize_drops_older_headers)
+{
+    LedgerWatcher watcher{chain, ledger_dir};
+    auto const id1 = write_file(watcher.header_dir(), header_with_seqno(1));
+    auto const id2 = write_file(watcher.header_dir(), header_with_seqno(2));
+    auto const id3 = write_file(watcher.header_dir(), header_with_seqno(3));
+    watcher.wait(std::chrono::milliseconds(1000));
+    remove_files();
+
+    watcher.finalize(2);
+    EXPECT_EQ(seqno_of(watcher.header(id2)), 2);
+    EXPECT_EQ(seqno_of(watcher.header(id3)), 3);
+    EXPECT_DEATH((void)watcher.header(id1), "missing or bad file");
+}
+
+TEST_F(LedgerWatcherTest, capacity_evicts_headers)
+{
+    LedgerWatcher watcher{chain, ledger_dir, 2};
+    auto const id1 = write_file(watcher.header_dir(), header_with_seqno(1));
+    auto const id2 = write_file(watcher.header_dir(), header_with_seqno(2));
+    auto const id3 = write_file(watcher.header_dir(), header_with_seqno(3));
+    watcher.wait(std::chrono::milliseconds(1000));
+    remove_files();
+
+    EXPECT_EQ(seqno_of(watcher.header(id2)), 2);
+    EXPECT_EQ(seqno_of(watcher.header(id3)), 3);
+    EXPECT_DEATH((void)watcher.header(id1), "missing or bad file");
+}
+
+TEST_F(LedgerWatcherTest, finalize_drops_older_bodies)
+{
+    LedgerWatcher watcher{chain, ledger_dir};
+    auto const body_id =
+        write_file(watcher.body_dir(), to_byte_string_view(BODY));
+    write_file(watcher.header_dir(), header_with_body(1, body_id));
+    watcher.wait(std::chrono::milliseconds(1000));
+    remove_files();
+
+    watcher.finalize(2);
+    EXPECT_DEATH((void)watcher.take_body(body_id), "missing or bad file");
+}
+
+TEST_F(LedgerWatcherTest, body_capacity_is_in_bytes)
+{
+    // Room for two encoded bodies
+    LedgerWatcher watcher{
+        chain, ledger_dir, 1024, 2 * body_with_withdrawal(0).size()};
+    auto const id1 = write_file(watcher.body_dir(), body_with_withdrawal(1));
+    auto const id2 = write_file(watcher.body_dir(), body_with_withdrawal(2));
+    auto const id3 = write_file(watcher.body_dir(), body_with_withdrawal(3));
+    watcher.wait(std::chrono::milliseconds(1000));
+    remove_files();
+
+    EXPECT_EQ(watcher.take_body(id2).withdrawals.at(0).index, 2);
+    EXPECT_EQ(watcher.take_body(id3).withdrawals.at(0).index, 3);
+    EXPECT_DEATH((void)watcher.take_body(id1), "missing or bad file");
+}
+
+TEST_F(LedgerWatcherTest, unwatched_ledger_keeps_polling)
+{
+    std::filesystem::remove(ledger_dir / "headers");
+    LedgerWatcher watcher{chain, ledger_dir};
+
+    auto const begin = std::chrono::steady_clock::now();
+    watcher.wait(std::chrono::milliseconds(1000));
+    EXPECT_LT(
+        std::chrono::steady_clock::now() - begin,
+        std::chrono::milliseconds(100));
+}
@@ -21,6 +21,9 @@
 #include <category/async/storage_pool.hpp>
 #include <category/async/util.hpp>
 #include <category/core/assert.h>
+#include <category/core/blake3.hpp>
+#include <category/core/byte_string.hpp>
+#include <category/core/bytes.hpp>
 #include <category/core/cli/help_formatter.hpp>
 #include <category/core/detail/start_lifetime_as_polyfill.hpp>
 #include <category/core/hex.hpp>
@@ -148,6 +151,13 @@ static size_t const total_physical_memory_bytes = [] {
     return size_t(v) * size_t(getpagesize());
 }();
 
+static monad::bytes32_t
+hash_chunk_contents(std::span<std::byte const> const contents)
+{
+    return monad::to_bytes(monad::blake3(monad::byte_string_view{
+        reinterpret_cast<uint8_t const *>(contents.data()), contents.size()}));
+}
+
 struct chunk_info_restore_t
 {
     monad::async::storage_pool::chunk_type const type;
@@ -158,6 +168,8 @@ struct chunk_info_restore_t
     monad::async::storage_pool::chunk_t *chunk_ptr;
     std::vector<std::byte> nonchunkstorage;
     std::future<size_t> decompression_thread;
+    // Set when the archive manifest recorded a hash for this chunk
+    std::optional<monad::bytes32_t> expected_hash;
     bool const is_uncompressed;
     bool use_faster_memory_mode{false};
     bool done{false};
@@ -198,6 +210,19 @@ struct chunk_info_restore_t
 
     void reset() {}
 
+    void verify_hash(std::span<std::byte const> const contents) const
+    {
+        if (expected_hash.has_value() &&
+            hash_chunk_contents(contents) != *expected_hash) {
+            std::stringstream ss;
+            ss << "Restored contents of "
+               << (type == monad::async::storage_pool::cnv ? "cnv/" : "seq/")
+               << chunk_id
+               << " do not match the hash recorded in the archive manifest.";
+            throw std::runtime_error(ss.str());
+        }
+    }
+
     // Runs in a separate kernel thread
     size_t run()
     {
@@ -263,6 +288,7 @@ struct chunk_info_restore_t
             if (ZSTD_isError(written)) {
                 throw std::runtime_error("ZSTD compression failed");
             }
+            verify_hash(decompressed.subspan(0, written));
             if (nonchunkstorage.empty()) {
                 auto [wfd, offset] = chunk_ptr->write_fd(written);
                 if (::pwrite(
@@ -276,6 +302,7 @@ struct chunk_info_restore_t
             return written;
         }
         else {
+            verify_hash(compressed);
             if (nonchunkstorage.empty()) {
                 auto [wfd, offset] = chunk_ptr->write_fd(compressed.size());
                 if (::pwrite(
@@ -307,7 +334,11 @@ struct chunk_info_archive_t
     void const *uncompressed_storage{nullptr};
     std::span<std::byte> compressed;
     std::span<std::byte const> uncompressed;
+    monad::bytes32_t hash{};
     std::future<void> compression_thread;
+    // Seq chunk lying wholly before the WIP offset of its list, whose
+    // contents are validated and no longer rewound on open
+    bool sealed{false};
 
     chunk_info_archive_t(
         monad::async::storage_pool::chunk_t *chunk_ptr_,
@@ -325,7 +356,9 @@ struct chunk_info_archive_t
         , uncompressed_storage(o.uncompressed_storage)
         , compressed(o.compressed)
         , uncompressed(o.uncompressed)
+        , hash(o.hash)
         , compression_thread(std::move(o.compression_thread))
+        , sealed(o.sealed)
     {
         o.compressed_storage = nullptr;
         o.uncompressed_storage = nullptr;
@@ -351,6 +384,7 @@ struct chunk_info_archive_t
     // Runs in a separate kernel thread
     void run(int const compression_level)
     {
+        hash = hash_chunk_contents(uncompressed);
         int const fd = monad::async::make_temporary_inode();
         if (fd == -1) {
             throw std::system_error(errno, std::system_category());
@@ -406,6 +440,160 @@ struct chunk_info_archive_t
     }
 };
 
+// Every archive ends with a manifest listing all the chunks making up the
+// database at the time of archival. An incremental archive leaves out the
+// seq chunks unchanged since its base archive, so restore takes each chunk
+// listed in the final manifest from the newest archive in the chain holding
+// it, and checks it against the hash recorded here.
+struct archive_manifest_t
+{
+    static constexpr char const *pathname = "manifest";
+    static constexpr std::string_view magic = "monad-mpt-manifest 2";
+    // Did not mark sealed seq chunks, so none of its chunks are reused
+    static constexpr std::string_view magic_v1 = "monad-mpt-manifest 1";
+
+    struct record_t
+    {
+        uint64_t metadata; // chunk_info_t bits, all ones for cnv chunks
+        uint64_t size; // before compression
+        monad::bytes32_t hash;
+        // Seq chunk before the WIP offset of its list when archived,
+        // written as "seq" rather than "wip"
+        bool sealed{false};
+    };
+
+    using key_t = std::pair<monad::async::storage_pool::chunk_type, uint32_t>;
+
+    // Manifest hash of the base archive, if this archive is incremental
+    std::optional<monad::bytes32_t> base;
+    std::map<key_t, record_t> records;
+
+    // Seq chunks are append only until recycled, and recycling bumps the
+    // insertion count. However opening a dirty database or rewinding it
+    // trims a chunk in place (see UpdateAux::rewind_to_match_offsets),
+    // even one sealed at the time of the base archive, and the trimmed
+    // contents may then be rewritten up to the same size. A chunk sealed in
+    // both archives on the same list with the same insertion count and size
+    // is therefore only a candidate for reuse, its contents are hashed to
+    // confirm it.
+    static bool same_generation(uint64_t const a, uint64_t const b) noexcept
+    {
+        using chunk_info_t = monad::mpt::detail::db_metadata::chunk_info_t;
+        auto const x = std::bit_cast<chunk_info_t>(a);
+        auto const y = std::bit_cast<chunk_info_t>(b);
+        return x.in_fast_list == y.in_fast_list &&
+               x.in_slow_list == y.in_slow_list &&
+               x.insertion_count() == y.insertion_count();
+    }
+
+    std::string serialise() const
+    {
+        std::stringstream ss;
+        ss << magic << "\nbase "
+           << (base.has_value() ? monad::to_hex(*base) : "none") << "\n";
+        for (auto const &[key, record] : records) {
+            ss << (key.first == monad::async::storage_pool::cnv ? "cnv "
+                   : record.sealed                              ? "seq "
+                                                                : "wip ")
+               << key.second << " " << std::hex << record.metadata
+               << std::dec << " " << record.size << " "
+               << monad::to_hex(record.hash) << "\n";
+        }
+        return std::move(ss).str();
+    }
+
+    monad::bytes32_t hash() const
+    {
+        auto const text = serialise();
+        return hash_chunk_contents(std::as_bytes(std::span{text}));
+    }
+
+    static archive_manifest_t parse(std::string const &text)
+    {
+        auto const fail = [] {
+            throw std::runtime_error(
+                "Archive manifest is corrupt. Are you sure this archive was "
+                "generated by monad-mpt?");
+        };
+        archive_manifest_t ret;
+        std::istringstream ss(text);
+        std::string line;
+        if (!std::getline(ss, line) || (line != magic && line != magic_v1)) {
+            fail();
+        }
+        bool const marks_sealed = line == magic;
+        std::string token;
+        std::string hash;
+        if (!(ss >> token >> hash) || token != "base") {
+            fail();
+        }
+        if (hash != "none") {
+            ret.base = monad::from_hex<monad::bytes32_t>(hash);
+            if (!ret.base.has_value()) {
+                fail();
+            }
+        }
+        uint32_t chunk_id;
+        record_t record;
+        while (ss >> token >> chunk_id >> std::hex >> record.metadata >>
+               std::dec >> record.size >> hash) {
+            auto const record_hash = monad::from_hex<monad::bytes32_t>(hash);
+            if ((token != "cnv" && token != "seq" &&
+                 (token != "wip" || !marks_sealed)) ||
+                !record_hash.has_value()) {
+                fail();
+            }
+            record.hash = *record_hash;
+            record.sealed = marks_sealed && token == "seq";
+            ret.records.emplace(
+                key_t{
+                    token == "cnv" ? monad::async::storage_pool::cnv
+                                   : monad::async::storage_pool::seq,
+                    chunk_id},
+                record);
+        }
+        if (!ss.eof()) {
+            fail();
+        }
+        return ret;
+    }
+};
+
+// Scans an archive for its manifest without decompressing any chunks.
+// Archives from before manifests were introduced have none.
+static std::optional<archive_manifest_t>
+read_archive_manifest(std::filesystem::path const &path)
+{
+    auto *in = archive_read_new();
+    auto const unin =
+        monad::make_scope_exit([&]() noexcept { archive_read_free(in); });
+    if (ARCHIVE_OK != archive_read_support_format_tar(in) ||
+        ARCHIVE_OK != archive_read_support_filter_all(in) ||
+        ARCHIVE_OK != archive_read_open_filename(in, path.c_str(), 1 << 20)) {
+        std::stringstream ss;
+        ss << "libarchive failed due to " << archive_error_string(in);
+        throw std::runtime_error(ss.str());
+    }
+    for (archive_entry *entry = nullptr;
+         archive_read_next_header(in, &entry) == ARCHIVE_OK;) {
+        if (0 != strcmp(
+                     archive_entry_pathname(entry),
+                     archive_manifest_t::pathname)) {
+            archive_read_data_skip(in);
+            continue;
+        }
+        std::string text(size_t(archive_entry_size(entry)), 0);
+        if (archive_read_data(in, text.data(), text.size()) !=
+            la_ssize_t(text.size())) {
+            std::stringstream ss;
+            ss << "libarchive failed due to " << archive_error_string(in);
+            throw std::runtime_error(ss.str());
+        }
+        return archive_manifest_t::parse(text);
+    }
+    return std::nullopt;
+}
+
 struct impl_t
 {
     std::ostream &cout;
@@ -433,7 +621,9 @@ struct impl_t
     bool create_chunk_increasing = false;
     bool debug_printing = false;
     std::filesystem::path archive_database;
+    std::filesystem::path archive_base;
     std::filesystem::path restore_database;
+    std::vector<std::filesystem::path> restore_deltas;
     std::vector<std::filesystem::path> storage_paths;
     int compression_level = 3;
 
@@ -565,125 +755,250 @@ public:
     void do_restore_database()
     {
         auto const begin = std::chrono::steady_clock::now();
-        int fd = ::open(restore_database.c_str(), O_RDONLY | O_CLOEXEC);
-        if (fd == -1) {
-            throw std::system_error(errno, std::system_category());
-        }
-        auto unfd = monad::make_scope_exit([&]() noexcept { ::close(fd); });
 
+        // Decompression reads straight out of the mapped archives, so all of
+        // them stay mapped until the restore completes
         struct archive_shared_t
         {
+            std::filesystem::path path;
             size_t map_size{0};
             std::byte const *map_addr{nullptr};
+            struct archive *in{nullptr};
+            std::optional<archive_manifest_t> manifest;
 
             ~archive_shared_t()
             {
-                ::munmap((void *)map_addr, map_size);
+                if (in != nullptr) {
+                    archive_read_free(in);
+                }
+                if (map_addr != nullptr) {
+                    ::munmap((void *)map_addr, map_size);
+                }
             }
-        } archive_shared;
+        };
 
+        struct archived_chunk_t
         {
-            struct stat stat;
-            if (-1 == ::fstat(fd, &stat)) {
+            monad::mpt::detail::db_metadata::chunk_info_t metadata;
+            std::span<std::byte const> compressed;
+            bool is_uncompressed;
+            std::optional<monad::bytes32_t> hash;
+        };
+
+        std::vector<std::unique_ptr<archive_shared_t>> archives;
+        // The newest copy of each chunk across the base and its deltas
+        std::map<archive_manifest_t::key_t, archived_chunk_t> latest;
+
+        auto load_archive = [&](std::filesystem::path const &path) {
+            auto &archive_shared =
+                *archives.emplace_back(std::make_unique<archive_shared_t>());
+            archive_shared.path = path;
+            int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd == -1) {
                 throw std::system_error(errno, std::system_category());
             }
-            archive_shared.map_size = size_t(stat.st_size);
-        }
-        archive_shared.map_addr = (std::byte const *)::mmap(
-            nullptr, archive_shared.map_size, PROT_READ, MAP_SHARED, fd, 0);
-        if (archive_shared.map_addr == MAP_FAILED) {
-            throw std::system_error(errno, std::system_category());
-        }
-        unfd.reset();
-
-        auto *in = archive_read_new();
-        auto const unin =
-            monad::make_scope_exit([&]() noexcept { archive_read_free(in); });
-        if (ARCHIVE_OK != archive_read_support_format_tar(in)) {
-            std::stringstream ss;
-            ss << "libarchive failed due to " << archive_error_string(in);
-            throw std::runtime_error(ss.str());
-        }
-        if (ARCHIVE_OK != archive_read_support_filter_all(in)) {
-            std::stringstream ss;
-            ss << "libarchive failed due to " << archive_error_string(in);
-            throw std::runtime_error(ss.str());
-        }
-
-        if (ARCHIVE_OK !=
-            archive_read_open_memory(
-                in, archive_shared.map_addr, archive_shared.map_size)) {
-            std::stringstream ss;
-            ss << "libarchive failed due to " << archive_error_string(in);
-            throw std::runtime_error(ss.str());
-        }
+            auto unfd =
+                monad::make_scope_exit([&]() noexcept { ::close(fd); });
+            {
+                struct stat stat;
+                if (-1 == ::fstat(fd, &stat)) {
+                    throw std::system_error(errno, std::system_category());
+                }
+                archive_shared.map_size = size_t(stat.st_size);
+            }
+            auto *const map_addr = ::mmap(
+                nullptr, archive_shared.map_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (map_addr == MAP_FAILED) {
+                throw std::system_error(errno, std::system_category());
+            }
+            archive_shared.map_addr = (std::byte const *)map_addr;
+            unfd.reset();
 
-        std::vector<chunk_info_restore_t> todecompress;
-        uint32_t max_chunk_id[2] = {0, 0};
-        for (archive_entry *entry = nullptr;
-             archive_read_next_header(in, &entry) == ARCHIVE_OK;) {
-            std::filesystem::path const pathname(archive_entry_pathname(entry));
-            monad::async::storage_pool::chunk_type type;
-            std::string_view const pathname_sv(pathname.native());
-            auto const type_sv = pathname_sv.substr(0, 4);
-            if (type_sv == "cnv/") {
-                type = monad::async::storage_pool::cnv;
-            }
-            else if (type_sv == "seq/") {
-                type = monad::async::storage_pool::seq;
+            auto *in = archive_shared.in = archive_read_new();
+            if (ARCHIVE_OK != archive_read_support_format_tar(in)) {
+                std::stringstream ss;
+                ss << "libarchive failed due to " << archive_error_string(in);
+                throw std::runtime_error(ss.str());
             }
-            else {
-                continue;
+            if (ARCHIVE_OK != archive_read_support_filter_all(in)) {
+                std::stringstream ss;
+                ss << "libarchive failed due to " << archive_error_string(in);
+                throw std::runtime_error(ss.str());
             }
-            bool const is_uncompressed =
-                (pathname_sv.find(".zst") == pathname_sv.npos);
-            uint32_t const chunk_id = uint32_t(atol(pathname.stem().c_str()));
-            monad::mpt::detail::db_metadata::chunk_info_t metadata;
-            memset(&metadata, 0, sizeof(metadata));
-            archive_entry_xattr_reset(entry);
-            char const *xattr_name = nullptr;
-            void const *xattr_value = nullptr;
-            size_t xattr_value_len = 0;
-            for (;;) {
-                archive_entry_xattr_next(
-                    entry, &xattr_name, &xattr_value, &xattr_value_len);
-                if (xattr_name == nullptr) {
-                    break;
+
+            if (ARCHIVE_OK !=
+                archive_read_open_memory(
+                    in, archive_shared.map_addr, archive_shared.map_size)) {
+                std::stringstream ss;
+                ss << "libarchive failed due to " << archive_error_string(in);
+                throw std::runtime_error(ss.str());
+            }
+
+            size_t chunks = 0;
+            for (archive_entry *entry = nullptr;
+                 archive_read_next_header(in, &entry) == ARCHIVE_OK;) {
+                std::filesystem::path const pathname(
+                    archive_entry_pathname(entry));
+                std::string_view const pathname_sv(pathname.native());
+                void const *buffer = nullptr;
+                size_t len = 0;
+                off_t offset = 0;
+                if (pathname_sv == archive_manifest_t::pathname) {
+                    if (archive_read_data_block(
+                            in, &buffer, &len, &offset) != ARCHIVE_OK) {
+                        std::stringstream ss;
+                        ss << "libarchive failed due to "
+                           << archive_error_string(in);
+                        throw std::runtime_error(ss.str());
+                    }
+                    archive_shared.manifest = archive_manifest_t::parse(
+                        std::string((char const *)buffer, len));
+                    continue;
                 }
-                if (0 == strcmp(xattr_name, "monad.triedb.metadata")) {
-                    memcpy(&metadata, xattr_value, sizeof(metadata));
+                monad::async::storage_pool::chunk_type type;
+                auto const type_sv = pathname_sv.substr(0, 4);
+                if (type_sv == "cnv/") {
+                    type = monad::async::storage_pool::cnv;
                 }
-            }
-            if (type == monad::async::storage_pool::seq) {
-                if (!metadata.in_fast_list && !metadata.in_slow_list) {
+                else if (type_sv == "seq/") {
+                    type = monad::async::storage_pool::seq;
+                }
+                else {
+                    continue;
+                }
+                bool const is_uncompressed =
+                    (pathname_sv.find(".zst") == pathname_sv.npos);
+                uint32_t const chunk_id =
+                    uint32_t(atol(pathname.stem().c_str()));
+                monad::mpt::detail::db_metadata::chunk_info_t metadata;
+                memset(&metadata, 0, sizeof(metadata));
+                std::optional<monad::bytes32_t> hash;
+                archive_entry_xattr_reset(entry);
+                char const *xattr_name = nullptr;
+                void const *xattr_value = nullptr;
+                size_t xattr_value_len = 0;
+                for (;;) {
+                    archive_entry_xattr_next(
+                        entry, &xattr_name, &xattr_value, &xattr_value_len);
+                    if (xattr_name == nullptr) {
+                        break;
+                    }
+                    if (0 == strcmp(xattr_name, "monad.triedb.metadata")) {
+                        memcpy(&metadata, xattr_value, sizeof(metadata));
+                    }
+                    else if (
+                        0 == strcmp(xattr_name, "monad.triedb.blake3") &&
+                        xattr_value_len == sizeof(monad::bytes32_t)) {
+                        hash.emplace();
+                        memcpy(hash->bytes, xattr_value, xattr_value_len);
+                    }
+                }
+                if (type == monad::async::storage_pool::seq) {
+                    if (!metadata.in_fast_list && !metadata.in_slow_list) {
+                        std::stringstream ss;
+                        ss << "Sequential type chunk in archive has neither "
+                              "fast list nor slow list bits set. Are you "
+                              "sure this archive was generated by monad-mpt?";
+                        throw std::runtime_error(ss.str());
+                    }
+                }
+                if (archive_read_data_block(in, &buffer, &len, &offset) !=
+                    ARCHIVE_OK) {
                     std::stringstream ss;
-                    ss << "Sequential type chunk in archive has neither "
-                          "fast list nor slow list bits set. Are you sure "
-                          "this archive was generated by monad-mpt?";
+                    ss << "libarchive failed due to "
+                       << archive_error_string(in);
                     throw std::runtime_error(ss.str());
                 }
+                latest.insert_or_assign(
+                    archive_manifest_t::key_t{type, chunk_id},
+                    archived_chunk_t{
+                        metadata,
+                        {(std::byte const *)buffer, len},
+                        is_uncompressed,
+                        hash});
+                chunks++;
+            }
+            cout << "The archived database " << path << " contains " << chunks
+                 << " chunks." << std::endl;
+        };
+
+        load_archive(restore_database);
+        for (auto const &delta : restore_deltas) {
+            auto const &base = *archives.back();
+            load_archive(delta);
+            auto const &manifest = archives.back()->manifest;
+            if (!base.manifest.has_value() || !manifest.has_value() ||
+                manifest->base != base.manifest->hash()) {
+                std::stringstream ss;
+                ss << "DB archive " << delta
+                   << " is not an incremental archive based on " << base.path
+                   << ". Deltas must be given in the order they were taken, "
+                      "each based on the archive before it.";
+                throw std::runtime_error(ss.str());
             }
-            void const *buffer = nullptr;
-            size_t len = 0;
-            off_t offset = 0;
-            if (archive_read_data_block(in, &buffer, &len, &offset) !=
-                ARCHIVE_OK) {
+        }
+
+        std::vector<chunk_info_restore_t> todecompress;
+        uint32_t max_chunk_id[2] = {0, 0};
+        auto const &manifest = archives.back()->manifest;
+        if (manifest.has_value()) {
+            if (restore_deltas.empty() && manifest->base.has_value()) {
                 std::stringstream ss;
-                ss << "libarchive failed due to " << archive_error_string(in);
+                ss << "DB archive " << restore_database
+                   << " is incremental. Restore its base archive with "
+                      "--restore and pass this one with --restore-delta.";
                 throw std::runtime_error(ss.str());
             }
-            if (chunk_id > max_chunk_id[type]) {
-                max_chunk_id[type] = chunk_id;
+            // Only the chunks in the final manifest make up the database,
+            // older archives may hold chunks since recycled
+            for (auto const &[key, record] : manifest->records) {
+                auto const it = latest.find(key);
+                if (it == latest.end() ||
+                    (it->second.hash.has_value() &&
+                     *it->second.hash != record.hash)) {
+                    std::stringstream ss;
+                    ss << "Chunk "
+                       << (key.first == monad::async::storage_pool::cnv
+                               ? "cnv/"
+                               : "seq/")
+                       << key.second << " listed in the manifest of "
+                       << archives.back()->path
+                       << " is missing from the archives given.";
+                    throw std::runtime_error(ss.str());
+                }
+                if (key.second > max_chunk_id[key.first]) {
+                    max_chunk_id[key.first] = key.second;
+                }
+                auto &i = todecompress.emplace_back(
+                    key.first,
+                    key.second,
+                    std::bit_cast<
+                        monad::mpt::detail::db_metadata::chunk_info_t>(
+                        record.metadata),
+                    it->second.compressed,
+                    it->second.is_uncompressed);
+                i.expected_hash = record.hash;
+            }
+        }
+        else {
+            for (auto const &[key, chunk] : latest) {
+                if (key.second > max_chunk_id[key.first]) {
+                    max_chunk_id[key.first] = key.second;
+                }
+                todecompress.emplace_back(
+                    key.first,
+                    key.second,
+                    chunk.metadata,
+                    chunk.compressed,
+                    chunk.is_uncompressed);
             }
-            todecompress.emplace_back(
-                type,
-                chunk_id,
-                metadata,
-                std::span<std::byte const>{(std::byte const *)buffer, len},
-                is_uncompressed);
         }
-        cout << "The archived database " << restore_database << " contains "
-             << todecompress.size() << " chunks." << std::endl;
+        if (!restore_deltas.empty()) {
+            cout << "Restoring " << todecompress.size()
+                 << " chunks from the base archive and "
+                 << restore_deltas.size() << " incremental archives."
+                 << std::endl;
+        }
 
         // Does the destination pool have enough chunks?
         if (max_chunk_id[monad::async::storage_pool::cnv] >=
@@ -1177,6 +1492,18 @@ public:
     void do_archive_database()
     {
         auto const begin = std::chrono::steady_clock::now();
+        std::optional<archive_manifest_t> base_manifest;
+        if (!archive_base.empty()) {
+            base_manifest = read_archive_manifest(archive_base);
+            if (!base_manifest.has_value()) {
+                std::stringstream ss;
+                ss << "DB archive " << archive_base
+                   << " has no manifest so cannot be the base of an "
+                      "incremental archive. Take a full archive with this "
+                      "version of monad-mpt first.";
+                throw std::runtime_error(ss.str());
+            }
+        }
         int fd = ::open(
             archive_database.c_str(),
             O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC,
@@ -1314,10 +1641,16 @@ public:
             std::vector<uint32_t> cnv_chunk_ids;
             cnv_chunk_ids.reserve(pool->chunks(pool->cnv));
             cnv_chunk_ids.push_back(0);
+            uint32_t wip_fast_chunk_id;
+            uint32_t wip_slow_chunk_id;
             {
                 auto const *m =
                     monad::start_lifetime_as<monad::mpt::detail::db_metadata>(
                         cnv_infos.back().uncompressed.data());
+                wip_fast_chunk_id =
+                    uint32_t(m->db_offsets.start_of_wip_offset_fast.id);
+                wip_slow_chunk_id =
+                    uint32_t(m->db_offsets.start_of_wip_offset_slow.id);
                 auto const &primary_ring = (m->primary_ring_idx == 0)
                                                ? m->root_offsets
                                                : m->secondary_timeline;
@@ -1351,9 +1684,67 @@ public:
                 }
             }
 
+            archive_manifest_t manifest;
+            if (base_manifest.has_value()) {
+                manifest.base = base_manifest->hash();
+            }
+            size_t chunks_unchanged = 0;
+            monad::async::file_offset_t bytes_unchanged = 0;
+
             std::vector<chunk_info_archive_t *> tocompress;
             tocompress.reserve(
                 cnv_chunk_ids.size() + fast.size() + slow.size());
+            // cnv chunks are small and rewritten in place, so every archive
+            // carries all of them. Sealed seq chunks unchanged since the
+            // base are listed in the manifest without being copied; the WIP
+            // chunk and any after it are always carried.
+            auto live_chunk_hash =
+                [](monad::async::storage_pool::chunk_t const &chunk) {
+                    auto const [fd2, offset] = chunk.read_fd();
+                    void *const p = ::mmap(
+                        nullptr,
+                        chunk.size(),
+                        PROT_READ,
+                        MAP_SHARED,
+                        fd2,
+                        off_t(offset));
+                    if (p == MAP_FAILED) {
+                        throw std::system_error(
+                            errno, std::system_category());
+                    }
+                    auto const unmap = monad::make_scope_exit(
+                        [&]() noexcept { ::munmap(p, chunk.size()); });
+                    return hash_chunk_contents(
+                        {static_cast<std::byte const *>(p), chunk.size()});
+                };
+            auto add_seq_chunk = [&](chunk_info_archive_t &i) {
+                auto const key = i.chunk_ptr->zone_id();
+                MONAD_ASSERT(key.second < pool->chunks(pool->seq));
+                if (base_manifest.has_value() && i.sealed) {
+                    auto const it = base_manifest->records.find(key);
+                    if (it != base_manifest->records.end() &&
+                        it->second.sealed &&
+                        it->second.size == i.chunk_ptr->size() &&
+                        archive_manifest_t::same_generation(
+                            it->second.metadata, uint64_t(i.metadata)) &&
+                        live_chunk_hash(*i.chunk_ptr) == it->second.hash) {
+                        manifest.records.emplace(
+                            key,
+                            archive_manifest_t::record_t{
+                                uint64_t(i.metadata),
+                                it->second.size,
+                                it->second.hash,
+                                true});
+                        chunks_unchanged++;
+                        bytes_unchanged += it->second.size;
+                        return;
+                    }
+                }
+                tocompress.push_back(&i);
+                if (debug_printing) {
+                    std::cerr << " " << key.second;
+                }
+            };
             tocompress.push_back(&cnv_infos.back());
             for (size_t k = 1; k < cnv_chunk_ids.size(); k++) {
                 cnv_infos.emplace_back(
@@ -1364,29 +1755,27 @@ public:
             if (debug_printing) {
                 std::cerr << "Fast list:";
             }
+            // The lists are in order, so chunks are sealed until the one
+            // holding the WIP offset
+            bool sealed = true;
             for (auto &i : fast) {
+                sealed = sealed &&
+                         i.chunk_ptr->zone_id().second != wip_fast_chunk_id;
+                i.sealed = sealed;
                 if (i.chunk_ptr->size() > 0) {
-                    tocompress.push_back(&i);
-                    MONAD_ASSERT(
-                        i.chunk_ptr->zone_id().second <
-                        pool->chunks(pool->seq));
-                    if (debug_printing) {
-                        std::cerr << " " << i.chunk_ptr->zone_id().second;
-                    }
+                    add_seq_chunk(i);
                 }
             }
             if (debug_printing) {
                 std::cerr << "\nSlow list:";
             }
+            sealed = true;
             for (auto &i : slow) {
+                sealed = sealed &&
+                         i.chunk_ptr->zone_id().second != wip_slow_chunk_id;
+                i.sealed = sealed;
                 if (i.chunk_ptr->size() > 0) {
-                    tocompress.push_back(&i);
-                    MONAD_ASSERT(
-                        i.chunk_ptr->zone_id().second <
-                        pool->chunks(pool->seq));
-                    if (debug_printing) {
-                        std::cerr << " " << i.chunk_ptr->zone_id().second;
-                    }
+                    add_seq_chunk(i);
                 }
             }
             if (debug_printing) {
@@ -1453,6 +1842,18 @@ public:
                             "monad.triedb.metadata",
                             &i.metadata,
                             sizeof(i.metadata));
+                        archive_entry_xattr_add_entry(
+                            entry,
+                            "monad.triedb.blake3",
+                            i.hash.bytes,
+                            sizeof(i.hash.bytes));
+                        manifest.records.insert_or_assign(
+                            archive_manifest_t::key_t{chunktype, chunkid},
+                            archive_manifest_t::record_t{
+                                uint64_t(i.metadata),
+                                i.uncompressed.size(),
+                                i.hash,
+                                i.sealed});
                         struct timespec ts;
                         clock_gettime(CLOCK_REALTIME, &ts);
                         archive_entry_set_mtime(entry, ts.tv_sec, ts.tv_nsec);
@@ -1475,6 +1876,35 @@ public:
                     }
                 }
             }
+
+            auto const manifest_text = manifest.serialise();
+            struct archive_entry *entry = archive_entry_new();
+            if (entry == nullptr) {
+                throw std::runtime_error("libarchive failed");
+            }
+            auto const unentry = monad::make_scope_exit(
+                [&]() noexcept { archive_entry_free(entry); });
+            archive_entry_set_pathname(entry, archive_manifest_t::pathname);
+            archive_entry_set_size(entry, la_int64_t(manifest_text.size()));
+            archive_entry_set_filetype(entry, AE_IFREG);
+            archive_entry_set_perm(entry, 0644);
+            struct timespec ts;
+            clock_gettime(CLOCK_REALTIME, &ts);
+            archive_entry_set_mtime(entry, ts.tv_sec, ts.tv_nsec);
+            if (ARCHIVE_OK != archive_write_header(out, entry) ||
+                -1 == archive_write_data(
+                          out, manifest_text.data(), manifest_text.size())) {
+                std::stringstream ss;
+                ss << "libarchive failed due to " << archive_error_string(out);
+                throw std::runtime_error(ss.str());
+            }
+            if (base_manifest.has_value()) {
+                cout << "\n"
+                     << chunks_unchanged << " seq chunks ("
+                     << print_bytes(bytes_unchanged)
+                     << ") are unchanged since " << archive_base
+                     << " and were not copied." << std::endl;
+            }
         }
         cout << std::endl;
         auto const end = std::chrono::steady_clock::now();
@@ -1595,18 +2025,31 @@ opened.
                 "format (MONAD008) and ensure it is durable on disk "
                 "before exiting. Run after upgrading the monad apt "
                 "package and before starting monad services.");
-            cli.add_option(
+            auto *const archive_opt = cli.add_option(
                 "--archive",
                 impl.archive_database,
                 "archive an existing database to a compressed, portable file "
                 "which "
                 "can be later restored with this tool (implies "
                 "--allow-dirty).");
+            cli.add_option(
+                   "--archive-base",
+                   impl.archive_base,
+                   "make --archive incremental, copying only the chunks "
+                   "written or recycled since this earlier archive of the "
+                   "same database.")
+                ->needs(archive_opt);
             auto *const restore_opt = cli.add_option(
                 "--restore",
                 impl.restore_database,
                 "destroy any existing database, replacing it with the archived "
                 "database (implies --truncate).");
+            cli.add_option(
+                   "--restore-delta",
+                   impl.restore_deltas,
+                   "incremental archive to apply on top of --restore, may be "
+                   "repeated in the order the archives were taken.")
+                ->needs(restore_opt);
             cli.add_option(
                 "--chunk-capacity",
                 impl.chunk_capacity,
@@ -40,6 +40,7 @@
 #include <category/mpt/node_cache.hpp>
 #include <category/mpt/node_cursor.hpp>
 #include <category/mpt/ondisk_db_config.hpp>
+#include <category/mpt/pinned_node_cache.hpp>
 #include <category/mpt/state_machine_kind.hpp>
 #include <category/mpt/traverse.hpp>
 #include <category/mpt/trie.hpp>
@@ -48,6 +49,7 @@
 
 #include <boost/fiber/operations.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cerrno>
 #include <chrono>
@@ -168,6 +170,9 @@ AsyncIOContext::AsyncIOContext(OnDiskDbConfig const &options)
     io.set_capture_io_latencies(options.capture_io_latencies);
     io.set_concurrent_read_io_limit(options.concurrent_read_io_limit);
     io.set_eager_completions(options.eager_completions);
+    io.set_read_bandwidth_limit(
+        async::erased_connected_operation::io_priority::traversal,
+        options.traversal_read_bandwidth);
 }
 
 class Db::ROOnDiskBlocking final : public Db::Impl
@@ -455,6 +460,9 @@ private:
             , async_io(options)
             , aux{async_io.io, options.fixed_history_length}
         {
+            if (options.compact_node_encoding) {
+                aux.set_write_node_encoding(node_encoding::compact);
+            }
             if (options.rewind_to_latest_finalized) {
                 auto const latest_block_id =
                     aux.metadata_ctx().get_latest_finalized_version();
@@ -467,10 +475,12 @@ private:
             }
         }
 
-        void rodb_run(size_t const node_lru_max_mem)
+        void rodb_run(ReadOnlyOnDiskDbConfig const &options)
         {
             inflight_map_owning_t inflight;
-            NodeCache node_cache{node_lru_max_mem};
+            NodeCache node_cache{options.node_lru_max_mem};
+            PinnedNodeCache pinned{
+                options.pinned_node_levels, options.pinned_node_versions};
 
             Comms request;
             unsigned did_nothing_count = 0;
@@ -482,6 +492,7 @@ private:
                             find_owning_notify_fiber_future(
                                 aux,
                                 node_cache,
+                                pinned,
                                 inflight,
                                 std::move(req->promise),
                                 req->start,
@@ -493,6 +504,7 @@ private:
                             load_root_notify_fiber_future(
                                 aux,
                                 node_cache,
+                                pinned,
                                 inflight,
                                 std::move(req->promise),
                                 req->version);
@@ -684,7 +696,7 @@ public:
                 worker_ = std::make_unique<DbAsyncWorker>(this, options);
                 cond_.notify_one();
             }
-            worker_->rodb_run(options.node_lru_max_mem);
+            worker_->rodb_run(options);
             std::unique_lock const g(lock_);
             worker_.reset();
         })
@@ -945,17 +957,50 @@ public:
 
 struct RODb::Impl final
 {
-    std::shared_ptr<OnDiskDbServiceThread> worker_thread_;
+    // Number of leading key nibbles used to route a find request. Requests
+    // for keys sharing this prefix are served by the same worker, so the
+    // nodes on their common path are cached by that worker only.
+    static constexpr unsigned ROUTING_PREFIX_NIBBLES = 4;
 
-    explicit Impl(std::shared_ptr<OnDiskDbServiceThread> worker_thread)
-        : worker_thread_(std::move(worker_thread))
+    std::vector<std::shared_ptr<OnDiskDbServiceThread>> worker_threads_;
+    std::atomic<size_t> next_traverse_worker_{0};
+
+    explicit Impl(ReadOnlyOnDiskDbConfig const &options)
     {
-        MONAD_ASSERT(worker_thread_ != nullptr);
+        MONAD_ASSERT(options.workers > 0);
+        // Each worker opens its own storage pool, ring and AsyncIO, and caches
+        // its share of the nodes.
+        ReadOnlyOnDiskDbConfig worker_options = options;
+        worker_options.node_lru_max_mem =
+            options.node_lru_max_mem / options.workers;
+        worker_threads_.reserve(options.workers);
+        for (unsigned i = 0; i < options.workers; ++i) {
+            worker_threads_.emplace_back(
+                std::make_shared<OnDiskDbServiceThread>(worker_options));
+        }
     }
 
+    // All workers map the same db metadata, so any of them can answer
+    // metadata queries.
     UpdateAux &aux()
     {
-        return worker_thread_->aux();
+        return worker_threads_.front()->aux();
+    }
+
+    OnDiskDbServiceThread &worker_for_key(NibblesView const &key)
+    {
+        size_t prefix = 0;
+        auto const prefix_len =
+            std::min<unsigned>(key.nibble_size(), ROUTING_PREFIX_NIBBLES);
+        for (unsigned i = 0; i < prefix_len; ++i) {
+            prefix = (prefix << 4) | key.get(i);
+        }
+        return *worker_threads_[prefix % worker_threads_.size()];
+    }
+
+    OnDiskDbServiceThread &worker_for_version(uint64_t const version)
+    {
+        return *worker_threads_[version % worker_threads_.size()];
     }
 
     find_owning_cursor_result_type find_fiber_blocking(
@@ -963,7 +1008,11 @@ struct RODb::Impl final
     {
         ::boost::fibers::promise<find_owning_cursor_result_type> promise;
         auto fut = promise.get_future();
-        worker_thread_->submit(
+        // Loading the root of a version has an empty key, so spread those
+        // requests by version instead.
+        auto &worker = start.is_valid() ? worker_for_key(key)
+                                        : worker_for_version(version);
+        worker.submit(
             OnDiskDbServiceThread::RODbFiberFindOwningNodeRequest{
                 .promise = std::move(promise),
                 .start = start,
@@ -993,19 +1042,22 @@ struct RODb::Impl final
     {
         ::boost::fibers::promise<bool> promise;
         auto fut = promise.get_future();
-        worker_thread_->submit(OnDiskDbServiceThread::FiberTraverseRequest{
-            .promise = std::move(promise),
-            .root = std::move(node),
-            .machine = machine,
-            .version = version,
-            .concurrency_limit = concurrency_limit});
+        auto const worker_index =
+            next_traverse_worker_.fetch_add(1, std::memory_order_relaxed) %
+            worker_threads_.size();
+        worker_threads_[worker_index]->submit(
+            OnDiskDbServiceThread::FiberTraverseRequest{
+                .promise = std::move(promise),
+                .root = std::move(node),
+                .machine = machine,
+                .version = version,
+                .concurrency_limit = concurrency_limit});
         return fut.get();
     }
 };
 
 RODb::RODb(ReadOnlyOnDiskDbConfig const &options)
-    : impl_(std::make_unique<Impl>(
-          std::make_shared<OnDiskDbServiceThread>(options)))
+    : impl_(std::make_unique<Impl>(options))
 {
 }
 
@@ -32,13 +32,17 @@ namespace detail
                 read_long_update_sender, Receiver>)
     inline void initiate_async_read_update(
         MONAD_ASYNC_NAMESPACE::AsyncIO &io, Receiver &&receiver,
-        size_t bytes_to_read)
+        size_t bytes_to_read,
+        enum MONAD_ASYNC_NAMESPACE::erased_connected_operation::
+            io_priority const prio = MONAD_ASYNC_NAMESPACE::
+                erased_connected_operation::io_priority::normal)
     {
         [[likely]] if (
             bytes_to_read <= MONAD_ASYNC_NAMESPACE::AsyncIO::READ_BUFFER_SIZE) {
             read_short_update_sender sender(receiver);
             auto iostate = io.make_connected(
                 std::move(sender), std::forward<Receiver>(receiver));
+            iostate->set_io_priority(prio);
             iostate->initiate();
             iostate.release();
         }
@@ -48,6 +52,7 @@ namespace detail
                 io, std::move(sender), std::forward<Receiver>(receiver)));
             auto *iostate = new connected_type(connect(
                 io, std::move(sender), std::forward<Receiver>(receiver)));
+            iostate->set_io_priority(prio);
             iostate->initiate();
             // drop iostate
         }
@@ -24,6 +24,7 @@
 #include <category/mpt/node.hpp>
 #include <category/mpt/node_cache.hpp>
 #include <category/mpt/node_cursor.hpp>
+#include <category/mpt/pinned_node_cache.hpp>
 #include <category/mpt/trie.hpp>
 #include <category/mpt/util.hpp>
 
@@ -235,9 +236,14 @@ void find_notify_fiber_future(
             find_notify_fiber_future(aux, std::move(p), node_cursor, next_key);
             return success();
         };
+        // Executing fibers block upon this read
         find_receiver receiver(std::move(cont), std::move(node), branch);
         detail::initiate_async_read_update(
-            *aux.io, std::move(receiver), receiver.bytes_to_read);
+            *aux.io,
+            std::move(receiver),
+            receiver.bytes_to_read,
+            MONAD_ASYNC_NAMESPACE::erased_connected_operation::io_priority::
+                highest);
     }
     else {
         promise.set_value(
@@ -246,49 +252,59 @@ void find_notify_fiber_future(
     }
 }
 
-// Look up from node_cache first, issue read if miss and not in inflight
-// Upon read completion, deserialize node and add to node_cache
-void find_owning_notify_fiber_future(
-    UpdateAux &aux, NodeCache &node_cache, inflight_map_owning_t &inflights,
-    ::boost::fibers::promise<find_owning_cursor_result_type> promise,
-    NodeCursor const &start, NibblesView const key, uint64_t const version)
+namespace
 {
-    if (!aux.metadata_ctx().version_is_valid_ondisk(version)) {
-        promise.set_value({start, find_result::version_no_longer_exist});
-        return;
-    }
-    if (!start.is_valid()) {
-        promise.set_value(
-            {NodeCursor{}, find_result::root_node_is_null_failure});
-        return;
-    }
-    unsigned prefix_index = 0;
-    unsigned node_prefix_index = start.prefix_index;
-    auto const node = start.node;
-    for (; node_prefix_index < node->path_nibbles_len();
-         ++node_prefix_index, ++prefix_index) {
-        if (prefix_index >= key.nibble_size()) {
+    // `depth` counts the nodes below `start` that this find has descended
+    // through; nodes within the pinned levels are served from and added to
+    // `pinned` rather than competing for space in the LRU `node_cache`
+    void find_owning_notify_fiber_future_impl(
+        UpdateAux &aux, NodeCache &node_cache, PinnedNodeCache &pinned,
+        inflight_map_owning_t &inflights,
+        ::boost::fibers::promise<find_owning_cursor_result_type> promise,
+        NodeCursor const &start, NibblesView const key, uint64_t const version,
+        unsigned const depth)
+    {
+        if (!aux.metadata_ctx().version_is_valid_ondisk(version)) {
+            promise.set_value({start, find_result::version_no_longer_exist});
+            return;
+        }
+        if (!start.is_valid()) {
             promise.set_value(
-                {NodeCursor{node, node_prefix_index},
-                 find_result::key_ends_earlier_than_node_failure});
+                {NodeCursor{}, find_result::root_node_is_null_failure});
             return;
         }
-        if (key.get(prefix_index) !=
-            node->path_nibble_view().get(node_prefix_index)) {
+        unsigned prefix_index = 0;
+        unsigned node_prefix_index = start.prefix_index;
+        auto const node = start.node;
+        for (; node_prefix_index < node->path_nibbles_len();
+             ++node_prefix_index, ++prefix_index) {
+            if (prefix_index >= key.nibble_size()) {
+                promise.set_value(
+                    {NodeCursor{node, node_prefix_index},
+                     find_result::key_ends_earlier_than_node_failure});
+                return;
+            }
+            if (key.get(prefix_index) !=
+                node->path_nibble_view().get(node_prefix_index)) {
+                promise.set_value(
+                    {NodeCursor{node, node_prefix_index},
+                     find_result::key_mismatch_failure});
+                return;
+            }
+        }
+        if (prefix_index == key.nibble_size()) {
+            promise.set_value(
+                {NodeCursor{node, node_prefix_index}, find_result::success});
+            return;
+        }
+        MONAD_ASSERT(prefix_index < key.nibble_size());
+        unsigned char const branch = key.get(prefix_index);
+        if (!(node->mask & (1u << branch))) {
             promise.set_value(
                 {NodeCursor{node, node_prefix_index},
-                 find_result::key_mismatch_failure});
+                 find_result::branch_not_exist_failure});
             return;
         }
-    }
-    if (prefix_index == key.nibble_size()) {
-        promise.set_value(
-            {NodeCursor{node, node_prefix_index}, find_result::success});
-        return;
-    }
-    MONAD_ASSERT(prefix_index < key.nibble_size());
-    if (unsigned char const branch = key.get(prefix_index);
-        node->mask & (1u << branch)) {
         auto const next_key =
             key.substr(static_cast<unsigned char>(prefix_index) + 1u);
         auto const child_index = node->to_child_index(branch);
@@ -301,18 +317,40 @@ void find_owning_notify_fiber_future(
             promise.set_value({start, find_result::version_no_longer_exist});
             return;
         }
+        auto const next_depth = depth + 1;
+        bool const pin = pinned.should_pin(next_depth, version);
+        if (pin) {
+            if (auto next = pinned.find(next_virtual_offset, version)) {
+                find_owning_notify_fiber_future_impl(
+                    aux,
+                    node_cache,
+                    pinned,
+                    inflights,
+                    std::move(promise),
+                    NodeCursor{std::move(next)},
+                    next_key,
+                    version,
+                    next_depth);
+                return;
+            }
+        }
         // find in cache
         NodeCache::ConstAccessor acc;
         if (node_cache.find(acc, next_virtual_offset)) {
             NodeCursor const next_cursor{acc->second->val.first};
-            find_owning_notify_fiber_future(
+            if (pin) {
+                pinned.insert(next_virtual_offset, next_cursor.node, version);
+            }
+            find_owning_notify_fiber_future_impl(
                 aux,
                 node_cache,
+                pinned,
                 inflights,
                 std::move(promise),
                 next_cursor,
                 next_key,
-                version);
+                version,
+                next_depth);
             return;
         }
         if (aux.io->owning_thread_id() != get_tl_tid()) {
@@ -323,23 +361,32 @@ void find_owning_notify_fiber_future(
         auto cont =
             [&aux,
              &node_cache,
+             &pinned,
              &inflights,
              p = std::move(promise),
              next_key,
-             version](NodeCursor const &node_cursor) mutable -> result<void> {
+             next_virtual_offset,
+             version,
+             next_depth,
+             pin](NodeCursor const &node_cursor) mutable -> result<void> {
             if (!node_cursor.is_valid()) {
                 p.set_value(
                     {NodeCursor{}, find_result::version_no_longer_exist});
                 return success();
             }
-            find_owning_notify_fiber_future(
+            if (pin) {
+                pinned.insert(next_virtual_offset, node_cursor.node, version);
+            }
+            find_owning_notify_fiber_future_impl(
                 aux,
                 node_cache,
+                pinned,
                 inflights,
                 std::move(p),
                 node_cursor,
                 next_key,
-                version);
+                version,
+                next_depth);
             return success();
         };
         async_read_with_continuation(
@@ -350,15 +397,31 @@ void find_owning_notify_fiber_future(
             next_node_offset,
             next_virtual_offset);
     }
-    else {
-        promise.set_value(
-            {NodeCursor{node, node_prefix_index},
-             find_result::branch_not_exist_failure});
-    }
+}
+
+// Look up from the pinned levels, then node_cache, issue read if miss and not
+// in inflight. Upon read completion, deserialize node and add to node_cache
+void find_owning_notify_fiber_future(
+    UpdateAux &aux, NodeCache &node_cache, PinnedNodeCache &pinned,
+    inflight_map_owning_t &inflights,
+    ::boost::fibers::promise<find_owning_cursor_result_type> promise,
+    NodeCursor const &start, NibblesView const key, uint64_t const version)
+{
+    find_owning_notify_fiber_future_impl(
+        aux,
+        node_cache,
+        pinned,
+        inflights,
+        std::move(promise),
+        start,
+        key,
+        version,
+        0);
 }
 
 void load_root_notify_fiber_future(
-    UpdateAux &aux, NodeCache &node_cache, inflight_map_owning_t &inflights,
+    UpdateAux &aux, NodeCache &node_cache, PinnedNodeCache &pinned,
+    inflight_map_owning_t &inflights,
     ::boost::fibers::promise<find_owning_cursor_result_type> promise,
     uint64_t const version)
 {
@@ -371,10 +434,21 @@ void load_root_notify_fiber_future(
         promise.set_value({NodeCursor{}, find_result::version_no_longer_exist});
         return;
     }
+    bool const pin = pinned.should_pin(0, version);
+    if (pin) {
+        if (auto root = pinned.find(root_virtual_offset, version)) {
+            promise.set_value(
+                {NodeCursor{std::move(root)}, find_result::success});
+            return;
+        }
+    }
     NodeCache::ConstAccessor acc;
     if (node_cache.find(acc, root_virtual_offset)) {
         auto const &root = acc->second->val.first;
         MONAD_ASSERT(root != nullptr);
+        if (pin) {
+            pinned.insert(root_virtual_offset, root, version);
+        }
         promise.set_value({NodeCursor{root}, find_result::success});
         return;
     }
@@ -383,12 +457,18 @@ void load_root_notify_fiber_future(
             {NodeCursor{}, find_result::need_to_continue_in_io_thread});
         return;
     }
-    auto cont = [p = std::move(promise)](
-                    NodeCursor const &node_cursor) mutable -> result<void> {
+    auto cont = [&pinned,
+                 p = std::move(promise),
+                 root_virtual_offset,
+                 version,
+                 pin](NodeCursor const &node_cursor) mutable -> result<void> {
         if (!node_cursor.is_valid()) {
             p.set_value({node_cursor, find_result::version_no_longer_exist});
         }
         else {
+            if (pin) {
+                pinned.insert(root_virtual_offset, node_cursor.node, version);
+            }
             p.set_value({node_cursor, find_result::success});
         }
         return success();
@@ -24,6 +24,7 @@
 #include <category/mpt/util.hpp>
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cassert>
 #include <cstddef>
@@ -34,6 +35,7 @@
 #include <limits>
 #include <optional>
 #include <span>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -634,6 +636,312 @@ Node::SharedPtr create_node_with_children(
     return node;
 }
 
+namespace
+{
+    /* Compact layout, following the 32-bit size word:
+        mask (2), bitpacked (1), path_nibble_index_end (1), format (4),
+        value_len, version,
+        fnext position of the first child, zigzag position deltas of the rest,
+        fnext high bits, min offset fast, min offset slow,
+        version minus subtrie min version, child data length (1 byte each),
+        path, value, data, child data
+    The format word holds a 4-bit byte width for each packed field and the
+    value list header flag. Widths are per node, so each array is a fixed
+    stride of fixed size loads. */
+    enum compact_field : unsigned
+    {
+        cf_fnext_base,
+        cf_fnext_delta,
+        cf_fnext_high,
+        cf_min_offset,
+        cf_min_version,
+        cf_value_len,
+        cf_version,
+        cf_count
+    };
+
+    constexpr unsigned compact_width_bits = 4;
+    constexpr uint32_t compact_value_header_elided =
+        1U << (compact_width_bits * cf_count);
+    constexpr unsigned compact_header_size =
+        sizeof(uint16_t) + sizeof(Node::bitpacked) + sizeof(uint8_t) +
+        sizeof(uint32_t);
+
+    constexpr unsigned fnext_position_bits =
+        chunk_offset_t::OFFSET_BITS + chunk_offset_t::ID_BITS;
+    constexpr uint64_t fnext_position_mask =
+        (uint64_t{1} << fnext_position_bits) - 1;
+    // bits_format is always set, flip it so the high bits pack small
+    constexpr uint64_t fnext_high_flip = uint64_t{1}
+                                         << (63 - fnext_position_bits);
+
+    constexpr unsigned byte_width(uint64_t const v) noexcept
+    {
+        return static_cast<unsigned>(std::bit_width(v) + 7) / 8;
+    }
+
+    constexpr unsigned
+    compact_width(uint32_t const format, compact_field const f) noexcept
+    {
+        return (format >> (f * compact_width_bits)) &
+               ((1U << compact_width_bits) - 1);
+    }
+
+    constexpr uint64_t zigzag_encode(int64_t const v) noexcept
+    {
+        return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+    }
+
+    constexpr int64_t zigzag_decode(uint64_t const v) noexcept
+    {
+        return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+    }
+
+    // Calls f with the byte width as a constant, so that packed fields are
+    // moved with fixed size loads and stores
+    template <class F>
+    void with_width(unsigned const width, F &&f)
+    {
+        switch (width) {
+        case 0:
+            return f(std::integral_constant<unsigned, 0>{});
+        case 1:
+            return f(std::integral_constant<unsigned, 1>{});
+        case 2:
+            return f(std::integral_constant<unsigned, 2>{});
+        case 3:
+            return f(std::integral_constant<unsigned, 3>{});
+        case 4:
+            return f(std::integral_constant<unsigned, 4>{});
+        case 5:
+            return f(std::integral_constant<unsigned, 5>{});
+        case 6:
+            return f(std::integral_constant<unsigned, 6>{});
+        case 7:
+            return f(std::integral_constant<unsigned, 7>{});
+        case 8:
+            return f(std::integral_constant<unsigned, 8>{});
+        default:
+            MONAD_ABORT_PRINTF("invalid compact field width %u", width);
+        }
+    }
+
+    // Little endian, the low `width` bytes of each value
+    unsigned char *store_packed(
+        unsigned char *p, unsigned const width,
+        std::span<uint64_t const> const values) noexcept
+    {
+        with_width(width, [&]<unsigned W>(std::integral_constant<unsigned, W>) {
+            for (auto const v : values) {
+                std::memcpy(p, &v, W);
+                p += W;
+            }
+        });
+        return p;
+    }
+
+    unsigned char const *load_packed(
+        unsigned char const *p, unsigned const width,
+        std::span<uint64_t> const values) noexcept
+    {
+        with_width(width, [&]<unsigned W>(std::integral_constant<unsigned, W>) {
+            for (auto &v : values) {
+                v = 0;
+                std::memcpy(&v, p, W);
+                p += W;
+            }
+        });
+        return p;
+    }
+
+    // Writes the canonical RLP list header for a payload of len bytes
+    unsigned rlp_list_header(unsigned char (&out)[9], uint64_t const len)
+    {
+        if (len < 56) {
+            out[0] = static_cast<unsigned char>(0xc0 + len);
+            return 1;
+        }
+        unsigned const n = byte_width(len);
+        out[0] = static_cast<unsigned char>(0xf7 + n);
+        for (unsigned i = 0; i < n; ++i) {
+            out[1 + i] = static_cast<unsigned char>(len >> (8 * (n - 1 - i)));
+        }
+        return 1 + n;
+    }
+
+    // Size of the outer RLP list header of value if it is canonical and spans
+    // exactly the rest of value, so that it can be rebuilt on load, else 0
+    unsigned elidable_list_header_size(byte_string_view const value)
+    {
+        if (value.empty() || value[0] < 0xc0) {
+            return 0;
+        }
+        unsigned const size =
+            value[0] <= 0xf7 ? 1 : 1 + static_cast<unsigned>(value[0] - 0xf7);
+        if (size > value.size()) {
+            return 0;
+        }
+        unsigned char header[9];
+        return rlp_list_header(header, value.size() - size) == size &&
+                       std::memcmp(header, value.data(), size) == 0
+                   ? size
+                   : 0;
+    }
+
+    // The packed per-child fields of a node, in on-disk order
+    struct compact_children
+    {
+        // first entry is the base position, the rest zigzag deltas
+        std::array<uint64_t, 16> fnext;
+        std::array<uint64_t, 16> fnext_high;
+        std::array<uint64_t, 16> min_offset_fast;
+        std::array<uint64_t, 16> min_offset_slow;
+        std::array<uint64_t, 16> min_version;
+    };
+
+    void get_compact_children(Node const &node, compact_children &out)
+    {
+        unsigned const n = node.number_of_children();
+        uint64_t prev_position = 0;
+        for (unsigned i = 0; i < n; ++i) {
+            auto const raw = std::bit_cast<uint64_t>(node.fnext(i));
+            auto const position = raw & fnext_position_mask;
+            out.fnext[i] = i == 0 ? position
+                                  : zigzag_encode(static_cast<int64_t>(
+                                        position - prev_position));
+            prev_position = position;
+            out.fnext_high[i] = (raw >> fnext_position_bits) ^ fnext_high_flip;
+            // shifted by one so that the invalid offset packs to zero
+            out.min_offset_fast[i] =
+                static_cast<uint32_t>(node.min_offset_fast(i) + 1);
+            out.min_offset_slow[i] =
+                static_cast<uint32_t>(node.min_offset_slow(i) + 1);
+            out.min_version[i] =
+                static_cast<uint64_t>(node.version) -
+                static_cast<uint64_t>(node.subtrie_min_version(i));
+        }
+    }
+
+    uint64_t max_bits(std::span<uint64_t const> const values) noexcept
+    {
+        uint64_t bits = 0;
+        for (auto const v : values) {
+            bits |= v;
+        }
+        return bits;
+    }
+
+    node_disk_layout make_compact_layout(Node const &node)
+    {
+        node_disk_layout layout{.encoding = node_encoding::compact};
+        unsigned const n = node.number_of_children();
+        compact_children c;
+        get_compact_children(node, c);
+        std::array<uint64_t, cf_count> bits{};
+        if (n) {
+            bits[cf_fnext_base] = c.fnext[0];
+            bits[cf_fnext_delta] = max_bits({c.fnext.data() + 1, n - 1});
+            bits[cf_fnext_high] = max_bits({c.fnext_high.data(), n});
+            bits[cf_min_offset] = max_bits({c.min_offset_fast.data(), n}) |
+                                  max_bits({c.min_offset_slow.data(), n});
+            bits[cf_min_version] = max_bits({c.min_version.data(), n});
+        }
+        if (node.has_value()) {
+            layout.value_header_size = elidable_list_header_size(node.value());
+        }
+        if (layout.value_header_size) {
+            layout.format |= compact_value_header_elided;
+        }
+        bits[cf_value_len] = node.value_len - layout.value_header_size;
+        bits[cf_version] = static_cast<uint64_t>(node.version);
+        std::array<unsigned, cf_count> w;
+        for (unsigned f = 0; f < cf_count; ++f) {
+            w[f] = byte_width(bits[f]);
+            layout.format |= w[f] << (f * compact_width_bits);
+        }
+
+        size_t size = Node::disk_size_bytes + compact_header_size +
+                      w[cf_value_len] + w[cf_version];
+        if (n) {
+            size += w[cf_fnext_base] + (n - 1) * w[cf_fnext_delta] +
+                    n * (w[cf_fnext_high] + 2 * w[cf_min_offset] +
+                         w[cf_min_version] + 1);
+        }
+        size += node.path_bytes() + node.value_len -
+                layout.value_header_size + node.bitpacked.data_len +
+                node.child_data_offset(n);
+        MONAD_ASSERT(size <= Node::max_disk_size);
+        layout.disk_size = static_cast<uint32_t>(size);
+        return layout;
+    }
+
+    void encode_compact_node(
+        unsigned char *const out, Node const &node,
+        node_disk_layout const &layout)
+    {
+        auto const w = [&layout](compact_field const f) {
+            return compact_width(layout.format, f);
+        };
+        unsigned const n = node.number_of_children();
+        compact_children c;
+        get_compact_children(node, c);
+        unsigned char *p = out;
+        unaligned_store(p, layout.disk_size | Node::compact_encoding_flag);
+        p += Node::disk_size_bytes;
+        unaligned_store(p, node.mask);
+        p += sizeof(uint16_t);
+        unaligned_store(p, node.bitpacked);
+        p += sizeof(node.bitpacked);
+        *p++ = node.path_nibble_index_end;
+        unaligned_store(p, layout.format);
+        p += sizeof(uint32_t);
+        uint64_t const value_len = node.value_len - layout.value_header_size;
+        p = store_packed(p, w(cf_value_len), {&value_len, 1});
+        auto const version = static_cast<uint64_t>(node.version);
+        p = store_packed(p, w(cf_version), {&version, 1});
+        if (n) {
+            p = store_packed(p, w(cf_fnext_base), {c.fnext.data(), 1});
+            p = store_packed(
+                p, w(cf_fnext_delta), {c.fnext.data() + 1, n - 1});
+            p = store_packed(p, w(cf_fnext_high), {c.fnext_high.data(), n});
+            p = store_packed(
+                p, w(cf_min_offset), {c.min_offset_fast.data(), n});
+            p = store_packed(
+                p, w(cf_min_offset), {c.min_offset_slow.data(), n});
+            p = store_packed(p, w(cf_min_version), {c.min_version.data(), n});
+        }
+        for (unsigned i = 0; i < n; ++i) {
+            *p++ = static_cast<unsigned char>(node.child_data_len(i));
+        }
+
+        auto const copy = [&p](unsigned char const *src, size_t const len) {
+            std::memcpy(p, src, len);
+            p += len;
+        };
+        copy(node.path_data(), node.path_bytes());
+        copy(
+            node.value_data() + layout.value_header_size,
+            node.value_len - layout.value_header_size);
+        copy(node.data_data(), node.bitpacked.data_len);
+        copy(node.child_data(), node.child_data_offset(n));
+        MONAD_ASSERT(p == out + layout.disk_size);
+    }
+}
+
+node_disk_layout
+make_node_disk_layout(Node const &node, node_encoding const encoding)
+{
+    if (encoding == node_encoding::compact) {
+        return make_compact_layout(node);
+    }
+    return {.encoding = node_encoding::raw, .disk_size = node.get_disk_size()};
+}
+
+uint32_t node_disk_size(Node const &node, node_encoding const encoding)
+{
+    return make_node_disk_layout(node, encoding).disk_size;
+}
+
 void serialize_node_to_buffer(
     unsigned char *write_pos, unsigned bytes_to_append, Node const &node,
     uint32_t const disk_size, unsigned const offset)
@@ -659,6 +967,120 @@ void serialize_node_to_buffer(
     }
 }
 
+void serialize_node_to_buffer(
+    unsigned char *const write_pos, Node const &node,
+    node_disk_layout const &layout)
+{
+    if (layout.encoding == node_encoding::compact) {
+        encode_compact_node(write_pos, node, layout);
+        return;
+    }
+    serialize_node_to_buffer(
+        write_pos, layout.disk_size, node, layout.disk_size);
+}
+
+Node::SharedPtr deserialize_compact_node_from_buffer(
+    unsigned char const *p, uint32_t const base_size)
+{
+    unsigned char const *const end = p + base_size;
+    auto const mask = unaligned_load<uint16_t>(p);
+    p += sizeof(uint16_t);
+    auto const bitpacked = unaligned_load<Node::bitpacked_storage_t>(p);
+    p += sizeof(bitpacked);
+    uint8_t const path_nibble_index_end = *p++;
+    auto const format = unaligned_load<uint32_t>(p);
+    p += sizeof(uint32_t);
+    auto const w = [format](compact_field const f) {
+        return compact_width(format, f);
+    };
+    uint64_t stored_value_len;
+    p = load_packed(p, w(cf_value_len), {&stored_value_len, 1});
+    uint64_t version;
+    p = load_packed(p, w(cf_version), {&version, 1});
+
+    unsigned char value_header[9];
+    unsigned const value_header_size =
+        (format & compact_value_header_elided)
+            ? rlp_list_header(value_header, stored_value_len)
+            : 0;
+    auto const value_len = value_header_size + stored_value_len;
+
+    unsigned const n = static_cast<unsigned>(std::popcount(mask));
+    compact_children c;
+    if (n) {
+        p = load_packed(p, w(cf_fnext_base), {c.fnext.data(), 1});
+        p = load_packed(p, w(cf_fnext_delta), {c.fnext.data() + 1, n - 1});
+        p = load_packed(p, w(cf_fnext_high), {c.fnext_high.data(), n});
+        p = load_packed(p, w(cf_min_offset), {c.min_offset_fast.data(), n});
+        p = load_packed(p, w(cf_min_offset), {c.min_offset_slow.data(), n});
+        p = load_packed(p, w(cf_min_version), {c.min_version.data(), n});
+    }
+    unsigned char const *const child_len_p = p;
+    p += n;
+    unsigned total_child_data = 0;
+    for (unsigned i = 0; i < n; ++i) {
+        total_child_data += child_len_p[i];
+    }
+    unsigned const path_bytes = (path_nibble_index_end + 1u) / 2;
+
+    size_t const node_size =
+        sizeof(Node) +
+        n * (sizeof(chunk_offset_t) +
+             2 * sizeof(compact_virtual_chunk_offset_t) + sizeof(int64_t) +
+             sizeof(uint16_t)) +
+        path_bytes + value_len + bitpacked.data_len + total_child_data;
+    auto const alloc_size =
+        round_up_align<3>(node_size) + n * sizeof(Node::SharedPtr);
+    MONAD_ASSERT(alloc_size <= Node::max_size);
+    auto node = Node::make_shared(alloc_size);
+    node->mask = mask;
+    node->bitpacked = bitpacked;
+    node->path_nibble_index_end = path_nibble_index_end;
+    node->value_len = static_cast<uint32_t>(value_len);
+    node->version = static_cast<int64_t>(version);
+    auto const sp = node->child_next_data();
+    for (size_t i = 0; i < sp.size(); ++i) {
+        new (sp.data() + i) Node::SharedPtr();
+    }
+
+    auto const child_off = node->child_off_data();
+    uint64_t position = 0;
+    uint16_t child_data_offset = 0;
+    for (unsigned i = 0; i < n; ++i) {
+        position = i == 0 ? c.fnext[0]
+                          : position + static_cast<uint64_t>(
+                                           zigzag_decode(c.fnext[i]));
+        auto const high = c.fnext_high[i] ^ fnext_high_flip;
+        node->set_fnext(
+            i,
+            std::bit_cast<chunk_offset_t>(
+                position | (high << fnext_position_bits)));
+        auto fast = compact_virtual_chunk_offset_t::min_value();
+        fast.set_value(static_cast<uint32_t>(c.min_offset_fast[i] - 1));
+        auto slow = compact_virtual_chunk_offset_t::min_value();
+        slow.set_value(static_cast<uint32_t>(c.min_offset_slow[i] - 1));
+        node->set_min_offsets(i, {fast, slow});
+        node->set_subtrie_min_version(
+            i, static_cast<int64_t>(version - c.min_version[i]));
+        child_data_offset =
+            static_cast<uint16_t>(child_data_offset + child_len_p[i]);
+        child_off[i] = child_data_offset;
+    }
+
+    auto const copy = [&p](unsigned char *dst, size_t const len) {
+        std::memcpy(dst, p, len);
+        p += len;
+    };
+    copy(node->path_data(), path_bytes);
+    std::memcpy(node->value_data(), value_header, value_header_size);
+    copy(node->value_data() + value_header_size, stored_value_len);
+    copy(node->data_data(), bitpacked.data_len);
+    copy(node->child_data(), total_child_data);
+    MONAD_ASSERT(p == end);
+    MONAD_ASSERT(alloc_size == node->get_mem_size());
+    return node;
+}
+
 int64_t calc_min_version(Node const &node)
 {
     int64_t min_version = node.version;
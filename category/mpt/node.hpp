@@ -20,6 +20,7 @@
 #include <category/core/keccak.h>
 #include <category/core/math.hpp>
 #include <category/core/mem/allocators.hpp>
+#include <category/core/mem/slab_allocator.hpp>
 #include <category/core/rlp/encode.hpp>
 #include <category/core/runtime/unaligned.hpp>
 #include <category/mpt/detail/unsigned_20.hpp>
@@ -136,6 +137,9 @@ public:
     static constexpr size_t max_disk_size =
         256 * 1024 * 1024; // 256mb, same as storage chunk size
     static constexpr unsigned disk_size_bytes = sizeof(uint32_t);
+    /* set in the on-disk size word of a node written in the compact
+    encoding, sizes never reach it as max_disk_size leaves the top bits free */
+    static constexpr uint32_t compact_encoding_flag = 1U << 31;
     static constexpr size_t max_size =
         max_disk_size + max_number_of_children * KECCAK256_SIZE;
 
@@ -222,10 +226,12 @@ public:
             std::forward<Args>(args)...);
     }
 
+    // Shared nodes come from a slab pool, see `node_allocator_stats`
     template <class... Args>
     static SharedPtr make_shared(size_t bytes, Args &&...args)
     {
-        allocators::variable_size_allocator<Node> const alloc(bytes);
+        allocators::slab_variable_size_allocator<Node, Node> const alloc(
+            bytes);
         return std::allocate_shared<Node>(
             alloc,
             prevent_public_construction_tag{},
@@ -339,6 +345,7 @@ static_assert(std::is_standard_layout_v<Node>, "required by offsetof");
 
 static_assert(sizeof(Node) == 16);
 static_assert(alignof(Node) == 8);
+static_assert(Node::max_disk_size < Node::compact_encoding_flag);
 
 // ChildData is for temporarily holding a child's info, including child ptr,
 // file offset and hash data, in the update recursion.
@@ -389,6 +396,12 @@ constexpr size_t MAX_VALUE_LEN_OF_LEAF =
         0 /* number_of_children */, 0 /* child_data_size */, 0 /* value_size */,
         KECCAK256_SIZE /* path_size */, KECCAK256_SIZE /* data_size*/);
 
+// Memory behind all shared nodes of the process, across every Db and RODb
+inline SlabAllocatorStats node_allocator_stats() noexcept
+{
+    return SlabAllocator<Node>::stats();
+}
+
 Node::SharedPtr make_node(
     Node &from, NibblesView path, std::optional<byte_string_view> value,
     int64_t version);
@@ -407,10 +420,46 @@ Node::SharedPtr create_node_with_children(
     Compute &, uint16_t mask, std::span<ChildData> children, NibblesView path,
     std::optional<byte_string_view> value, int64_t version);
 
+/* On-disk node layouts. `raw` is the in-memory node minus its child pointers.
+`compact` packs each header field and per-child array to the byte width of its
+largest value, stores child offsets as deltas, derives child data offsets from
+one-byte lengths and elides a value's outer RLP list header when it can be
+rebuilt from the value length. The layout is flagged per node in the size
+word, so a db can mix both and either can be read back. */
+enum class node_encoding : uint8_t
+{
+    raw,
+    compact
+};
+
+/* A node's on-disk size and, for the compact encoding, its packed field
+widths and elided value header. Computed once per node written, and passed
+back to serialize it. */
+struct node_disk_layout
+{
+    node_encoding encoding{node_encoding::raw};
+    uint32_t disk_size{0};
+    uint32_t format{0};
+    unsigned value_header_size{0};
+};
+
+node_disk_layout make_node_disk_layout(Node const &, node_encoding);
+
+uint32_t node_disk_size(Node const &, node_encoding);
+
+// Writes bytes [offset, offset + bytes_to_write) of the raw encoding
 void serialize_node_to_buffer(
     unsigned char *write_pos, unsigned bytes_to_write, Node const &,
     uint32_t disk_size, unsigned offset = 0);
 
+// Writes the whole node, layout.disk_size bytes
+void serialize_node_to_buffer(
+    unsigned char *write_pos, Node const &, node_disk_layout const &);
+
+// Expands a node in the compact encoding, read_pos is just past the size word
+Node::SharedPtr deserialize_compact_node_from_buffer(
+    unsigned char const *read_pos, uint32_t base_size);
+
 inline Node::SharedPtr deserialize_node_from_buffer(
     unsigned char const *read_pos, size_t const max_bytes)
 {
@@ -418,11 +467,16 @@ inline Node::SharedPtr deserialize_node_from_buffer(
         __builtin_prefetch(read_pos + n, 0, 0);
     }
     // Load 32-bit node on-disk size
-    auto const disk_size = unaligned_load<uint32_t>(read_pos);
+    auto const disk_size_word = unaligned_load<uint32_t>(read_pos);
+    auto const disk_size = disk_size_word & ~Node::compact_encoding_flag;
     MONAD_ASSERT_PRINTF(
         disk_size <= max_bytes, "deserialized node disk size is %u", disk_size);
     MONAD_ASSERT(disk_size > 0 && disk_size <= Node::max_disk_size);
     read_pos += Node::disk_size_bytes;
+    if (disk_size_word & Node::compact_encoding_flag) {
+        return deserialize_compact_node_from_buffer(
+            read_pos, disk_size - Node::disk_size_bytes);
+    }
     // Load the on disk node
     auto const mask = unaligned_load<uint16_t>(read_pos);
     auto const number_of_children = static_cast<unsigned>(std::popcount(mask));
@@ -39,6 +39,12 @@ struct OnDiskDbConfig
     std::vector<std::filesystem::path> dbname_paths{};
     int64_t file_size_db{512}; // truncate files to this size
     unsigned concurrent_read_io_limit{1024};
+    // Read bandwidth cap in bytes per second for background traversals such
+    // as prefetch, zero is unlimited
+    uint64_t traversal_read_bandwidth{0};
+    // Write nodes in node_encoding::compact, nodes already on disk stay
+    // readable in either encoding
+    bool compact_node_encoding{false};
     // fixed history length if contains value, otherwise rely on db to adjust
     // history length upon disk usage
     std::optional<uint64_t> fixed_history_length{std::nullopt};
@@ -69,6 +75,16 @@ struct ReadOnlyOnDiskDbConfig
     std::vector<std::filesystem::path> dbname_paths;
     unsigned concurrent_read_io_limit{600};
     uint64_t node_lru_max_mem{100ul << 20}; // 100MB
+    // Number of RODb service threads. Each worker owns an io_uring ring,
+    // AsyncIO instance and an equal share of `node_lru_max_mem`. Reads are
+    // routed to workers by key prefix.
+    unsigned workers{1};
+    // Each worker also keeps the nodes within `pinned_node_levels` of the
+    // start of a find, for the `pinned_node_versions` most recent versions it
+    // has read, outside of the LRU (see PinnedNodeCache). Zero versions
+    // disables pinning.
+    unsigned pinned_node_levels{3};
+    unsigned pinned_node_versions{8};
 };
 
 MONAD_MPT_NAMESPACE_END
@@ -0,0 +1,122 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <category/core/assert.h>
+#include <category/mpt/config.hpp>
+#include <category/mpt/node.hpp>
+#include <category/mpt/util.hpp>
+
+#include <ankerl/unordered_dense.h>
+
+#include <cstdint>
+#include <memory>
+
+MONAD_MPT_NAMESPACE_BEGIN
+
+// Upper trie levels of the most recent versions, held outside the LRU
+// NodeCache. Nodes are keyed by virtual offset, so a node shared by several
+// versions is pinned once; each entry remembers the newest version that
+// reached it, and is released once that version leaves the window of the
+// last `versions` versions seen.
+class PinnedNodeCache final
+{
+    struct Entry
+    {
+        std::shared_ptr<Node> node;
+        uint64_t version;
+    };
+
+    ankerl::unordered_dense::segmented_map<
+        virtual_chunk_offset_t, Entry, virtual_chunk_offset_t_hasher>
+        map_;
+    unsigned const levels_;
+    unsigned const versions_;
+    uint64_t latest_version_{0};
+
+    bool in_window(uint64_t const version) const noexcept
+    {
+        return version + versions_ > latest_version_;
+    }
+
+    void advance(uint64_t const version)
+    {
+        if (version <= latest_version_) {
+            return;
+        }
+        latest_version_ = version;
+        for (auto it = map_.begin(); it != map_.end();) {
+            if (in_window(it->second.version)) {
+                ++it;
+            }
+            else {
+                it = map_.erase(it);
+            }
+        }
+    }
+
+public:
+    PinnedNodeCache(unsigned const levels, unsigned const versions)
+        : levels_{levels}
+        , versions_{versions}
+    {
+    }
+
+    // Whether a node `depth` levels below the start of a find at `version`
+    // belongs in this cache
+    bool should_pin(unsigned const depth, uint64_t const version) const noexcept
+    {
+        return versions_ != 0 && depth <= levels_ &&
+               (version > latest_version_ || in_window(version));
+    }
+
+    std::shared_ptr<Node>
+    find(virtual_chunk_offset_t const &virt_offset, uint64_t const version)
+    {
+        auto const it = map_.find(virt_offset);
+        if (it == map_.end()) {
+            return nullptr;
+        }
+        if (version > it->second.version && in_window(version)) {
+            it->second.version = version;
+        }
+        return it->second.node;
+    }
+
+    void insert(
+        virtual_chunk_offset_t const &virt_offset,
+        std::shared_ptr<Node> const &node, uint64_t const version)
+    {
+        MONAD_ASSERT(virt_offset != virtual_chunk_offset_t::invalid_value());
+        MONAD_ASSERT(node != nullptr);
+        advance(version);
+        if (!in_window(version)) {
+            return;
+        }
+        auto const [it, inserted] =
+            map_.try_emplace(virt_offset, Entry{node, version});
+        if (!inserted && version > it->second.version) {
+            it->second.version = version;
+        }
+    }
+
+    size_t size() const noexcept
+    {
+        return map_.size();
+    }
+};
+
+MONAD_MPT_NAMESPACE_END
@@ -48,9 +48,11 @@
 #include <memory>
 #include <optional>
 #include <ostream>
+#include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -975,6 +977,142 @@ TEST_F(cli_tool_archives_restores, archives_restores)
     run_test();
 }
 
+struct cli_tool_incremental_after_rewind
+    : public monad::test::FillDBWithChunksGTest<
+          monad::test::FillDBWithChunksConfig{
+              .chunks_to_fill = 4,
+              .chunks_max = 16,
+              .use_anonymous_inode = false}>
+{
+};
+
+// Rewinding trims the chunk holding the rewound-to root in place, without
+// changing its insertion count, and the versions written afterwards refill
+// and seal it again. An incremental archive against a base taken before
+// the rewind must carry the new contents of that chunk rather than reuse
+// the ones in the base.
+TEST_F(cli_tool_incremental_after_rewind, rewritten_sealed_chunk_is_copied)
+{
+    using namespace monad::mpt;
+    constexpr unsigned default_num_cnv_chunks = 17;
+
+    auto &state = *this->state();
+    char base_path[] = "cli_tool_test_XXXXXX";
+    char delta_path[] = "cli_tool_test_XXXXXX";
+    char dst_path[] = "cli_tool_test_XXXXXX";
+    for (char *path : {base_path, delta_path, dst_path}) {
+        int const fd = ::mkstemp(path);
+        ASSERT_NE(fd, -1);
+        ::close(fd);
+    }
+    auto const unfiles = monad::make_scope_exit([&]() noexcept {
+        ::unlink(base_path);
+        ::unlink(delta_path);
+        ::unlink(dst_path);
+    });
+    ASSERT_NE(
+        -1,
+        ::truncate(
+            dst_path,
+            (default_num_cnv_chunks + 16) *
+                    MONAD_ASYNC_NAMESPACE::AsyncIO::
+                        MONAD_IO_BUFFERS_WRITE_SIZE +
+                24576));
+    auto const src_path =
+        state.pool.devices().front().current_path().string();
+    auto const run = [](std::span<std::string_view> args) {
+        std::stringstream cout;
+        std::stringstream cerr;
+        int const retcode = std::async(std::launch::async, [&] {
+                                return main_impl(cout, cerr, args);
+                            }).get();
+        return std::tuple{retcode, cout.str(), cerr.str()};
+    };
+
+    {
+        std::string_view args[] = {
+            "monad-mpt", "--storage", src_path, "--archive", base_path};
+        auto const [retcode, out, err] = run(args);
+        ASSERT_EQ(retcode, 0) << "stderr: " << err << "\nstdout: " << out;
+    }
+
+    // Rewind to the newest version whose root is in the second fast chunk,
+    // which is sealed in the base archive
+    auto const &metadata = state.aux.metadata_ctx();
+    auto const sealed_chunk_id = state.fast_list_ids().at(1).first;
+    auto version = metadata.db_history_max_version();
+    while (version > metadata.db_history_min_valid_version() &&
+           metadata.root_offsets()[version].id != sealed_chunk_id) {
+        --version;
+    }
+    ASSERT_EQ(metadata.root_offsets()[version].id, sealed_chunk_id);
+    state.aux.rewind_to_version(version);
+    state.version = version + 1;
+    state.root = read_node_blocking(
+        state.aux,
+        metadata.get_latest_root_offset(),
+        version,
+        timeline_id::primary);
+    ASSERT_NE(state.root, nullptr);
+
+    auto const first_new_key = state.keys.size();
+    state.ensure_total_chunks(4);
+    auto const max_version = metadata.db_history_max_version();
+
+    {
+        std::string_view args[] = {
+            "monad-mpt",
+            "--storage",
+            src_path,
+            "--archive",
+            delta_path,
+            "--archive-base",
+            base_path};
+        auto const [retcode, out, err] = run(args);
+        ASSERT_EQ(retcode, 0) << "stderr: " << err << "\nstdout: " << out;
+    }
+    {
+        std::string_view args[] = {
+            "monad-mpt",
+            "--storage",
+            dst_path,
+            "--chunk-capacity",
+            "23",
+            "--yes",
+            "--restore",
+            base_path,
+            "--restore-delta",
+            delta_path};
+        auto const [retcode, out, err] = run(args);
+        ASSERT_EQ(retcode, 0) << "stderr: " << err << "\nstdout: " << out;
+    }
+
+    std::async(std::launch::async, [&] {
+        monad::async::storage_pool pool({{std::filesystem::path{dst_path}}});
+        monad::io::Ring ring;
+        monad::io::Buffers rwbuf = monad::io::make_buffers_for_read_only(
+            ring, 1, monad::async::AsyncIO::MONAD_IO_BUFFERS_READ_SIZE);
+        monad::async::AsyncIO io(pool, rwbuf);
+        UpdateAux const aux{io};
+        ASSERT_EQ(aux.metadata_ctx().db_history_max_version(), max_version);
+        Node::SharedPtr const root_ptr{read_node_blocking(
+            aux,
+            aux.metadata_ctx().get_latest_root_offset(),
+            max_version,
+            timeline_id::primary)};
+        NodeCursor const root(root_ptr);
+        for (size_t i = first_new_key; i < state.keys.size(); ++i) {
+            auto const ret = find_blocking(
+                aux,
+                root,
+                state.keys[i].first,
+                max_version,
+                timeline_id::primary);
+            ASSERT_EQ(ret.second, find_result::success);
+        }
+    }).get();
+}
+
 struct cli_tool_restore_preserves_kind
     : public cli_tool_fixture<config{.chunks_to_fill = 8, .chunks_max = 16}>
 {
@@ -1231,6 +1369,159 @@ TEST(cli_tool, archives_restores_with_secondary_active)
     }
 }
 
+// An incremental archive taken against a base must restore, together with
+// that base, to the database as of the incremental archive. Neither the
+// incremental archive alone nor a chain given out of order may restore.
+TEST(cli_tool, archives_restores_incrementally)
+{
+    using namespace monad::mpt;
+    using monad::literals::operator""_bytes;
+
+    auto const src_dbname = create_temp_file(8);
+    auto const dst_dbname = create_temp_file(8);
+    char base_path[] = "cli_tool_test_XXXXXX";
+    char delta_path[] = "cli_tool_test_XXXXXX";
+    for (char *path : {base_path, delta_path}) {
+        int const fd = ::mkstemp(path);
+        ASSERT_NE(fd, -1);
+        ::close(fd);
+    }
+    auto const unfiles = monad::make_scope_exit([&]() noexcept {
+        std::filesystem::remove(src_dbname);
+        std::filesystem::remove(dst_dbname);
+        ::unlink(base_path);
+        ::unlink(delta_path);
+    });
+
+    auto const k0 = 0xaabbccdd_bytes;
+    auto const v0 = 0x11223344_bytes;
+    auto const k1 = 0xeeff0011_bytes;
+    auto const v1 = 0x55667788_bytes;
+
+    OnDiskDbConfig const src_config{
+        .append = true,
+        .compaction = true,
+        .sq_thread_cpu = std::nullopt,
+        .dbname_paths = {src_dbname},
+        .fixed_history_length = MPT_TEST_HISTORY_LENGTH};
+    auto const upsert_at = [&](monad::byte_string const &key,
+                               monad::byte_string const &value,
+                               uint64_t const version) {
+        auto config = src_config;
+        config.append = version > 0;
+        Db db{std::make_unique<StateMachineAlwaysMerkle>(), config};
+        UpdateList ul;
+        auto u = make_update(NibblesView{key}, monad::byte_string_view{value});
+        ul.push_front(u);
+        auto const root = db.upsert(
+            version > 0 ? db.load_root_for_version(version - 1) : nullptr,
+            std::move(ul),
+            version);
+        ASSERT_NE(root, nullptr);
+    };
+    auto const run = [](std::span<std::string_view> args) {
+        std::stringstream cout;
+        std::stringstream cerr;
+        int const retcode = std::async(std::launch::async, [&] {
+                                return main_impl(cout, cerr, args);
+                            }).get();
+        return std::tuple{retcode, cout.str(), cerr.str()};
+    };
+
+    upsert_at(k0, v0, 0);
+    {
+        std::string_view args[] = {
+            "monad-mpt",
+            "--storage",
+            src_dbname.c_str(),
+            "--archive",
+            base_path};
+        auto const [retcode, out, err] = run(args);
+        ASSERT_EQ(retcode, 0) << "stderr: " << err << "\nstdout: " << out;
+    }
+    upsert_at(k1, v1, 1);
+    {
+        std::string_view args[] = {
+            "monad-mpt",
+            "--storage",
+            src_dbname.c_str(),
+            "--archive",
+            delta_path,
+            "--archive-base",
+            base_path};
+        auto const [retcode, out, err] = run(args);
+        ASSERT_EQ(retcode, 0) << "stderr: " << err << "\nstdout: " << out;
+        EXPECT_NE(std::string::npos, out.find("were not copied"));
+    }
+
+    {
+        std::string_view args[] = {
+            "monad-mpt",
+            "--storage",
+            dst_dbname.c_str(),
+            "--root-offsets-chunk-count",
+            "2",
+            "--yes",
+            "--restore",
+            delta_path};
+        auto const [retcode, out, err] = run(args);
+        EXPECT_NE(retcode, 0);
+        EXPECT_NE(std::string::npos, err.find("is incremental"));
+    }
+    {
+        std::string_view args[] = {
+            "monad-mpt",
+            "--storage",
+            dst_dbname.c_str(),
+            "--root-offsets-chunk-count",
+            "2",
+            "--yes",
+            "--restore",
+            delta_path,
+            "--restore-delta",
+            base_path};
+        auto const [retcode, out, err] = run(args);
+        EXPECT_NE(retcode, 0);
+        EXPECT_NE(
+            std::string::npos, err.find("is not an incremental archive"));
+    }
+    {
+        std::string_view args[] = {
+            "monad-mpt",
+            "--storage",
+            dst_dbname.c_str(),
+            "--root-offsets-chunk-count",
+            "2",
+            "--yes",
+            "--restore",
+            base_path,
+            "--restore-delta",
+            delta_path};
+        auto const [retcode, out, err] = run(args);
+        ASSERT_EQ(retcode, 0) << "stderr: " << err << "\nstdout: " << out;
+        EXPECT_NE(
+            std::string::npos, out.find("Database has been restored from"));
+    }
+
+    {
+        OnDiskDbConfig const config{
+            .append = true,
+            .compaction = true,
+            .sq_thread_cpu = std::nullopt,
+            .dbname_paths = {dst_dbname},
+            .fixed_history_length = MPT_TEST_HISTORY_LENGTH};
+        Db db{std::make_unique<StateMachineAlwaysMerkle>(), config};
+        Node::SharedPtr const root = db.load_root_for_version(1);
+        ASSERT_NE(root, nullptr);
+        auto const r0 = db.find(NodeCursor{root}, NibblesView{k0}, 1);
+        ASSERT_TRUE(r0.has_value());
+        EXPECT_EQ(monad::byte_string{r0.value().node->value()}, v0);
+        auto const r1 = db.find(NodeCursor{root}, NibblesView{k1}, 1);
+        ASSERT_TRUE(r1.has_value());
+        EXPECT_EQ(monad::byte_string{r1.value().node->value()}, v1);
+    }
+}
+
 // Round-trips a Db after promote_secondary_to_primary +
 // deactivate_secondary_timeline, where primary_ring_idx == 1 and the
 // live data sits on the physical ring named by secondary_timeline (now
@@ -611,6 +611,47 @@ TEST_F(ROOnDiskWithFileFixture, nonblocking_rodb)
     }
 }
 
+TEST_F(ROOnDiskWithFileFixture, nonblocking_rodb_multiple_workers)
+{
+    RODb multi_worker_db(ReadOnlyOnDiskDbConfig{
+        .dbname_paths = this->config.dbname_paths,
+        .node_lru_max_mem = 400 * NodeCache::AVERAGE_NODE_SIZE,
+        .workers = 4});
+    EXPECT_EQ(multi_worker_db.get_latest_version(), num_blocks - 1);
+    EXPECT_EQ(
+        multi_worker_db.get_earliest_version(), ro_db.get_earliest_version());
+
+    std::shared_ptr<boost::fibers::promise<void>[]> promises{
+        new boost::fibers::promise<void>[num_blocks]};
+
+    // Keys of each block are spread over all workers by their prefix
+    for (unsigned b = 0; b < num_blocks; ++b) {
+        pool.submit(0, [b = b, &db = multi_worker_db, promises = promises] {
+            unsigned const start_index = b * keys_per_block;
+            for (unsigned i = start_index; i < start_index + keys_per_block;
+                 ++i) {
+                auto const kv_bytes = keccak_int_to_string(i);
+                auto const res = db.find(kv_bytes, b);
+                ASSERT_TRUE(res.has_value());
+                EXPECT_EQ(res.value().node->value(), kv_bytes);
+            }
+            // Find relative to a cursor loaded by another worker
+            auto const root = db.find({}, b);
+            ASSERT_TRUE(root.has_value());
+            auto const kv_bytes = keccak_int_to_string(start_index);
+            auto const res = db.find(root.value(), kv_bytes, b);
+            ASSERT_TRUE(res.has_value());
+            EXPECT_EQ(res.value().node->value(), kv_bytes);
+            ASSERT_TRUE(db.find({}, num_blocks + b).has_error());
+            promises[b].set_value();
+        });
+    }
+
+    for (unsigned i = 0; i < num_blocks; ++i) {
+        promises[i].get_future().get();
+    }
+}
+
 TEST_F(OnDiskDbWithFileAsyncFixture, read_only_db_single_thread_async)
 {
     auto const &kv = fixed_updates::kv;
@@ -1472,6 +1513,58 @@ TEST(DbTest, out_of_order_upserts_with_compaction)
     EXPECT_GT(fast_n, 0);
 }
 
+TEST(DbTest, compact_node_encoding_survives_reopen)
+{
+    auto const dbname = create_temp_file(3); // 3Gb db
+    auto const undb = monad::make_scope_exit(
+        [&]() noexcept { std::filesystem::remove(dbname); });
+    OnDiskDbConfig config{
+        .compaction = true,
+        .sq_thread_cpu{std::nullopt},
+        .dbname_paths = {dbname},
+        .compact_node_encoding = true,
+        .fixed_history_length = MPT_TEST_HISTORY_LENGTH};
+
+    auto const prefix = 0x00_bytes;
+    constexpr unsigned keys_per_version = 5;
+    constexpr uint64_t versions = 300;
+    std::vector<monad::byte_string> keys;
+    {
+        Db db{std::make_unique<StateMachineAlwaysMerkle>(), config};
+        Node::SharedPtr root = nullptr;
+        for (uint64_t block_id = 0; block_id < versions; ++block_id) {
+            for (unsigned i = 0; i < keys_per_version; ++i) {
+                keys.emplace_back(keccak_int_to_string(keys.size()));
+            }
+            auto const *const kv = &keys[keys.size() - keys_per_version];
+            root = upsert_updates_flat_list(
+                std::move(root),
+                db,
+                prefix,
+                block_id,
+                make_update(kv[0], kv[0]),
+                make_update(kv[1], kv[1]),
+                make_update(kv[2], kv[2]),
+                make_update(kv[3], kv[3]),
+                make_update(kv[4], kv[4]));
+        }
+        ASSERT_EQ(db.get_latest_version(), versions - 1);
+    }
+
+    // Nodes written in compact encoding, including those rewritten by
+    // compaction, must load back after reopening
+    config.append = true;
+    Db db{std::make_unique<StateMachineAlwaysMerkle>(), config};
+    ASSERT_EQ(db.get_latest_version(), versions - 1);
+    auto const root = db.load_root_for_version(versions - 1);
+    ASSERT_NE(root, nullptr);
+    for (auto const &key : keys) {
+        auto const res = db_get(db, root, prefix + key, versions - 1);
+        ASSERT_TRUE(res.has_value());
+        EXPECT_EQ(res.value(), key);
+    }
+}
+
 TYPED_TEST(DbTest, simple_with_same_prefix)
 {
     auto const &kv = fixed_updates::kv;
@@ -18,6 +18,7 @@
 #include <category/mpt/nibbles_view.hpp>
 #include <category/mpt/node.hpp>
 #include <category/mpt/node_cache.hpp>
+#include <category/mpt/pinned_node_cache.hpp>
 
 #include <gtest/gtest.h>
 
@@ -102,3 +103,38 @@ TEST(NodeCache, works)
     ASSERT_TRUE(node_cache.find(acc, virtual_chunk_offset_t(1, 0, 0)));
     EXPECT_EQ(get_acc_value(), 0xdead);
 }
+
+TEST(PinnedNodeCache, keeps_recent_versions)
+{
+    PinnedNodeCache pinned(2, 3);
+    auto const node = monad::mpt::make_node(0, {}, {}, {}, 0, 0);
+    virtual_chunk_offset_t const shared(1, 0, 1);
+    virtual_chunk_offset_t const old(2, 0, 1);
+
+    EXPECT_TRUE(pinned.should_pin(2, 10));
+    EXPECT_FALSE(pinned.should_pin(3, 10));
+
+    pinned.insert(shared, node, 10);
+    pinned.insert(old, node, 10);
+    EXPECT_EQ(pinned.size(), 2);
+
+    // a node reached again from a newer version stays pinned for it
+    pinned.insert(virtual_chunk_offset_t(3, 0, 1), node, 11);
+    EXPECT_EQ(pinned.find(shared, 11), node);
+    EXPECT_EQ(pinned.size(), 3);
+
+    // version 10 leaves the window
+    pinned.insert(virtual_chunk_offset_t(4, 0, 1), node, 13);
+    EXPECT_EQ(pinned.size(), 3);
+    EXPECT_EQ(pinned.find(old, 13), nullptr);
+    EXPECT_EQ(pinned.find(shared, 13), node);
+    EXPECT_FALSE(pinned.should_pin(0, 10));
+    EXPECT_TRUE(pinned.should_pin(0, 11));
+
+    // inserts for versions outside the window are ignored
+    pinned.insert(old, node, 10);
+    EXPECT_EQ(pinned.find(old, 13), nullptr);
+
+    PinnedNodeCache disabled(2, 0);
+    EXPECT_FALSE(disabled.should_pin(0, 10));
+}
@@ -13,12 +13,14 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <category/async/config.hpp>
 #include <category/core/byte_string.hpp>
 #include <category/core/hex.hpp>
 #include <category/core/test_util/gtest_signal_stacktrace_printer.hpp> // NOLINT
 #include <category/mpt/compute.hpp>
 #include <category/mpt/nibbles_view.hpp>
 #include <category/mpt/node.hpp>
+#include <category/mpt/util.hpp>
 
 #include <gtest/gtest.h>
 
@@ -184,3 +186,72 @@ TEST(NodeTest, super_large_node)
         node->get_disk_size(),
         value_len + sizeof(Node) + Node::disk_size_bytes);
 }
+
+TEST(NodeTest, compact_encoding_round_trip)
+{
+    DummyCompute comp{};
+    NibblesView const path1{12, 16, path.data()};
+    // an RLP list, whose header the compact encoding elides
+    auto const list_value = 0xc4837a6b5c_bytes;
+
+    ChildData children[2] = {ChildData{.len = 1}, ChildData{.len = 1}};
+    children[0].data[0] = 0xa;
+    children[1].data[0] = 0xb;
+    children[0].branch = 0xa;
+    children[1].branch = 0xc;
+    children[0].ptr = make_node(0, {}, path1, list_value, {}, 0);
+    children[1].ptr = make_node(0, {}, path1, list_value, {}, 0);
+
+    NibblesView const path2{1, 10, path.data()};
+    uint16_t const mask = (1u << 0xa) | (1u << 0xc);
+    Node::SharedPtr const node{
+        create_node_with_children(comp, mask, children, path2, list_value, 7)};
+    node->set_fnext(0, chunk_offset_t{3, 4096, 1});
+    node->set_fnext(1, chunk_offset_t{3, 8192, 2});
+    node->set_min_offsets(
+        0,
+        {compact_virtual_chunk_offset_t{virtual_chunk_offset_t{3, 4096, 1}},
+         compact_virtual_chunk_offset_t::invalid_value()});
+    node->set_min_offsets(
+        1,
+        {compact_virtual_chunk_offset_t::invalid_value(),
+         compact_virtual_chunk_offset_t{virtual_chunk_offset_t{5, 0, 0}}});
+    node->set_subtrie_min_version(0, 5);
+    node->set_subtrie_min_version(1, 7);
+
+    auto const layout = make_node_disk_layout(*node, node_encoding::compact);
+    EXPECT_EQ(layout.disk_size, node_disk_size(*node, node_encoding::compact));
+    EXPECT_LT(layout.disk_size, node_disk_size(*node, node_encoding::raw));
+
+    monad::byte_string buffer(layout.disk_size, 0);
+    serialize_node_to_buffer(buffer.data(), *node, layout);
+
+    auto const loaded = deserialize_node_from_buffer(buffer.data(), 4096);
+    EXPECT_EQ(loaded->mask, node->mask);
+    EXPECT_EQ(loaded->version, node->version);
+    EXPECT_EQ(loaded->value(), list_value);
+    EXPECT_EQ(loaded->path_nibble_view(), path2);
+    EXPECT_EQ(loaded->data(), node->data());
+    EXPECT_EQ(loaded->get_mem_size(), node->get_mem_size());
+    EXPECT_EQ(loaded->get_disk_size(), node->get_disk_size());
+    for (unsigned i = 0; i < node->number_of_children(); ++i) {
+        EXPECT_EQ(loaded->fnext(i), node->fnext(i));
+        EXPECT_EQ(loaded->fnext(i).spare, node->fnext(i).spare);
+        EXPECT_EQ(loaded->min_offset_fast(i), node->min_offset_fast(i));
+        EXPECT_EQ(loaded->min_offset_slow(i), node->min_offset_slow(i));
+        EXPECT_EQ(
+            loaded->subtrie_min_version(i), node->subtrie_min_version(i));
+        EXPECT_EQ(loaded->child_data_view(i), node->child_data_view(i));
+    }
+
+    // the raw encoding still round trips through the same entry point
+    auto const raw_size = node_disk_size(*node, node_encoding::raw);
+    monad::byte_string raw(raw_size, 0);
+    serialize_node_to_buffer(
+        raw.data(),
+        *node,
+        make_node_disk_layout(*node, node_encoding::raw));
+    EXPECT_EQ(
+        deserialize_node_from_buffer(raw.data(), raw_size)->value(),
+        list_value);
+}
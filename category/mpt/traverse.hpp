@@ -274,7 +274,11 @@ namespace detail
                    idx > reads_to_initiate_sidx) {
                 while (outstanding_reads < max_outstanding_reads &&
                        !reads_to_initiate[idx].empty()) {
-                    async_read(aux, std::move(reads_to_initiate[idx].front()));
+                    async_read(
+                        aux,
+                        std::move(reads_to_initiate[idx].front()),
+                        async::erased_connected_operation::io_priority::
+                            traversal);
                     ++outstanding_reads;
                     reads_to_initiate[idx].pop_front();
                     --reads_to_initiate_count;
@@ -377,7 +381,11 @@ namespace detail
                         ++sender.reads_to_initiate_count;
                         continue;
                     }
-                    async_read(sender.aux, std::move(receiver));
+                    async_read(
+                        sender.aux,
+                        std::move(receiver),
+                        async::erased_connected_operation::io_priority::
+                            traversal);
                     ++sender.outstanding_reads;
                 }
                 else {
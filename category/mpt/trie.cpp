@@ -323,7 +323,11 @@ struct load_all_impl_
                 if (next == nullptr) {
                     receiver_t receiver(
                         this, NodeCursor{node}, uint8_t(idx), sm.clone());
-                    async_read(aux, std::move(receiver));
+                    async_read(
+                        aux,
+                        std::move(receiver),
+                        MONAD_ASYNC_NAMESPACE::erased_connected_operation::
+                            io_priority::traversal);
                 }
                 else {
                     process(NodeCursor{std::move(next)}, sm);
@@ -1153,7 +1157,11 @@ void expire_(
             },
             node_offset};
         aux.collect_expire_stats(true);
-        async_read(aux, std::move(recv));
+        async_read(
+            aux,
+            std::move(recv),
+            MONAD_ASYNC_NAMESPACE::erased_connected_operation::io_priority::
+                compaction);
         return;
     }
     MONAD_ASSERT(sm.auto_expire() == true && sm.compact() == true);
@@ -1287,7 +1295,11 @@ void compact_(
             },
             node_offset};
         aux.collect_compaction_read_stats(node_offset, recv.bytes_to_read, tid);
-        async_read(aux, std::move(recv));
+        async_read(
+            aux,
+            std::move(recv),
+            MONAD_ASYNC_NAMESPACE::erased_connected_operation::io_priority::
+                compaction);
         return;
     }
     // Only compact nodes < compaction range (either fast or slow) to slow,
@@ -1313,7 +1325,7 @@ void compact_(
         copy_node_for_fast_or_slow,
         rewrite_to_fast,
         virtual_node_offset,
-        compact_node.get_disk_size(),
+        node_disk_size(compact_node, aux.write_node_encoding()),
         tid);
 
     unsigned const n = compact_node.number_of_children();
@@ -1569,10 +1581,30 @@ node_writer_unique_ptr_type replace_node_writer(
 async_write_node_result async_write_node(
     UpdateAux &aux, node_writer_unique_ptr_type &node_writer, Node const &node)
 {
+    auto const layout = make_node_disk_layout(node, aux.write_node_encoding());
+    auto const size = layout.disk_size;
+    // A compact node straddling write buffers is encoded once into scratch
+    // and copied out a slice at a time. The scratch is taken from aux while
+    // in use, as a reentrant write may need one of its own.
+    std::vector<unsigned char> scratch;
+    auto const serialize_slice = [&](unsigned char *const where,
+                                     unsigned const bytes_to_append,
+                                     unsigned const offset) {
+        if (layout.encoding == node_encoding::raw) {
+            serialize_node_to_buffer(
+                where, bytes_to_append, node, size, offset);
+            return;
+        }
+        if (scratch.empty()) {
+            scratch = std::move(aux.node_encode_scratch());
+            scratch.resize(size);
+            serialize_node_to_buffer(scratch.data(), node, layout);
+        }
+        std::memcpy(where, scratch.data() + offset, bytes_to_append);
+    };
 retry:
     aux.io->poll_nonblocking_if_not_within_completions(1);
     auto *sender = &node_writer->sender();
-    auto const size = node.get_disk_size();
     auto const remaining_bytes = sender->remaining_buffer_bytes();
     async_write_node_result ret{
         .offset_written_to = INVALID_OFFSET,
@@ -1585,7 +1617,7 @@ retry:
         auto *where_to_serialize = sender->advance_buffer_append(size);
         MONAD_ASSERT(where_to_serialize != nullptr);
         serialize_node_to_buffer(
-            (unsigned char *)where_to_serialize, size, node, size);
+            (unsigned char *)where_to_serialize, node, layout);
     }
     else {
         auto const chunk_remaining_bytes =
@@ -1613,12 +1645,8 @@ retry:
                 (unsigned char *)node_writer->sender().advance_buffer_append(
                     bytes_to_append);
             MONAD_ASSERT(where_to_serialize != nullptr);
-            serialize_node_to_buffer(
-                where_to_serialize,
-                bytes_to_append,
-                node,
-                size,
-                offset_in_on_disk_node);
+            serialize_slice(
+                where_to_serialize, bytes_to_append, offset_in_on_disk_node);
             offset_in_on_disk_node += bytes_to_append;
             new_node_writer = replace_node_writer(aux, node_writer);
             if (!new_node_writer) {
@@ -1650,12 +1678,8 @@ retry:
             auto const bytes_to_append = std::min(
                 (unsigned)node_writer->sender().remaining_buffer_bytes(),
                 size - offset_in_on_disk_node);
-            serialize_node_to_buffer(
-                where_to_serialize,
-                bytes_to_append,
-                node,
-                size,
-                offset_in_on_disk_node);
+            serialize_slice(
+                where_to_serialize, bytes_to_append, offset_in_on_disk_node);
             offset_in_on_disk_node += bytes_to_append;
             MONAD_ASSERT(offset_in_on_disk_node <= size);
             MONAD_ASSERT(
@@ -1682,6 +1706,9 @@ retry:
             }
         }
     }
+    if (!scratch.empty()) {
+        aux.node_encode_scratch() = std::move(scratch);
+    }
     return ret;
 }
 
@@ -1696,17 +1723,17 @@ async_write_node_set_spare(UpdateAux &aux, Node &node, bool write_to_fast)
         aux.set_can_write_to_fast(!aux.can_write_to_fast());
     }
 
-    auto off = async_write_node(
-                   aux,
-                   write_to_fast ? aux.node_writer_fast : aux.node_writer_slow,
-                   node)
-                   .offset_written_to;
+    auto const written = async_write_node(
+        aux,
+        write_to_fast ? aux.node_writer_fast : aux.node_writer_slow,
+        node);
+    auto off = written.offset_written_to;
     MONAD_ASSERT(
         (write_to_fast &&
          aux.metadata_ctx().main()->at(off.id)->in_fast_list) ||
         (!write_to_fast &&
          aux.metadata_ctx().main()->at(off.id)->in_slow_list));
-    unsigned const pages = num_pages(off.offset, node.get_disk_size());
+    unsigned const pages = num_pages(off.offset, written.bytes_appended);
     off.set_spare(static_cast<uint16_t>(node_disk_pages_spare_15{pages}));
     return off;
 }
@@ -232,6 +232,11 @@ class UpdateAux
     bool alternate_slow_fast_writer_{false};
     bool can_write_to_fast_{true};
 
+    // Layout of newly written nodes, existing nodes are read in whichever
+    // layout they were written with
+    node_encoding write_node_encoding_{node_encoding::raw};
+    std::vector<unsigned char> node_encode_scratch_;
+
 public:
     // Allocate the first cnv chunk for db metadata copies
     static constexpr unsigned cnv_chunks_for_db_metadata = 1;
@@ -351,6 +356,22 @@ public:
         can_write_to_fast_ = v;
     }
 
+    node_encoding write_node_encoding() const noexcept
+    {
+        return write_node_encoding_;
+    }
+
+    void set_write_node_encoding(node_encoding const encoding) noexcept
+    {
+        write_node_encoding_ = encoding;
+    }
+
+    // Reused to encode compact nodes that straddle write buffers
+    std::vector<unsigned char> &node_encode_scratch() noexcept
+    {
+        return node_encode_scratch_;
+    }
+
     constexpr bool is_in_memory() const noexcept
     {
         return io == nullptr;
@@ -388,7 +409,11 @@ template <receiver Receiver>
         MONAD_ASYNC_NAMESPACE::compatible_sender_receiver<
             read_long_update_sender, Receiver> &&
         Receiver::lifetime_managed_internally)
-void async_read(UpdateAux &aux, Receiver &&receiver)
+void async_read(
+    UpdateAux &aux, Receiver &&receiver,
+    enum MONAD_ASYNC_NAMESPACE::erased_connected_operation::io_priority const
+        prio = MONAD_ASYNC_NAMESPACE::erased_connected_operation::io_priority::
+            normal)
 {
     [[likely]] if (
         receiver.bytes_to_read <=
@@ -396,6 +421,7 @@ void async_read(UpdateAux &aux, Receiver &&receiver)
         read_short_update_sender sender(receiver);
         auto iostate = aux.io->make_connected(
             std::move(sender), std::forward<Receiver>(receiver));
+        iostate->set_io_priority(prio);
         iostate->initiate();
         // TEMPORARY UNTIL ALL THIS GETS BROKEN OUT: Release
         // management until i/o completes
@@ -407,6 +433,7 @@ void async_read(UpdateAux &aux, Receiver &&receiver)
             *aux.io, std::move(sender), std::forward<Receiver>(receiver)));
         auto *iostate = new connected_type(connect(
             *aux.io, std::move(sender), std::forward<Receiver>(receiver)));
+        iostate->set_io_priority(prio);
         iostate->initiate();
         // drop iostate
     }
@@ -488,6 +515,7 @@ struct fiber_find_request_t
 #endif
 
 class NodeCache;
+class PinnedNodeCache;
 
 /*! \brief Walk the trie and resolve `key` into the promise.
 
@@ -508,13 +536,13 @@ void find_notify_fiber_future(
 
 // rodb
 void find_owning_notify_fiber_future(
-    UpdateAux &, NodeCache &, inflight_map_owning_t &,
+    UpdateAux &, NodeCache &, PinnedNodeCache &, inflight_map_owning_t &,
     ::boost::fibers::promise<find_owning_cursor_result_type> promise,
     NodeCursor const &start, NibblesView, uint64_t version);
 
 // rodb load root
 void load_root_notify_fiber_future(
-    UpdateAux &, NodeCache &, inflight_map_owning_t &,
+    UpdateAux &, NodeCache &, PinnedNodeCache &, inflight_map_owning_t &,
     ::boost::fibers::promise<find_owning_cursor_result_type> promise,
     uint64_t version);
 
@@ -574,6 +574,9 @@ Node::SharedPtr UpdateAux::do_update(
     root_updates.push_front(root_update);
 
     Stopwatch<std::chrono::microseconds> const upsert_timer;
+    // The block commit waits on every read of the upsert, compaction reads
+    // included, so none of them may be held back by a bandwidth cap
+    auto const foreground_reads = io->foreground_reads();
     auto root = upsert(
         *this,
         version,
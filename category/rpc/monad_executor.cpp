@@ -49,6 +49,7 @@
 #include <category/execution/ethereum/execute_block.hpp>
 #include <category/execution/ethereum/execute_block_header.hpp>
 #include <category/execution/ethereum/execute_transaction.hpp>
+#include <category/execution/ethereum/precompile_cache.hpp>
 #include <category/execution/ethereum/rlp/decode.hpp>
 #include <category/execution/ethereum/state2/block_state.hpp>
 #include <category/execution/ethereum/state3/state.hpp>
@@ -1252,8 +1253,8 @@ struct monad_executor
         monad_executor_pool_config const &low_pool_config,
         monad_executor_pool_config const &high_pool_config,
         monad_executor_pool_config const &block_pool_config,
-        unsigned const tx_exec_num_fibers,
-        uint64_t const node_lru_max_mem, std::string const &triedb_path)
+        unsigned const tx_exec_num_fibers, uint64_t const node_lru_max_mem,
+        unsigned const triedb_num_workers, std::string const &triedb_path)
         : low_gas_pool_{Pool::Type::low, low_pool_config}
         , high_gas_pool_{Pool::Type::high, high_pool_config}
         , trace_thread_pool_{block_pool_config.num_threads, true}
@@ -1281,7 +1282,9 @@ struct monad_executor
             // thread local storage gets instantiated on the one thread its
             // used
             auto const config = mpt::ReadOnlyOnDiskDbConfig{
-                .dbname_paths = paths, .node_lru_max_mem = node_lru_max_mem};
+                .dbname_paths = paths,
+                .node_lru_max_mem = node_lru_max_mem,
+                .workers = triedb_num_workers};
             return mpt::RODb{config};
         }()}
     {
@@ -2028,20 +2031,29 @@ monad_executor *monad_executor_create(
     monad_executor_pool_config const high_pool_conf,
     monad_executor_pool_config const block_pool_conf,
     unsigned const tx_exec_num_fibers, uint64_t const node_lru_max_mem,
-    char const *const dbpath)
+    unsigned const triedb_num_workers, char const *const dbpath)
 {
     uint64_t const hash_seed = set_hash_seed();
     LOG_INFO("rpc: hashtable seed: {}", hash_seed);
 
     MONAD_ASSERT(dbpath);
+    MONAD_ASSERT(triedb_num_workers > 0);
     std::string const triedb_path{dbpath};
 
+    // eth_call and eth_estimateGas repeat the same expensive precompile
+    // calls across requests; the cache is process-wide, so every executor
+    // of the process shares it
+    if (precompile_cache() == nullptr) {
+        init_precompile_cache();
+    }
+
     monad_executor *const e = new monad_executor(
         low_pool_conf,
         high_pool_conf,
         block_pool_conf,
         tx_exec_num_fibers,
         node_lru_max_mem,
+        triedb_num_workers,
         triedb_path);
 
     return e;
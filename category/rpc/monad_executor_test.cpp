@@ -37,6 +37,7 @@
 #include <category/execution/ethereum/db/test/commit_simple.hpp>
 #include <category/execution/ethereum/db/trie_db.hpp>
 #include <category/execution/ethereum/db/util.hpp>
+#include <category/execution/ethereum/precompile_cache.hpp>
 #include <category/execution/ethereum/reserve_balance.hpp>
 #include <category/execution/ethereum/rlp/encode2.hpp>
 #include <category/execution/ethereum/state2/block_state.hpp>
@@ -106,6 +107,8 @@ namespace
 {
     constexpr uint64_t node_lru_max_mem =
         10240 * mpt::NodeCache::AVERAGE_NODE_SIZE;
+    // More than one worker, so that reads are routed across rings
+    constexpr unsigned triedb_num_workers = 2;
     constexpr unsigned max_timeout = std::numeric_limits<unsigned>::max();
     auto const rlp_finalized_id = rlp::encode_bytes32(bytes32_t{});
     auto const simulate_gas_limit = std::numeric_limits<uint64_t>::max();
@@ -121,6 +124,7 @@ namespace
             conf,
             tx_exec_num_fibers,
             node_lru_max_mem,
+            triedb_num_workers,
             dbname.c_str());
     }
 
@@ -362,6 +366,69 @@ TEST_F(EthCallFixture, simple_success_call)
     monad_executor_destroy(executor);
 }
 
+TEST_F(EthCallFixture, precompile_results_are_cached)
+{
+    for (uint64_t i = 0; i < 256; ++i) {
+        commit_sequential(tdb, StateDeltas({}), {}, BlockHeader{.number = i});
+    }
+
+    static constexpr auto from{
+        0xf8636377b7a998b51a3cf2bd711b870b3ab0ad56_address};
+    static constexpr auto ecrecover{
+        0x0000000000000000000000000000000000000001_address};
+
+    Transaction const tx{
+        .gas_limit = 100000u,
+        .to = ecrecover,
+        .type = TransactionType::eip1559,
+        .data = byte_string(128, 0x01)};
+    BlockHeader const header{.number = 256};
+
+    commit_sequential(tdb, StateDeltas({}), {}, header);
+
+    auto const rlp_tx = to_vec(rlp::encode_transaction(tx));
+    auto const rlp_header = to_vec(rlp::encode_block_header(header));
+    auto const rlp_sender =
+        to_vec(rlp::encode_address(std::make_optional(from)));
+    auto const rlp_block_id = to_vec(rlp_finalized_id);
+
+    auto *executor = create_executor(dbname.string());
+    PrecompileCache const *const cache = precompile_cache();
+    ASSERT_NE(cache, nullptr);
+    uint64_t const hits_before = cache->hits();
+
+    for (int i = 0; i < 2; ++i) {
+        auto *state_override = monad_state_override_create();
+        struct callback_context ctx;
+        boost::fibers::future<void> f = ctx.promise.get_future();
+        monad_executor_eth_call_submit(
+            executor,
+            CHAIN_CONFIG_MONAD_DEVNET,
+            rlp_tx.data(),
+            rlp_tx.size(),
+            rlp_header.data(),
+            rlp_header.size(),
+            rlp_sender.data(),
+            rlp_sender.size(),
+            header.number,
+            rlp_block_id.data(),
+            rlp_block_id.size(),
+            state_override,
+            complete_callback,
+            (void *)&ctx,
+            NOOP_TRACER,
+            true);
+        f.get();
+        EXPECT_EQ(ctx.result->status_code, EVMC_SUCCESS);
+        monad_state_override_destroy(state_override);
+    }
+
+    // the second call is served from the cache
+    EXPECT_GT(cache->hits(), hits_before);
+
+    monad_executor_destroy(executor);
+}
+
 TEST_F(EthCallFixture, insufficient_balance)
 {
     for (uint64_t i = 0; i < 256; ++i) {
@@ -5475,6 +5542,7 @@ TEST_F(EthCallFixture, eth_simulate_v1_stress_queue_rejection)
         block_conf,
         tx_exec_num_fibers,
         node_lru_max_mem,
+        triedb_num_workers,
         dbname.string().c_str());
 
     // Build a minimal valid simulation payload (one call, no overrides).
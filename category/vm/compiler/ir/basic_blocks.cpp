@@ -85,6 +85,56 @@ namespace monad::vm::compiler::basic_blocks
         return all_blocks_valid && all_dests_valid;
     }
 
+    std::vector<bool> single_entry_blocks(BasicBlocksIR const &ir)
+    {
+        auto const &blocks = ir.blocks();
+        std::vector<bool> result(blocks.size(), false);
+
+        // Count the jumps to each destination that is statically known from
+        // a `PUSH` immediately before the jump. If any jump has a dynamic
+        // destination, then every `JUMPDEST` block is potentially a jump
+        // target.
+        bool has_dynamic_jump = false;
+        std::unordered_map<byte_offset, size_t> literal_targets;
+        for (auto const &block : blocks) {
+            if (block.terminator != Terminator::Jump &&
+                block.terminator != Terminator::JumpI) {
+                continue;
+            }
+            if (block.instrs.empty() ||
+                block.instrs.back().opcode() != OpCode::Push) {
+                has_dynamic_jump = true;
+                break;
+            }
+            auto const &dest = block.instrs.back().immediate_value();
+            if (dest < *ir.codesize) {
+                ++literal_targets[dest[0]];
+            }
+        }
+
+        for (block_id id = 1; id < blocks.size(); ++id) {
+            auto const &prev = blocks[id - 1];
+            auto const offset = blocks[id].offset;
+            bool const is_jump_dest = ir.jump_dests().contains(offset);
+            if (is_fallthrough_terminator(prev.terminator)) {
+                result[id] = !is_jump_dest ||
+                             (!has_dynamic_jump &&
+                              !literal_targets.contains(offset));
+            }
+            else if (
+                prev.terminator == Terminator::Jump && is_jump_dest &&
+                !has_dynamic_jump) {
+                // A static `JUMP` to the next block in program order is
+                // treated like a fallthrough edge, if it is the only jump
+                // to that block.
+                auto const &dest = prev.instrs.back().immediate_value();
+                result[id] = dest == offset && literal_targets[offset] == 1;
+            }
+        }
+
+        return result;
+    }
+
     /*
      * IR: Private construction methods
      */
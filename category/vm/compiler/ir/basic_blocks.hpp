@@ -29,6 +29,7 @@
 #include <unordered_map>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace monad::vm::compiler::basic_blocks
 {
@@ -348,6 +349,28 @@ namespace monad::vm::compiler::basic_blocks
         void add_fallthrough_terminator(Terminator t);
     };
 
+    /**
+     * Compute, for each block in the program, whether control can only
+     * enter the block from the block immediately preceding it in program
+     * order, either through that block's fallthrough edge or through a
+     * static `JUMP` terminating it.
+     *
+     * A block that does not start with `JUMPDEST` is single-entry exactly
+     * when its predecessor has a fallthrough terminator. A `JUMPDEST` block
+     * is single-entry if additionally no jump in the program can target it,
+     * or if its predecessor ends in `PUSH dest; JUMP` with `dest` being the
+     * block and no other jump targets it. This is only decidable when every
+     * `JUMP` and `JUMPI` in the program takes its destination from an
+     * immediately preceding `PUSH`. The emitter uses this to carry virtual
+     * stack state (registers and literals) across the block boundary
+     * instead of spilling it.
+     *
+     * Blocks are emitted in program order, so a static jump to a block
+     * other than the next one is never merged, even if that jump is the
+     * only entry of its destination.
+     */
+    std::vector<bool> single_entry_blocks(BasicBlocksIR const &);
+
     template <Traits traits, typename... Args>
     BasicBlocksIR make_ir(Args &&...);
 
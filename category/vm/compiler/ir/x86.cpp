@@ -33,6 +33,7 @@
 #include <cstdint>
 #include <memory>
 #include <variant>
+#include <vector>
 
 using namespace monad::vm;
 using namespace monad::vm::compiler;
@@ -343,8 +344,9 @@ namespace
     }
 
     template <Traits traits>
-    void
-    emit_terminator(Emitter &emit, BasicBlocksIR const &ir, Block const &block)
+    void emit_terminator(
+        Emitter &emit, BasicBlocksIR const &ir, Block const &block,
+        std::vector<bool> const &single_entry)
     {
         // Remaining block base gas is zero for terminator instruction,
         // because there are no more instructions left in the block.
@@ -352,15 +354,30 @@ namespace
         using enum basic_blocks::Terminator;
         switch (block.terminator) {
         case FallThrough:
-            emit.fallthrough();
+            MONAD_DEBUG_ASSERT(block.fallthrough_dest != INVALID_BLOCK_ID);
+            emit.fallthrough(
+                ir.blocks()[block.fallthrough_dest],
+                single_entry[block.fallthrough_dest]);
             break;
         case JumpI:
             MONAD_DEBUG_ASSERT(block.fallthrough_dest != INVALID_BLOCK_ID);
-            emit.jumpi(ir.blocks()[block.fallthrough_dest]);
-            break;
-        case Jump:
-            emit.jump();
+            emit.jumpi(
+                ir.blocks()[block.fallthrough_dest],
+                single_entry[block.fallthrough_dest]);
+            break;
+        case Jump: {
+            // A block following a `JUMP` is only single-entry when that
+            // jump is a static jump to it.
+            auto const next =
+                static_cast<block_id>(&block - ir.blocks().data()) + 1;
+            if (next < ir.blocks().size() && single_entry[next]) {
+                emit.jump(ir.blocks()[next], true);
+            }
+            else {
+                emit.jump();
+            }
             break;
+        }
         case Return:
             emit.return_();
             break;
@@ -440,6 +457,8 @@ namespace monad::vm::compiler::native
         }
         native_code_size_t const max_native_size =
             max_code_size(config.max_code_size_offset, ir.codesize);
+        std::vector<bool> const single_entry =
+            basic_blocks::single_entry_blocks(ir);
         for (Block const &block : ir.blocks()) {
             bool const can_enter_block = emit.begin_new_block(block);
             if (can_enter_block) {
@@ -447,7 +466,7 @@ namespace monad::vm::compiler::native
                 emit_gas_decrement(emit, ir, block, base_gas);
                 emit_instrs<traits>(
                     emit, block, base_gas, max_native_size, config);
-                emit_terminator<traits>(emit, ir, block);
+                emit_terminator<traits>(emit, ir, block, single_entry);
             }
             require_code_size_in_bound(emit, max_native_size);
         }
@@ -435,6 +435,21 @@ namespace monad::vm::compiler::native
         return x86::qword_ptr(label_, offset);
     }
 
+    template <size_t N>
+    asmjit::x86::Mem
+    Emitter::RoData::add_words(std::array<uint256_t, N> const &xs)
+    {
+        // We need `data_` size upper bounded to not overflow `int32_t`
+        // i.e. estimate_size() < std::numeric_limits<int32_t>::max()
+        if (MONAD_UNLIKELY(data_.size() + N > (1 << 26))) {
+            throw Nativecode::SizeEstimateOutOfBounds{estimate_size()};
+        }
+
+        int32_t const offset = static_cast<int32_t>(data_.size()) << 5;
+        data_.insert(data_.end(), xs.begin(), xs.end());
+        return x86::qword_ptr(label_, offset);
+    }
+
     size_t Emitter::RoData::estimate_size()
     {
         return data_.size() << 5;
@@ -449,6 +464,13 @@ namespace monad::vm::compiler::native
         return *this;
     }
 
+    Emitter::RuntimeImpl &
+    Emitter::RuntimeImpl::pass(asmjit::x86::Mem const &mem)
+    {
+        explicit_args_.push_back(mem);
+        return *this;
+    }
+
     void Emitter::RuntimeImpl::call_impl()
     {
         MONAD_ASSERT(
@@ -467,7 +489,12 @@ namespace monad::vm::compiler::native
                 u == remaining_gas_arg_) {
                 continue;
             }
-            StackElemRef const elem = explicit_args_[a++];
+            auto const &arg = explicit_args_[a++];
+            if (auto const *const mem = std::get_if<x86::Mem>(&arg)) {
+                mov_arg(i, *mem);
+                continue;
+            }
+            StackElemRef const elem = std::get<StackElemRef>(arg);
             if (elem->stack_offset()) {
                 mov_arg(i, stack_offset_to_mem(*elem->stack_offset()));
             }
@@ -3370,6 +3397,9 @@ namespace monad::vm::compiler::native
         if (addmod_opt()) {
             return;
         }
+        if (modop_barrett(runtime::addmod_barrett)) {
+            return;
+        }
         call_runtime(remaining_base_gas, true, runtime::addmod);
     }
 
@@ -3378,6 +3408,9 @@ namespace monad::vm::compiler::native
         if (mulmod_opt()) {
             return;
         }
+        if (modop_barrett(runtime::mulmod_barrett)) {
+            return;
+        }
         call_runtime(remaining_base_gas, true, runtime::mulmod);
     }
 
@@ -3404,21 +3437,39 @@ namespace monad::vm::compiler::native
         jump_stack_elem_dest(std::move(e), {});
     }
 
+    // Discharge
+    void
+    Emitter::jump(basic_blocks::Block const &next, bool const single_entry)
+    {
+        MONAD_DEBUG_ASSERT(next.offset <= *bytecode_size_);
+        if (!keep_stack_across_jumpdest(single_entry) ||
+            spill_budget_exceeded(next)) {
+            jump();
+            return;
+        }
+        // The destination is the literal offset of the next block, which
+        // can only be entered from here, so the jump is emitted like a
+        // fallthrough which keeps registers and literals.
+        auto e = stack_.pop();
+        MONAD_DEBUG_ASSERT(
+            e->literal() && e->literal()->value == uint256_t{next.offset});
+        discharge_deferred_comparison();
+        keep_stack_in_next_block_ = true;
+    }
+
     // Discharge indirectly with `jumpi_comparison`
-    void Emitter::jumpi(basic_blocks::Block const &ft)
+    void
+    Emitter::jumpi(basic_blocks::Block const &ft, bool const single_entry)
     {
         MONAD_DEBUG_ASSERT(ft.offset <= *bytecode_size_);
-        // We spill the stack if the fall through block is a jumpdest, but also
-        // in case the number of spills is not proportional to the number of
-        // instructions in the fall through block and the fallthrough block
-        // is terminated with `JUMPI`. This latter condition is to preserve
-        // linear compile time, which would otherwise be quadratic, due to the
-        // `JUMPI` instruction potentially spilling the same stack elements as
-        // the predecessor block.
+        // We spill the stack if the fall through block is a jumpdest which
+        // may be entered by other jumps, but also in case the number of
+        // spills is not proportional to the number of instructions in the
+        // fall through block (see `spill_budget_exceeded`).
         bool const spill_stack =
-            jump_dests_.count(static_cast<byte_offset>(ft.offset)) ||
-            (ft.terminator == basic_blocks::Terminator::JumpI &&
-             stack_.missing_spill_count() > 3 + ft.instrs.size());
+            (jump_dests_.count(static_cast<byte_offset>(ft.offset)) &&
+             !keep_stack_across_jumpdest(single_entry)) ||
+            spill_budget_exceeded(ft);
         if (spill_stack) {
             jumpi_spill_fallthrough_stack();
         }
@@ -3435,6 +3486,43 @@ namespace monad::vm::compiler::native
         adjust_by_stack_delta<false>();
     }
 
+    // Discharge
+    void Emitter::fallthrough(
+        basic_blocks::Block const &ft, bool const single_entry)
+    {
+        MONAD_DEBUG_ASSERT(ft.offset <= *bytecode_size_);
+        discharge_deferred_comparison();
+        if (keep_stack_across_jumpdest(single_entry) &&
+            !spill_budget_exceeded(ft)) {
+            // The next block can only be entered from here, so registers
+            // and literals stay valid and the stack is written back by the
+            // next terminator instead.
+            keep_stack_in_next_block_ = true;
+            return;
+        }
+        write_to_final_stack_offsets();
+        adjust_by_stack_delta<false>();
+    }
+
+    bool Emitter::spill_budget_exceeded(basic_blocks::Block const &ft)
+    {
+        // A `JUMPI` terminating the next block potentially spills the same
+        // stack elements as the current block. Carrying the stack into it is
+        // only allowed when the spills are proportional to the number of
+        // instructions in it, to preserve linear compile time, which would
+        // otherwise be quadratic over a chain of such blocks.
+        return ft.terminator == basic_blocks::Terminator::JumpI &&
+               stack_.missing_spill_count() > 3 + ft.instrs.size();
+    }
+
+    bool Emitter::keep_stack_across_jumpdest(bool const single_entry) const
+    {
+        // When fuzzing, the input stack is stored at every jumpdest and
+        // compared against the interpreter, which expects the stack of a
+        // freshly entered block.
+        return single_entry && !utils::is_fuzzing_monad_vm;
+    }
+
     // No discharge
     void Emitter::stop()
     {
@@ -7682,6 +7770,44 @@ namespace monad::vm::compiler::native
         return true;
     }
 
+    // Discharge
+    bool Emitter::modop_barrett(BarrettModOpType const f)
+    {
+        // required stack shape: [a b m]
+        auto m_elem = stack_.get(stack_.top_index() - 2);
+        if (!m_elem->literal() ||
+            !runtime::BarrettModulus::supports(m_elem->literal()->value)) {
+            return false;
+        }
+        auto const modulus = barrett_modulus(m_elem->literal()->value);
+        m_elem.reset(); // Clear locations
+
+        Runtime rt{this, true, f};
+        discharge_deferred_comparison();
+        spill_caller_save_regs(rt.spill_avx_regs());
+        rt.pass(stack_.pop());
+        rt.pass(stack_.pop());
+        stack_.pop();
+        rt.pass(modulus);
+        rt.call_impl();
+        return true;
+    }
+
+    asmjit::x86::Mem Emitter::barrett_modulus(uint256_t const &m)
+    {
+        RoSubdata<32>::Data key;
+        store_le(key.data(), m);
+        if (auto const it = barrett_moduli_.find(key);
+            it != barrett_moduli_.end()) {
+            return it->second;
+        }
+        auto const mem = rodata_.add_words(
+            std::bit_cast<std::array<uint256_t, 3>>(
+                runtime::BarrettModulus{m}));
+        barrett_moduli_.emplace(key, mem);
+        return mem;
+    }
+
     // Discharge
     bool Emitter::addmod_opt()
     {
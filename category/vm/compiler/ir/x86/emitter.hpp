@@ -22,6 +22,7 @@
 #include <category/vm/evm/traits.hpp>
 #include <category/vm/interpreter/intercode.hpp>
 #include <category/vm/runtime/detail.hpp>
+#include <category/vm/runtime/math/barrett.hpp>
 #include <category/vm/runtime/types.hpp>
 
 #include <asmjit/x86.h>
@@ -101,6 +102,10 @@ namespace monad::vm::compiler::native
             asmjit::x86::Mem add8(uint64_t);
             asmjit::x86::Mem add4(uint32_t);
 
+            // Consecutive 32 byte words, not deduplicated
+            template <size_t N>
+            asmjit::x86::Mem add_words(std::array<uint256_t, N> const &);
+
             size_t estimate_size();
 
         private:
@@ -157,6 +162,7 @@ namespace monad::vm::compiler::native
             }
 
             RuntimeImpl &pass(StackElemRef &&);
+            RuntimeImpl &pass(asmjit::x86::Mem const &);
 
             void call_impl();
 
@@ -173,7 +179,8 @@ namespace monad::vm::compiler::native
             void mov_stack_arg(int32_t sp_offset, RuntimeArg &&arg);
 
             Emitter *em_;
-            std::vector<StackElemRef> explicit_args_;
+            std::vector<std::variant<StackElemRef, asmjit::x86::Mem>>
+                explicit_args_;
             int64_t remaining_base_gas_;
             bool spill_avx_;
             void *runtime_fun_;
@@ -568,9 +575,17 @@ namespace monad::vm::compiler::native
         }
 
         // Terminators invalidate emitter until `begin_new_block` is called.
+        // The `single_entry` flag of `jumpi` and `fallthrough` states that
+        // the fall through block can only be entered from the current block
+        // (see `basic_blocks::single_entry_blocks`), in which case the
+        // virtual stack may be carried into it even if it is a jumpdest.
         void jump();
-        void jumpi(basic_blocks::Block const &fallthrough);
+        void jump(basic_blocks::Block const &next, bool single_entry = false);
+        void jumpi(
+            basic_blocks::Block const &fallthrough, bool single_entry = false);
         void fallthrough();
+        void fallthrough(
+            basic_blocks::Block const &fallthrough, bool single_entry = false);
         void stop();
         void invalid_instruction();
         void return_();
@@ -865,6 +880,8 @@ namespace monad::vm::compiler::native
         Comparison jumpi_comparison(StackElemRef cond, StackElemRef dest);
         void jumpi_spill_fallthrough_stack();
         void jumpi_keep_fallthrough_stack();
+        bool keep_stack_across_jumpdest(bool single_entry) const;
+        bool spill_budget_exceeded(basic_blocks::Block const &);
 
         void read_context_address(int32_t offset);
         void read_evmc_tx_context_address(int32_t offset);
@@ -1035,6 +1052,12 @@ namespace monad::vm::compiler::native
             ModOpByMaskType ModOpByMask>
         bool modop_optimized();
 
+        using BarrettModOpType = void (*)(
+            uint256_t *, uint256_t const *, uint256_t const *,
+            runtime::BarrettModulus const *);
+        bool modop_barrett(BarrettModOpType);
+        asmjit::x86::Mem barrett_modulus(uint256_t const &);
+
         ////////// Fields //////////
 
         // Order of fields is significant.
@@ -1052,6 +1075,9 @@ namespace monad::vm::compiler::native
         interpreter::code_size_t bytecode_size_;
         std::unordered_map<byte_offset, asmjit::Label> jump_dests_;
         RoData rodata_;
+        std::unordered_map<
+            RoSubdata<32>::Data, asmjit::x86::Mem, RoSubdata<32>::DataHash>
+            barrett_moduli_;
         std::vector<std::tuple<asmjit::Label, asmjit::x86::Mem, asmjit::Label>>
             load_bounded_le_handlers_;
         std::vector<std::pair<asmjit::Label, std::string>> debug_messages_;
@@ -0,0 +1,73 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include <category/core/assert.h>
+#include <category/core/bytes.hpp>
+#include <category/vm/contract_profiler.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace monad::vm
+{
+    thread_local uint32_t ContractProfiler::countdown_{0};
+
+    uint32_t ContractProfiler::next_stride(uint32_t const period) noexcept
+    {
+        // Uniform in [1, 2 * period), so the mean stride is `period`
+        thread_local uint64_t state =
+            0x9e3779b97f4a7c15 ^ reinterpret_cast<uintptr_t>(&state);
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        uint64_t const range = 2 * uint64_t{period} - 1;
+        return static_cast<uint32_t>(1 + state % range);
+    }
+
+    void ContractProfiler::add_sample(
+        bytes32_t const &code_hash, Entrypoint const entrypoint,
+        Totals const &totals)
+    {
+        auto const i = static_cast<size_t>(entrypoint);
+        MONAD_ASSERT(i < entrypoint_count);
+        std::lock_guard const lock{mutex_};
+        profiles_[i][code_hash] += totals;
+    }
+
+    std::vector<ContractProfiler::Entry> ContractProfiler::drain()
+    {
+        std::array<Profile, entrypoint_count> profiles;
+        {
+            std::lock_guard const lock{mutex_};
+            std::swap(profiles, profiles_);
+        }
+        std::vector<Entry> entries;
+        for (size_t i = 0; i < entrypoint_count; ++i) {
+            for (auto const &[code_hash, totals] : profiles[i]) {
+                entries.push_back(Entry{
+                    .code_hash = code_hash,
+                    .entrypoint = static_cast<Entrypoint>(i),
+                    .totals = totals});
+            }
+        }
+        std::ranges::sort(entries, [](Entry const &a, Entry const &b) {
+            return a.totals.wall_nanos > b.totals.wall_nanos;
+        });
+        return entries;
+    }
+}
@@ -0,0 +1,117 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#pragma once
+
+#include <category/core/bytes.hpp>
+#include <category/core/likely.h>
+
+#include <ankerl/unordered_dense.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace monad::vm
+{
+    /// Sampling profiler attributing VM time, gas and storage reads to
+    /// (code hash, entrypoint) pairs. Roughly one in `sample_period()`
+    /// calls to `VM::execute` is measured; the stride is randomized per
+    /// thread so that periodic call patterns do not alias with it. Samples
+    /// accumulate until `drain()`, which the block executor calls once per
+    /// block. Measurements are inclusive of nested calls.
+    class ContractProfiler
+    {
+    public:
+        /// Code tier a sampled call was dispatched to
+        enum class Entrypoint : uint8_t
+        {
+            Interpreter = 0,
+            Native = 1,
+        };
+
+        static constexpr size_t entrypoint_count = 2;
+
+        struct Totals
+        {
+            uint64_t sample_count{0};
+            uint64_t wall_nanos{0};
+            uint64_t gas_used{0};
+            uint64_t storage_reads{0};
+
+            Totals &operator+=(Totals const &other) noexcept
+            {
+                sample_count += other.sample_count;
+                wall_nanos += other.wall_nanos;
+                gas_used += other.gas_used;
+                storage_reads += other.storage_reads;
+                return *this;
+            }
+        };
+
+        struct Entry
+        {
+            bytes32_t code_hash;
+            Entrypoint entrypoint;
+            Totals totals;
+        };
+
+        /// Sample one in `period` calls on average; zero disables sampling
+        void set_sample_period(uint32_t const period) noexcept
+        {
+            sample_period_.store(period, std::memory_order_relaxed);
+        }
+
+        uint32_t sample_period() const noexcept
+        {
+            return sample_period_.load(std::memory_order_relaxed);
+        }
+
+        /// Whether the calling thread should measure its next call
+        [[gnu::always_inline]]
+        bool should_sample() noexcept
+        {
+            uint32_t const period = sample_period();
+            if (MONAD_LIKELY(period == 0)) {
+                return false;
+            }
+            if (MONAD_LIKELY(countdown_ > 1)) {
+                --countdown_;
+                return false;
+            }
+            countdown_ = next_stride(period);
+            return true;
+        }
+
+        void add_sample(
+            bytes32_t const &code_hash, Entrypoint, Totals const &);
+
+        /// Return the samples accumulated since the last call, ordered by
+        /// descending wall time, and reset the profile
+        std::vector<Entry> drain();
+
+    private:
+        using Profile = ankerl::unordered_dense::map<bytes32_t, Totals>;
+
+        static uint32_t next_stride(uint32_t period) noexcept;
+
+        static thread_local uint32_t countdown_;
+
+        std::atomic<uint32_t> sample_period_{0};
+        std::mutex mutex_;
+        std::array<Profile, entrypoint_count> profiles_;
+    };
+}
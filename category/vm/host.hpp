@@ -19,6 +19,7 @@
 
 #include <evmc/evmc.hpp>
 
+#include <cstdint>
 #include <exception>
 
 namespace monad::vm
@@ -68,6 +69,19 @@ namespace monad::vm
             runtime_context_->stack_unwind();
         }
 
+        /// Number of storage reads served by this host so far; the VM
+        /// samples it around profiled calls
+        uint64_t storage_read_count() const noexcept
+        {
+            return storage_read_count_;
+        }
+
+    protected:
+        void count_storage_read() const noexcept
+        {
+            ++storage_read_count_;
+        }
+
     private:
         [[gnu::always_inline]]
         void rethrow_on_active_exception()
@@ -90,5 +104,6 @@ namespace monad::vm
 
         runtime::Context *runtime_context_{nullptr};
         mutable std::exception_ptr active_exception_;
+        mutable uint64_t storage_read_count_{0};
     };
 }
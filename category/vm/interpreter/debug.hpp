@@ -35,16 +35,19 @@ namespace monad::vm::interpreter
 
     /**
      * Debug trace printing compatible with the JSON format emitted by evmone.
+     * The opcode is read from the original code rather than the dispatch
+     * stream so that superinstructions trace as their constituent opcodes.
      */
     [[gnu::always_inline]]
     inline void trace(
         Intercode const &analysis, int64_t const gas_remaining,
         uint8_t const *const instr_ptr)
     {
+        auto const offset = instr_ptr - analysis.dispatch_code();
         std::cerr << std::format(
             "offset: 0x{:02x}  opcode: 0x{:x}  gas_left: {}\n",
-            instr_ptr - analysis.code(),
-            *instr_ptr,
+            offset,
+            analysis.code()[offset],
             gas_remaining);
     }
 }
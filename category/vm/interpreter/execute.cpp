@@ -35,7 +35,7 @@ namespace monad::vm::interpreter
         {
             auto *const stack_top = stack_ptr - 1;
             auto const *const stack_bottom = stack_top;
-            auto const *const instr_ptr = analysis->code();
+            auto const *const instr_ptr = analysis->dispatch_code();
             auto const gas_remaining = ctx->gas_remaining;
 
             if constexpr (debug_enabled) {
@@ -290,17 +290,17 @@ namespace monad::vm::interpreter
             invalid, //
             invalid, //
 
-            invalid, //
-            invalid, //
-            invalid, //
-            invalid, //
-            invalid, //
-            invalid, //
-            invalid, //
-            invalid, //
-            invalid, //
-            invalid, //
-            invalid, //
+            fused_push<1, traits, jump<traits>>, // 0xB0,
+            fused_push<2, traits, jump<traits>>, // 0xB1,
+            fused_push<1, traits, jumpi<traits>>, // 0xB2,
+            fused_push<2, traits, jumpi<traits>>, // 0xB3,
+            fused_push<1, traits, add<traits>>, // 0xB4,
+            fused_push<1, traits, and_<traits>>, // 0xB5,
+            fused_push<1, traits, mload<traits>>, // 0xB6,
+            fused_push<1, traits, mstore<traits>>, // 0xB7,
+            fused_swap<1, traits, pop<traits>>, // 0xB8,
+            fused_swap<2, traits, pop<traits>>, // 0xB9,
+            fused_dup<2, traits, fused_swap<1, traits, pop<traits>>>, // 0xBA,
             invalid, //
             invalid, //
             invalid, //
@@ -1401,7 +1401,7 @@ namespace monad::vm::interpreter
     {
         check_requirements<PC, traits>(
             ctx, analysis, stack_bottom, stack_top, gas_remaining);
-        push(stack_top, instr_ptr - analysis.code());
+        push(stack_top, instr_ptr - analysis.dispatch_code());
 
         MONAD_VM_NEXT(PC);
     }
@@ -1506,7 +1506,7 @@ namespace monad::vm::interpreter
                 ctx.exit(Error);
             }
 
-            return analysis.code() + jd;
+            return analysis.dispatch_code() + jd;
         }
     }
 
@@ -1572,7 +1572,7 @@ namespace monad::vm::interpreter
             ctx,
             stack_bottom,
             stack_top,
-            static_cast<uint64_t>(instr_ptr - analysis.code()));
+            static_cast<uint64_t>(instr_ptr - analysis.dispatch_code()));
         check_requirements<JUMPDEST, traits>(
             ctx, analysis, stack_bottom, stack_top, gas_remaining);
 
@@ -1794,6 +1794,89 @@ namespace monad::vm::interpreter
         ctx.gas_remaining = gas_remaining;
         ctx.exit(Error);
     }
+
+    // Superinstructions
+    //
+    // A fused handler executes the first instruction of its sequence inline,
+    // including that instruction's own gas and stack checks, and then makes a
+    // direct tail call to the handler for the rest of the sequence. Every
+    // constituent instruction is therefore checked in the original order,
+    // and only the indirect dispatch between them is elided.
+    template <size_t N, Traits traits, InstrEval Next>
+        requires(N >= 1 && N <= 32)
+    MONAD_VM_INSTRUCTION_CALL void fused_push(
+        runtime::Context &ctx, Intercode const &analysis,
+        uint256_t const *stack_bottom, uint256_t *stack_top,
+        int64_t gas_remaining, uint8_t const *instr_ptr)
+    {
+        push_impl<N, traits>::push(
+            ctx, analysis, stack_bottom, stack_top, gas_remaining, instr_ptr);
+
+        instr_ptr += N + 1;
+        if constexpr (debug_enabled) {
+            trace(analysis, gas_remaining, instr_ptr);
+        }
+        MONAD_VM_MUST_TAIL return Next(
+            ctx,
+            analysis,
+            stack_bottom,
+            stack_top + 1,
+            gas_remaining,
+            instr_ptr);
+    }
+
+    template <size_t N, Traits traits, InstrEval Next>
+        requires(N >= 1)
+    MONAD_VM_INSTRUCTION_CALL void fused_dup(
+        runtime::Context &ctx, Intercode const &analysis,
+        uint256_t const *stack_bottom, uint256_t *stack_top,
+        int64_t gas_remaining, uint8_t const *instr_ptr)
+    {
+        check_requirements<DUP1 + (N - 1), traits>(
+            ctx, analysis, stack_bottom, stack_top, gas_remaining);
+
+        auto *const old_top = stack_top;
+        push(stack_top, *(old_top - (N - 1)));
+
+        ++instr_ptr;
+        if constexpr (debug_enabled) {
+            trace(analysis, gas_remaining, instr_ptr);
+        }
+        MONAD_VM_MUST_TAIL return Next(
+            ctx,
+            analysis,
+            stack_bottom,
+            stack_top + 1,
+            gas_remaining,
+            instr_ptr);
+    }
+
+    template <size_t N, Traits traits, InstrEval Next>
+        requires(N >= 1)
+    MONAD_VM_INSTRUCTION_CALL void fused_swap(
+        runtime::Context &ctx, Intercode const &analysis,
+        uint256_t const *stack_bottom, uint256_t *stack_top,
+        int64_t gas_remaining, uint8_t const *instr_ptr)
+    {
+        check_requirements<SWAP1 + (N - 1), traits>(
+            ctx, analysis, stack_bottom, stack_top, gas_remaining);
+
+        auto const top = stack_top->to_avx();
+        *stack_top = *(stack_top - N);
+        *(stack_top - N) = uint256_t{top};
+
+        ++instr_ptr;
+        if constexpr (debug_enabled) {
+            trace(analysis, gas_remaining, instr_ptr);
+        }
+        MONAD_VM_MUST_TAIL return Next(
+            ctx,
+            analysis,
+            stack_bottom,
+            stack_top,
+            gas_remaining,
+            instr_ptr);
+    }
 }
 
 #undef MONAD_VM_MUST_TAIL
@@ -454,4 +454,23 @@ namespace monad::vm::interpreter
     MONAD_VM_INSTRUCTION_CALL inline void invalid(
         runtime::Context &, Intercode const &, uint256_t const *, uint256_t *,
         int64_t, uint8_t const *);
+
+    // Superinstructions
+    template <size_t N, Traits traits, InstrEval Next>
+        requires(N >= 1 && N <= 32)
+    MONAD_VM_INSTRUCTION_CALL void fused_push(
+        runtime::Context &, Intercode const &, uint256_t const *, uint256_t *,
+        int64_t, uint8_t const *);
+
+    template <size_t N, Traits traits, InstrEval Next>
+        requires(N >= 1)
+    MONAD_VM_INSTRUCTION_CALL void fused_dup(
+        runtime::Context &, Intercode const &, uint256_t const *, uint256_t *,
+        int64_t, uint8_t const *);
+
+    template <size_t N, Traits traits, InstrEval Next>
+        requires(N >= 1)
+    MONAD_VM_INSTRUCTION_CALL void fused_swap(
+        runtime::Context &, Intercode const &, uint256_t const *, uint256_t *,
+        int64_t, uint8_t const *);
 }
@@ -18,15 +18,85 @@
 #include <category/vm/interpreter/intercode.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <span>
+#include <utility>
+#include <vector>
 
 using namespace monad::vm::compiler;
 
 namespace monad::vm::interpreter
 {
+    namespace
+    {
+        // The designated invalid instruction; every unassigned opcode behaves
+        // identically to it.
+        constexpr uint8_t invalid_opcode = 0xFE;
+
+        // Returns the superinstruction that the sequence starting at `pc`
+        // fuses into, if any. Every opcode of a fused sequence must lie
+        // inside the code, so the implicit STOP in the end padding (which
+        // never matches) is not fused.
+        std::optional<uint8_t>
+        match_fusion(std::span<uint8_t const> const code, size_t const pc)
+        {
+            auto const op_at = [code](size_t const i) -> uint8_t {
+                return i < code.size() ? code[i] : uint8_t{STOP};
+            };
+
+            switch (code[pc]) {
+            case PUSH1:
+                switch (op_at(pc + 2)) {
+                case JUMP:
+                    return FUSED_PUSH1_JUMP;
+                case JUMPI:
+                    return FUSED_PUSH1_JUMPI;
+                case ADD:
+                    return FUSED_PUSH1_ADD;
+                case AND:
+                    return FUSED_PUSH1_AND;
+                case MLOAD:
+                    return FUSED_PUSH1_MLOAD;
+                case MSTORE:
+                    return FUSED_PUSH1_MSTORE;
+                default:
+                    return std::nullopt;
+                }
+            case PUSH2:
+                switch (op_at(pc + 3)) {
+                case JUMP:
+                    return FUSED_PUSH2_JUMP;
+                case JUMPI:
+                    return FUSED_PUSH2_JUMPI;
+                default:
+                    return std::nullopt;
+                }
+            case SWAP1:
+                if (op_at(pc + 1) == POP) {
+                    return FUSED_SWAP1_POP;
+                }
+                return std::nullopt;
+            case SWAP2:
+                if (op_at(pc + 1) == POP) {
+                    return FUSED_SWAP2_POP;
+                }
+                return std::nullopt;
+            case DUP2:
+                if (op_at(pc + 1) == SWAP1 && op_at(pc + 2) == POP) {
+                    return FUSED_DUP2_SWAP1_POP;
+                }
+                return std::nullopt;
+            default:
+                return std::nullopt;
+            }
+        }
+    }
+
     Intercode::Intercode(std::span<uint8_t const> const code)
         : padded_code_(pad(code))
+        , dispatch_code_(fuse(code, padded_code_))
         , code_size_(
               code_size_t::unsafe_from(static_cast<uint32_t>(code.size())))
         , jumpdest_map_(find_jumpdests(code))
@@ -35,6 +105,9 @@ namespace monad::vm::interpreter
 
     Intercode::~Intercode()
     {
+        if (dispatch_code_ != padded_code_) {
+            delete[] (dispatch_code_ - start_padding_size);
+        }
         delete[] (padded_code_ - start_padding_size);
     }
 
@@ -55,6 +128,44 @@ namespace monad::vm::interpreter
         return buffer + start_padding_size;
     }
 
+    uint8_t const *Intercode::fuse(
+        std::span<uint8_t const> const code, uint8_t const *const padded_code)
+    {
+        std::vector<std::pair<size_t, uint8_t>> rewrites;
+
+        for (auto i = 0u; i < code.size(); ++i) {
+            auto const op = code[i];
+
+            if (is_fused_opcode(op)) {
+                rewrites.emplace_back(i, invalid_opcode);
+            }
+            else if (auto const fused = match_fusion(code, i)) {
+                rewrites.emplace_back(i, *fused);
+            }
+
+            if (is_push_opcode(op)) {
+                i += get_push_opcode_index(op);
+            }
+        }
+
+        // Most code shares the original buffer; only pay for a second copy
+        // when there is something to rewrite.
+        if (rewrites.empty()) {
+            return padded_code;
+        }
+
+        auto const buffer_size =
+            start_padding_size + code.size() + end_padding_size;
+        auto *buffer = new uint8_t[buffer_size];
+        std::copy_n(padded_code - start_padding_size, buffer_size, buffer);
+
+        auto *const dispatch_code = buffer + start_padding_size;
+        for (auto const &[pc, op] : rewrites) {
+            dispatch_code[pc] = op;
+        }
+        return dispatch_code;
+    }
+
     auto Intercode::find_jumpdests(std::span<uint8_t const> const code)
         -> JumpdestMap
     {
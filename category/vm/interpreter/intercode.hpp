@@ -27,6 +27,39 @@ namespace monad::vm::interpreter
 {
     using code_size_t = runtime::Bin<20>;
 
+    /**
+     * Superinstruction opcodes for the interpreter's dispatch stream.
+     *
+     * Analysis rewrites the first opcode of a common instruction sequence to
+     * one of these values in a private copy of the code; the remaining
+     * opcodes and all push data are left untouched. The values are taken
+     * from a range that is unassigned in every supported revision, and any
+     * genuine occurrence of them in the bytecode is rewritten to INVALID in
+     * the dispatch stream, which has identical semantics.
+     */
+    enum FusedOpCode : uint8_t
+    {
+        FUSED_PUSH1_JUMP = 0xB0,
+        FUSED_PUSH2_JUMP = 0xB1,
+        FUSED_PUSH1_JUMPI = 0xB2,
+        FUSED_PUSH2_JUMPI = 0xB3,
+        FUSED_PUSH1_ADD = 0xB4,
+        FUSED_PUSH1_AND = 0xB5,
+        FUSED_PUSH1_MLOAD = 0xB6,
+        FUSED_PUSH1_MSTORE = 0xB7,
+        FUSED_SWAP1_POP = 0xB8,
+        FUSED_SWAP2_POP = 0xB9,
+        FUSED_DUP2_SWAP1_POP = 0xBA,
+    };
+
+    inline constexpr uint8_t fused_opcode_first = FUSED_PUSH1_JUMP;
+    inline constexpr uint8_t fused_opcode_last = FUSED_DUP2_SWAP1_POP;
+
+    constexpr bool is_fused_opcode(uint8_t const opcode) noexcept
+    {
+        return opcode >= fused_opcode_first && opcode <= fused_opcode_last;
+    }
+
     class Intercode
     {
         // 30 bytes of initial padding ensures that we can implement all
@@ -51,11 +84,20 @@ namespace monad::vm::interpreter
 
         ~Intercode();
 
+        /// The original bytecode, as observed by CODECOPY and the compiler
         uint8_t const *code() const noexcept
         {
             return padded_code_;
         }
 
+        /// The stream the interpreter dispatches on: identical to `code()`
+        /// except that fused sequences start with a superinstruction opcode.
+        /// Offsets into both buffers correspond one-to-one.
+        uint8_t const *dispatch_code() const noexcept
+        {
+            return dispatch_code_;
+        }
+
         code_size_t code_size() const noexcept
         {
             return code_size_;
@@ -92,11 +134,15 @@ namespace monad::vm::interpreter
 
     private:
         uint8_t const *padded_code_;
+        uint8_t const *dispatch_code_;
         code_size_t code_size_;
         JumpdestMap jumpdest_map_;
 
         static uint8_t const *pad(std::span<uint8_t const> code);
 
+        static uint8_t const *
+        fuse(std::span<uint8_t const> code, uint8_t const *padded_code);
+
         static JumpdestMap find_jumpdests(std::span<uint8_t const> code);
     };
 }
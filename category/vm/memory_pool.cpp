@@ -14,11 +14,11 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <category/core/assert.h>
-#include <category/core/runtime/non_temporal_memory.hpp>
 #include <category/vm/memory_pool.hpp>
 
+#include <sys/mman.h>
+
 #include <cstdint>
-#include <cstdlib>
 #include <cstring>
 #include <mutex>
 #include <unordered_set>
@@ -39,10 +39,30 @@ namespace monad::vm
         while (n != &empty_head_) {
             auto *const t = n;
             n = n->next;
-            std::free(t);
+            MONAD_ASSERT(!munmap(t, alloc_capacity_));
         }
     }
 
+    uint8_t *MemoryPool::map_zeroed_buffer() const
+    {
+        // Anonymous mappings are zero-filled by the kernel on first touch,
+        // so only the pages actually used by transactions are ever committed
+        // and zeroed, instead of eagerly clearing the whole buffer.
+        void *const p = mmap(
+            nullptr,
+            alloc_capacity_,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+            -1,
+            0);
+        MONAD_ASSERT(p != MAP_FAILED);
+        // Prefer transparent huge pages for the buffer, to reduce page
+        // faults and TLB misses for contracts using large memory regions.
+        // This is only a hint, so failure is not an error.
+        (void)madvise(p, alloc_capacity_, MADV_HUGEPAGE);
+        return static_cast<uint8_t *>(p);
+    }
+
     uint8_t *MemoryPool::alloc()
     {
         Node *old_head;
@@ -53,10 +73,7 @@ namespace monad::vm
         }
 
         if (old_head == &empty_head_) {
-            void *const p = std::aligned_alloc(32, alloc_capacity_);
-            MONAD_ASSERT(p);
-            runtime::non_temporal_bzero(p, alloc_capacity_);
-            return reinterpret_cast<uint8_t *>(p);
+            return map_zeroed_buffer();
         }
 
         // This clears the memory buffer:
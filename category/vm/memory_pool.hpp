@@ -73,10 +73,14 @@ namespace monad::vm
         }
 
         // Allocate zero initialized memory buffer of `alloc_capacity()` size.
+        // New buffers are backed by lazily committed pages, so a buffer only
+        // costs memory for the part which has been written to.
         uint8_t *alloc();
 
         // Deallocate memory previous allocated with `alloc()`. Make sure
         // the entire memory buffer is zeroed before calling `dealloc()`.
+        // Since only the used extent of a buffer is dirty, it suffices to
+        // zero that extent; the buffer is then reused by a later `alloc()`.
         void dealloc(uint8_t *);
 
         // Allocate zero initialized memory buffer of `alloc_capacity()` size.
@@ -92,6 +96,8 @@ namespace monad::vm
         size_t debug_get_cache_size() const;
 
     private:
+        uint8_t *map_zeroed_buffer() const;
+
         Node empty_head_;
         Node *head_;
         uint32_t alloc_capacity_;
@@ -19,10 +19,9 @@
 #include <category/core/runtime/uint256.hpp>
 #include <category/vm/evm/traits.hpp>
 #include <category/vm/runtime/bin.hpp>
+#include <category/vm/runtime/keccak_cache.hpp>
 #include <category/vm/runtime/types.hpp>
 
-#include <ethash/keccak.hpp>
-
 namespace monad::vm::runtime
 {
     template <Traits traits>
@@ -42,7 +41,7 @@ namespace monad::vm::runtime
             ctx->deduct_gas(word_size * bin<6>);
         }
 
-        auto const hash = ethash::keccak256(ctx->memory.data + *offset, *size);
+        auto const hash = keccak256_memo(ctx->memory.data + *offset, *size);
         *result_ptr = load_be<uint256_t>(hash);
     }
 }
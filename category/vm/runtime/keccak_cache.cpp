@@ -0,0 +1,91 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/runtime/unaligned.hpp>
+#include <category/vm/runtime/keccak_cache.hpp>
+#include <category/vm/utils/debug.hpp>
+
+#include <ethash/hash_types.hpp>
+#include <ethash/keccak.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace monad::vm::runtime
+{
+    std::atomic<uint64_t> KeccakCacheStats::hits{0};
+    std::atomic<uint64_t> KeccakCacheStats::misses{0};
+}
+
+namespace
+{
+    // 1024 entries of ~100 bytes each; allocated on first use, so threads
+    // which never execute SHA3 do not pay for it
+    constexpr size_t cache_bits = 10;
+    constexpr size_t cache_entries = size_t{1} << cache_bits;
+
+    struct Entry
+    {
+        uint8_t preimage[64];
+        ethash::hash256 hash;
+        uint32_t size; // zero for an empty entry
+    };
+
+    thread_local std::unique_ptr<Entry[]> cache;
+
+    size_t entry_index(uint8_t const *const data, size_t const size) noexcept
+    {
+        // Mapping preimages are a left-padded key followed by a small slot
+        // number, so the distinguishing bytes are at the low end of each word
+        uint64_t x = monad::unaligned_load<uint64_t>(data + 24);
+        if (size == 64) {
+            x ^= monad::unaligned_load<uint64_t>(data + 56) *
+                 0x9e3779b97f4a7c15;
+        }
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccd;
+        return static_cast<size_t>(x >> (64 - cache_bits));
+    }
+
+    void count(std::atomic<uint64_t> &counter) noexcept
+    {
+        if constexpr (monad::vm::utils::collect_monad_compiler_hot_path_stats) {
+            counter.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+namespace monad::vm::runtime::detail
+{
+    ethash::hash256 cached_keccak256(uint8_t const *data, size_t size)
+    {
+        if (!cache) {
+            cache = std::make_unique<Entry[]>(cache_entries);
+        }
+        Entry &e = cache[entry_index(data, size)];
+        if (e.size == size && std::memcmp(e.preimage, data, size) == 0) {
+            count(KeccakCacheStats::hits);
+            return e.hash;
+        }
+        count(KeccakCacheStats::misses);
+        e.hash = ethash::keccak256(data, size);
+        std::memcpy(e.preimage, data, size);
+        e.size = static_cast<uint32_t>(size);
+        return e.hash;
+    }
+}
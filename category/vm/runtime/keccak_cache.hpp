@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <ethash/hash_types.hpp>
+#include <ethash/keccak.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace monad::vm::runtime
+{
+    /// Process-wide totals of the per-thread keccak cache lookups; only
+    /// maintained when hot path stats are collected
+    struct KeccakCacheStats
+    {
+        static std::atomic<uint64_t> hits;
+        static std::atomic<uint64_t> misses;
+    };
+
+    namespace detail
+    {
+        /// Look up a 32- or 64-byte preimage in the calling thread's cache,
+        /// hashing and inserting it on a miss
+        ethash::hash256 cached_keccak256(uint8_t const *data, size_t size);
+    }
+
+    /// keccak256 of `size` bytes at `data`. Solidity hashes `key ‖ slot` on
+    /// every mapping access, and the same 64-byte preimages (e.g. the token
+    /// balance slots of hot senders) recur within and across the transactions
+    /// of a block, so 32- and 64-byte inputs are served from a small
+    /// per-thread direct-mapped cache.
+    inline ethash::hash256 keccak256_memo(uint8_t const *data, size_t size)
+    {
+        if (size == 32 || size == 64) {
+            return detail::cached_keccak256(data, size);
+        }
+        return ethash::keccak256(data, size);
+    }
+}
@@ -18,6 +18,7 @@
 #include <category/core/assert.h>
 #include <category/core/runtime/uint256.hpp>
 #include <category/vm/evm/traits.hpp>
+#include <category/vm/runtime/math/barrett.hpp>
 #include <category/vm/runtime/math/intrinsics.hpp>
 #include <category/vm/runtime/types.hpp>
 
@@ -97,6 +98,28 @@ namespace monad::vm::runtime
         *result_ptr = mulmod(*a_ptr, *b_ptr, *n_ptr);
     }
 
+    // ADDMOD and MULMOD with a literal modulus, which the compiler
+    // precomputes the Barrett reciprocal of (see BarrettModulus::supports)
+    constexpr void addmod_barrett(
+        uint256_t *const result_ptr, uint256_t const *const a_ptr,
+        uint256_t const *const b_ptr,
+        BarrettModulus const *const n_ptr) noexcept
+    {
+        auto const [sum, carry] = addc(*a_ptr, *b_ptr);
+        words_t<5> const x{sum[0], sum[1], sum[2], sum[3], carry};
+        *result_ptr = n_ptr->reduce(x);
+    }
+
+    constexpr void mulmod_barrett(
+        uint256_t *const result_ptr, uint256_t const *const a_ptr,
+        uint256_t const *const b_ptr,
+        BarrettModulus const *const n_ptr) noexcept
+    {
+        auto const prod = truncating_mul<2 * uint256_t::num_words>(
+            a_ptr->as_words(), b_ptr->as_words());
+        *result_ptr = n_ptr->reduce(prod);
+    }
+
     template <Traits traits>
     [[gnu::always_inline]]
     inline constexpr uint32_t exp_dynamic_gas_cost_multiplier() noexcept
@@ -0,0 +1,102 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <category/core/assert.h>
+#include <category/core/runtime/uint256.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace monad::vm::runtime
+{
+    /// Reduction modulo a fixed modulus `m`, 2^192 < m < 2^256, by Barrett's
+    /// method (HAC 14.42) in base 2^64. The reciprocal is computed once, so
+    /// a reduction costs two multi-word multiplications and at most two
+    /// subtractions instead of a long division. Intended for moduli known
+    /// at compile time, e.g. the BN254 and secp256k1 field primes, with the
+    /// structure placed in the read-only data of the compiled contract.
+    struct BarrettModulus
+    {
+        uint256_t mod;
+        /// floor(2^512 / mod)
+        words_t<5> mu;
+        /// Pads the structure to a whole number of 32 byte words
+        words_t<3> padding;
+
+        static constexpr bool supports(uint256_t const &m) noexcept
+        {
+            // Powers of two are better served by a mask, and would need a
+            // sixth reciprocal word for m = 2^192
+            return m[3] != 0 && popcount(m) != 1;
+        }
+
+        constexpr explicit BarrettModulus(uint256_t const &m) noexcept
+            : mod{m}
+            , mu{}
+            , padding{}
+        {
+            MONAD_DEBUG_ASSERT(supports(m));
+            words_t<9> numerator{};
+            numerator[8] = 1;
+            auto const quot = udivrem(numerator, m.as_words()).quot;
+            MONAD_DEBUG_ASSERT(count_significant_words(quot) <= 5);
+            for (size_t i = 0; i < 5; ++i) {
+                mu[i] = quot[i];
+            }
+        }
+
+        /// `x mod m` for a little endian `x` of at most 8 words
+        template <size_t N>
+            requires(N >= 5 && N <= 8)
+        constexpr uint256_t reduce(words_t<N> const &x) const noexcept
+        {
+            // q3 = floor(floor(x / b^3) * mu / b^5) underestimates the
+            // quotient by at most two
+            words_t<5> q1{};
+            for (size_t i = 3; i < N; ++i) {
+                q1[i - 3] = x[i];
+            }
+            auto const q2 = truncating_mul<10>(q1, mu);
+            words_t<5> q3;
+            for (size_t i = 0; i < 5; ++i) {
+                q3[i] = q2[i + 5];
+            }
+
+            // r = (x - q3 * m) mod b^5, which is below 3m
+            auto const r2 = truncating_mul<5>(q3, mod.as_words());
+            words_t<5> r;
+            bool borrow = false;
+            for (size_t i = 0; i < 5; ++i) {
+                auto const [d, b] = subb(x[i], r2[i], borrow);
+                r[i] = d;
+                borrow = b;
+            }
+            while (r[4] != 0 || uint256_t{r[0], r[1], r[2], r[3]} >= mod) {
+                borrow = false;
+                for (size_t i = 0; i < 4; ++i) {
+                    auto const [d, b] = subb(r[i], mod[i], borrow);
+                    r[i] = d;
+                    borrow = b;
+                }
+                r[4] -= borrow;
+            }
+            return uint256_t{r[0], r[1], r[2], r[3]};
+        }
+    };
+
+    static_assert(sizeof(BarrettModulus) == 3 * sizeof(uint256_t));
+}
@@ -35,6 +35,46 @@
 #endif
 namespace monad::vm::runtime
 {
+    namespace
+    {
+        // SLOAD and SSTORE access the slot, charge for a cold access and only
+        // then read or write it, so that a frame out of gas never reaches
+        // storage. Through a vm::Host each step is a direct virtual call
+        // instead of a trip through the evmc C interface.
+        [[gnu::always_inline]]
+        evmc_access_status
+        access_storage(Context *const ctx, bytes32_t const &key)
+        {
+            if (MONAD_LIKELY(ctx->monad_host != nullptr)) {
+                return ctx->monad_host->access_storage(ctx->env.recipient, key);
+            }
+            return ctx->host->access_storage(
+                ctx->context, &ctx->env.recipient, &key);
+        }
+
+        [[gnu::always_inline]]
+        bytes32_t get_storage(Context *const ctx, bytes32_t const &key)
+        {
+            if (MONAD_LIKELY(ctx->monad_host != nullptr)) {
+                return ctx->monad_host->get_storage(ctx->env.recipient, key);
+            }
+            return ctx->host->get_storage(
+                ctx->context, &ctx->env.recipient, &key);
+        }
+
+        [[gnu::always_inline]]
+        evmc_storage_status set_storage(
+            Context *const ctx, bytes32_t const &key, bytes32_t const &value)
+        {
+            if (MONAD_LIKELY(ctx->monad_host != nullptr)) {
+                return ctx->monad_host->set_storage(
+                    ctx->env.recipient, key, value);
+            }
+            return ctx->host->set_storage(
+                ctx->context, &ctx->env.recipient, &key, &value);
+        }
+    }
+
     template <Traits traits>
     void sload(Context *ctx, uint256_t *result_ptr, uint256_t const *key_ptr)
     {
@@ -42,14 +82,11 @@ namespace monad::vm::runtime
 
         auto key = store_be_as<bytes32_t>(*key_ptr);
 
-        auto const access_status =
-            ctx->host->access_storage(ctx->context, &ctx->env.recipient, &key);
-        if (access_status == EVMC_ACCESS_COLD) {
+        if (access_storage(ctx, key) == EVMC_ACCESS_COLD) {
             ctx->deduct_gas(traits::cold_storage_cost());
         }
 
-        auto const value =
-            ctx->host->get_storage(ctx->context, &ctx->env.recipient, &key);
+        auto const value = get_storage(ctx, key);
 
         *result_ptr = load_be<uint256_t>(value);
     }
@@ -78,14 +115,11 @@ namespace monad::vm::runtime
         auto value = store_be_as<bytes32_t>(*value_ptr);
 
         if constexpr (traits::mip_8_active()) {
-            auto const access_status = ctx->host->access_storage(
-                ctx->context, &ctx->env.recipient, &key);
-            if (access_status == EVMC_ACCESS_COLD) {
+            if (access_storage(ctx, key) == EVMC_ACCESS_COLD) {
                 ctx->deduct_gas(traits::cold_storage_cost());
             }
 
-            auto const storage_status = ctx->host->set_storage(
-                ctx->context, &ctx->env.recipient, &key, &value);
+            auto const storage_status = set_storage(ctx, key, value);
 
             auto *monad_host = evmc::Host::from_context<vm::Host>(ctx->context);
             auto const [first_page_write, grew_state] = monad_host->update_page(
@@ -103,14 +137,11 @@ namespace monad::vm::runtime
             ctx->deduct_gas(gas_used);
         }
         else {
-            auto const access_status = ctx->host->access_storage(
-                ctx->context, &ctx->env.recipient, &key);
-            if (access_status == EVMC_ACCESS_COLD) {
+            if (access_storage(ctx, key) == EVMC_ACCESS_COLD) {
                 ctx->deduct_gas(traits::cold_storage_cost() + min_gas);
             }
 
-            auto const storage_status = ctx->host->set_storage(
-                ctx->context, &ctx->env.recipient, &key, &value);
+            auto const storage_status = set_storage(ctx, key, value);
 
             auto [gas_used, gas_refund] = store_cost<traits>(storage_status);
 
@@ -33,6 +33,11 @@
 #include <variant>
 #include <vector>
 
+namespace monad::vm
+{
+    class Host;
+}
+
 namespace monad::vm::runtime
 {
     enum class StatusCode : uint64_t
@@ -248,6 +253,11 @@ namespace monad::vm::runtime
         exit_stack_ptr_t exit_stack_ptr = nullptr;
         bool is_stack_unwinding_active = false;
 
+        // The host behind `context` when the VM was entered through a
+        // `vm::Host`; storage opcodes then call it directly instead of
+        // going through the evmc C interface. Null for plain evmc hosts.
+        Host *monad_host = nullptr;
+
         [[gnu::always_inline]]
         constexpr void deduct_gas(int64_t const gas) noexcept
         {
@@ -20,6 +20,7 @@
 #include <category/vm/code.hpp>
 #include <category/vm/compiler/ir/x86.hpp>
 #include <category/vm/compiler/ir/x86/types.hpp>
+#include <category/vm/contract_profiler.hpp>
 #include <category/vm/evm/explicit_traits.hpp>
 #include <category/vm/evm/traits.hpp>
 #include <category/vm/host.hpp>
@@ -32,6 +33,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -82,11 +84,15 @@ namespace monad::vm
 
         auto rt_ctx =
             runtime::Context::from(host_itf, host_ctx, msg, icode->code_span());
+        rt_ctx.monad_host = &host;
 
         // Install new runtime context:
         auto *const prev_rt_ctx = host.set_runtime_context(&rt_ctx);
 
-        auto result = execute_raw<traits>(rt_ctx, code_hash, vcode);
+        auto result = MONAD_UNLIKELY(contract_profiler_.should_sample())
+                          ? execute_raw_profiled<traits>(
+                                host, rt_ctx, code_hash, vcode)
+                          : execute_raw<traits>(rt_ctx, code_hash, vcode);
 
         rt_ctx.return_to<traits>(prev_rt_ctx);
 
@@ -100,6 +106,42 @@ namespace monad::vm
 
     EXPLICIT_TRAITS_MEMBER(VM::execute);
 
+    template <Traits traits>
+    evmc::Result VM::execute_raw_profiled(
+        Host const &host, runtime::Context &rt_ctx,
+        bytes32_t const &code_hash, SharedVarcode const &vcode)
+    {
+        // The tier is decided from the varcode as `execute_raw` will see it;
+        // a call that falls back to the interpreter because compilation for
+        // this revision is missing or failed counts as interpreted
+        using enum ContractProfiler::Entrypoint;
+        auto const &ncode = vcode->nativecode();
+        bool const is_native = ncode != nullptr &&
+                               ncode->chain_id() == traits::id() &&
+                               ncode->entrypoint() != nullptr;
+        auto const entrypoint = is_native ? Native : Interpreter;
+        auto const msg_gas = rt_ctx.gas_remaining;
+        auto const reads_begin = host.storage_read_count();
+        auto const time_begin = std::chrono::steady_clock::now();
+
+        auto result = execute_raw<traits>(rt_ctx, code_hash, vcode);
+
+        auto const wall_time = std::chrono::steady_clock::now() - time_begin;
+        contract_profiler_.add_sample(
+            code_hash,
+            entrypoint,
+            ContractProfiler::Totals{
+                .sample_count = 1,
+                .wall_nanos = static_cast<uint64_t>(
+                    std::chrono::nanoseconds{wall_time}.count()),
+                .gas_used = static_cast<uint64_t>(
+                    std::max(msg_gas - result.gas_left, int64_t{0})),
+                .storage_reads = host.storage_read_count() - reads_begin});
+        return result;
+    }
+
+    EXPLICIT_TRAITS_MEMBER(VM::execute_raw_profiled);
+
     template <Traits traits>
     evmc::Result VM::execute_bytecode(
         Host &host, evmc_message const *msg, std::span<uint8_t const> code)
@@ -120,6 +162,7 @@ namespace monad::vm
         }
 
         auto rt_ctx = runtime::Context::from(host_itf, host_ctx, msg, code);
+        rt_ctx.monad_host = &host;
 
         // Install new runtime context:
         auto *const prev_rt_ctx = host.set_runtime_context(&rt_ctx);
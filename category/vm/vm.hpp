@@ -19,11 +19,13 @@
 #include <category/vm/code.hpp>
 #include <category/vm/compiler.hpp>
 #include <category/vm/compiler/ir/x86.hpp>
+#include <category/vm/contract_profiler.hpp>
 #include <category/vm/evm/traits.hpp>
 #include <category/vm/host.hpp>
 #include <category/vm/interpreter/execute.hpp>
 #include <category/vm/memory_pool.hpp>
 #include <category/vm/runtime/allocator.hpp>
+#include <category/vm/runtime/keccak_cache.hpp>
 #include <category/vm/utils/debug.hpp>
 
 #include <array>
@@ -35,7 +37,8 @@ namespace monad::vm
 {
     constexpr auto counts_format_string =
         ",execute_intercode_calls={},execute_native_entrypoint_"
-        "calls={},execute_raw_calls={}";
+        "calls={},execute_raw_calls={},keccak_cache_hits={},"
+        "keccak_cache_misses={}";
 
     struct VmStats
     {
@@ -46,6 +49,11 @@ namespace monad::vm
         std::atomic<uint64_t> execute_intercode_call_count_{0};
         std::atomic<uint64_t> execute_native_entrypoint_call_count_{0};
         std::atomic<uint64_t> execute_raw_call_count_{0};
+        // The keccak cache counts live in runtime::KeccakCacheStats, since
+        // the runtime has no access to the VM; per-block counts are taken
+        // relative to these snapshots
+        uint64_t keccak_cache_hits_at_block_start_{0};
+        uint64_t keccak_cache_misses_at_block_start_{0};
 
         void event_execute_intercode() noexcept
         {
@@ -85,6 +93,12 @@ namespace monad::vm
                     0, std::memory_order_release);
                 execute_raw_call_count_per_block_.store(
                     0, std::memory_order_release);
+                keccak_cache_hits_at_block_start_ =
+                    runtime::KeccakCacheStats::hits.load(
+                        std::memory_order_relaxed);
+                keccak_cache_misses_at_block_start_ =
+                    runtime::KeccakCacheStats::misses.load(
+                        std::memory_order_relaxed);
             }
         }
 
@@ -99,7 +113,13 @@ namespace monad::vm
                     execute_native_entrypoint_call_count_per_block_.load(
                         std::memory_order_acquire),
                     execute_raw_call_count_per_block_.load(
-                        std::memory_order_acquire));
+                        std::memory_order_acquire),
+                    runtime::KeccakCacheStats::hits.load(
+                        std::memory_order_relaxed) -
+                        keccak_cache_hits_at_block_start_,
+                    runtime::KeccakCacheStats::misses.load(
+                        std::memory_order_relaxed) -
+                        keccak_cache_misses_at_block_start_);
                 reset_block_counts();
                 return str;
             }
@@ -117,7 +137,11 @@ namespace monad::vm
                         std::memory_order_acquire),
                     execute_native_entrypoint_call_count_.load(
                         std::memory_order_acquire),
-                    execute_raw_call_count_.load(std::memory_order_acquire));
+                    execute_raw_call_count_.load(std::memory_order_acquire),
+                    runtime::KeccakCacheStats::hits.load(
+                        std::memory_order_relaxed),
+                    runtime::KeccakCacheStats::misses.load(
+                        std::memory_order_relaxed));
             }
             else {
                 return "";
@@ -146,6 +170,7 @@ namespace monad::vm
         CompilerConfig compiler_config_;
         runtime::EvmStackAllocator stack_allocator_;
         MemoryPool memory_pool_;
+        ContractProfiler contract_profiler_;
         // Execute override functionality for testing purposes:
         ExecuteOverride execute_override_;
 
@@ -184,6 +209,13 @@ namespace monad::vm
             compiler_config_ = x;
         }
 
+        /// Per-contract sampling profiler fed by `execute`; disabled until
+        /// a sample period is set
+        ContractProfiler &contract_profiler()
+        {
+            return contract_profiler_;
+        }
+
         MemoryPool::Ref message_memory_ref()
         {
             return memory_pool_.alloc_ref();
@@ -213,6 +245,13 @@ namespace monad::vm
             runtime::Context &rt_ctx, bytes32_t const &code_hash,
             SharedVarcode const &vcode);
 
+        /// `execute_raw`, measured and attributed to `code_hash` in the
+        /// contract profiler.
+        template <Traits traits>
+        evmc::Result execute_raw_profiled(
+            Host const &host, runtime::Context &rt_ctx,
+            bytes32_t const &code_hash, SharedVarcode const &vcode);
+
         /// Compile the intercode and execute. In `CompilerOnly` mode, the
         /// function will wait for (cached) compilation to finish and execute
         /// the native entrypoint. Otherwise start async compilation and
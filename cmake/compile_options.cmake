@@ -44,6 +44,10 @@ function(monad_compile_options target)
       target_compile_definitions(${target} PUBLIC "MONAD_COMPILER_HOT_PATH_STATS=1")
   endif()
 
+  if(MONAD_STATE_JOURNAL)
+      target_compile_definitions(${target} PUBLIC "MONAD_STATE_JOURNAL=1")
+  endif()
+
   target_compile_options(
     ${target}
     PUBLIC $<$<CXX_COMPILER_ID:GNU>:-Wno-attributes=clang::no_sanitize>)
@@ -23,6 +23,7 @@
 #include <category/core/fiber/priority_pool.hpp>
 #include <category/core/likely.h>
 #include <category/core/log.hpp>
+#include <category/core/metrics/metrics.hpp>
 #include <category/core/monad_exception.hpp>
 #include <category/core/procfs/statm.h>
 #include <category/core/seeded_fast_hash.hpp>
@@ -39,6 +40,7 @@
 #include <category/execution/ethereum/db/util.hpp>
 #include <category/execution/ethereum/event/exec_event_ctypes.h>
 #include <category/execution/ethereum/event/exec_event_recorder.hpp>
+#include <category/execution/ethereum/precompile_cache.hpp>
 #include <category/execution/ethereum/precompiles.hpp>
 #include <category/execution/ethereum/state2/block_state.hpp>
 #include <category/execution/ethereum/trace/call_tracer.hpp>
@@ -137,10 +139,19 @@ try {
     bool no_compaction = false;
     bool trace_calls = false;
     bool as_eth_blocks = false;
+    size_t precompile_cache_size = 0;
+    uint64_t precompile_cache_min_gas = PrecompileCache::DEFAULT_MIN_GAS_COST;
     std::chrono::seconds block_db_timeout = std::chrono::seconds::zero();
     std::string exec_event_ring_config;
     std::unique_ptr<OwnedEventRing> exec_event_ring;
     std::optional<ExecutionEventRecorder> opt_exec_recorder;
+    bool exec_event_deferred = false;
+    bool exec_event_require_reader = false;
+    uint32_t exec_event_contract_profile_period = 0;
+    std::optional<fs::path> metrics_segment_path;
+    metrics::SharedSegment metrics_segment;
+    uint64_t traversal_read_bandwidth = 0;
+    bool compact_node_encoding = false;
     unsigned sq_thread_cpu = static_cast<unsigned>(get_nprocs() - 1);
     bool disable_sq_thread_cpu = false;
     std::optional<unsigned> ro_sq_thread_cpu;
@@ -169,6 +180,15 @@ try {
     cli.add_option("--nthreads", nthreads, "number of threads");
     cli.add_option("--nfibers", nfibers, "number of fibers");
     cli.add_flag("--no-compaction", no_compaction, "disable compaction");
+    cli.add_option(
+        "--traversal-read-bandwidth",
+        traversal_read_bandwidth,
+        "cap on background trie traversal reads, e.g. prefetch, in bytes "
+        "per second (0 = unlimited)");
+    cli.add_flag(
+        "--compact-node-encoding",
+        compact_node_encoding,
+        "write trie nodes in the compact on-disk encoding");
     cli.add_option(
         "--sq-thread-cpu,--sq_thread_cpu",
         sq_thread_cpu,
@@ -206,6 +226,14 @@ try {
            "timeout in seconds for reading blocks from blockdb (0 = no retry)")
         ->needs(as_eth_blocks_flag);
     cli.add_option("--chain-rlp", chain_rlp_path, "path to chain rlp file");
+    cli.add_option(
+        "--precompile-cache-size,--precompile_cache_size",
+        precompile_cache_size,
+        "maximum number of memoized precompile results (0 = disabled)");
+    cli.add_option(
+        "--precompile-cache-min-gas,--precompile_cache_min_gas",
+        precompile_cache_min_gas,
+        "minimum precompile gas cost for a call to be memoized");
     auto *const group =
         cli.add_option_group("load", "methods to initialize the db");
     group
@@ -237,6 +265,29 @@ try {
                 }
                 return std::string{};
             });
+    cli.add_flag(
+           "--exec-event-deferred",
+           exec_event_deferred,
+           "record transaction output events on a dedicated thread instead "
+           "of the executing fibers")
+        ->needs(exec_event_ring_option);
+    cli.add_flag(
+           "--exec-event-require-reader",
+           exec_event_require_reader,
+           "only record block and transaction events while a reader is "
+           "attached to the event ring; checked at the start of every block")
+        ->needs(exec_event_ring_option);
+    cli.add_option(
+           "--exec-event-contract-profile-period",
+           exec_event_contract_profile_period,
+           "profile one in this many contract calls on average and record "
+           "per-contract totals for each block (0 = disabled)")
+        ->needs(exec_event_ring_option);
+    cli.add_option(
+        "--metrics-segment",
+        metrics_segment_path,
+        "publish counters and latency histograms in a shared memory file "
+        "for monad-metrics");
 #ifdef ENABLE_EVENT_TRACING
     fs::path trace_log = fs::absolute("trace");
     cli.add_option(
@@ -285,15 +336,38 @@ try {
                 "event library error -- {}", monad_event_ring_get_last_error());
             return 1;
         }
+        if (exec_event_require_reader) {
+            opt_exec_recorder->require_attached_reader(
+                exec_event_ring->get_ring_fd());
+        }
+        if (exec_event_deferred) {
+            opt_exec_recorder->start_deferred_recording();
+        }
     }
     ExecutionEventRecorder *const exec_recorder =
         opt_exec_recorder ? std::addressof(*opt_exec_recorder) : nullptr;
 
+    if (metrics_segment_path.has_value()) {
+        try {
+            metrics_segment =
+                metrics::SharedSegment::create(*metrics_segment_path);
+        }
+        catch (std::exception const &e) {
+            LOG_ERROR(
+                "cannot create metrics segment `{}`: {}",
+                metrics_segment_path->string(),
+                e.what());
+            return 1;
+        }
+        metrics::set_segment(metrics_segment.get());
+    }
+
 #ifdef ENABLE_EVENT_TRACING
     event_tracer = create_event_tracer(trace_log);
 #endif
 
     MONAD_ASSERT(init_trusted_setup());
+    init_precompile_cache(precompile_cache_size, precompile_cache_min_gas);
 
     auto const db_in_memory = dbname_paths.empty();
     [[maybe_unused]] auto const load_start_time =
@@ -325,7 +399,9 @@ try {
                 .sq_thread_cpu = disable_sq_thread_cpu
                                      ? std::optional<unsigned>{}
                                      : std::optional<unsigned>{sq_thread_cpu},
-                .dbname_paths = dbname_paths}};
+                .dbname_paths = dbname_paths,
+                .traversal_read_bandwidth = traversal_read_bandwidth,
+                .compact_node_encoding = compact_node_encoding}};
         }
         // In memory db: initialize state machine based on chain revision
         auto const *const monad_chain =
@@ -445,6 +521,8 @@ try {
     // compilation: the compiler does not expose the full fidelity of error exit
     // codes that are required to serve RPC responses that include call traces.
     vm::VM vm{trace_calls ? vm::VM::InterpreterOnly : vm::VM::Dual};
+    vm.contract_profiler().set_sample_period(
+        exec_event_contract_profile_period);
 
     Db &db = sync_server ? static_cast<Db &>(*sync_server->ctx)
                          : static_cast<Db &>(triedb);
@@ -574,6 +652,9 @@ try {
                  std::max(1UL, static_cast<uint64_t>(elapsed.count()))),
             vm.print_compiler_stats(),
             vm.print_total_counts());
+        if (PrecompileCache const *const cache = precompile_cache()) {
+            LOG_INFO("{}", cache->print_stats());
+        }
     }
 
     sync_server.reset();
@@ -0,0 +1,118 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Scrapes the metrics segment published by `monad --metrics-segment` and
+// prints its counters and latency percentiles. Reading the segment never
+// synchronizes with the recording threads.
+
+#include <category/core/metrics/metrics.hpp>
+
+#include <CLI/CLI.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace monad;
+
+namespace
+{
+    void print(metrics::Segment const &segment, metrics::Snapshot const &s)
+    {
+        auto const &header = segment.header;
+        std::cout << std::format(
+            "threads={}\n",
+            header.threads_claimed.load(std::memory_order_relaxed));
+        for (size_t i = 0; i < metrics::NUM_COUNTERS; ++i) {
+            std::cout << std::format(
+                "{:<32} {:>16}\n", header.counter_names[i], s.counters[i]);
+        }
+        std::cout << std::format(
+            "{:<32} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10}\n",
+            "latency (us)",
+            "count",
+            "mean",
+            "p50",
+            "p90",
+            "p99",
+            "p99.9",
+            "max");
+        auto const us = [](double const ns) { return ns / 1000.0; };
+        for (size_t i = 0; i < metrics::NUM_HISTOGRAMS; ++i) {
+            auto const &h = s.histograms[i];
+            std::cout << std::format(
+                "{:<32} {:>10} {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f} "
+                "{:>10.1f} {:>10.1f}\n",
+                header.histogram_names[i],
+                h.count,
+                us(h.mean()),
+                us(static_cast<double>(h.percentile(50))),
+                us(static_cast<double>(h.percentile(90))),
+                us(static_cast<double>(h.percentile(99))),
+                us(static_cast<double>(h.percentile(99.9))),
+                us(static_cast<double>(h.max)));
+        }
+        std::cout << std::flush;
+    }
+}
+
+int main(int const argc, char const *argv[])
+{
+    std::filesystem::path path{metrics::DEFAULT_SEGMENT_PATH};
+    unsigned interval = 0;
+
+    CLI::App cli{"Print the metrics published by a running monad process"};
+    cli.add_option("--segment", path, "metrics segment file")
+        ->capture_default_str();
+    cli.add_option(
+        "--interval",
+        interval,
+        "if nonzero, print what was recorded in every interval of this many "
+        "seconds instead of the totals");
+    try {
+        cli.parse(argc, argv);
+    }
+    catch (CLI::ParseError const &e) {
+        return cli.exit(e);
+    }
+
+    try {
+        auto const shared = metrics::SharedSegment::open(path);
+        auto const &segment = shared.get();
+        auto last = metrics::read_snapshot(segment);
+        if (interval == 0) {
+            print(segment, last);
+            return 0;
+        }
+        for (;;) {
+            std::this_thread::sleep_for(std::chrono::seconds{interval});
+            auto const now = metrics::read_snapshot(segment);
+            print(segment, now.since(last));
+            last = now;
+        }
+    }
+    catch (std::exception const &e) {
+        std::cerr << "monad-metrics: " << path << ": " << e.what()
+                  << std::endl;
+        return 1;
+    }
+}
@@ -60,6 +60,7 @@ impl MonadExecutor {
         block_pool_config: ffi::PoolConfig,
         tx_exec_num_fibers: u32,
         node_lru_max_mem: u64,
+        triedb_num_workers: u32,
         triedb_path: &Path,
     ) -> Self {
         monad_cxx::init_cxx_logging(tracing::Level::WARN);
@@ -74,6 +75,7 @@ impl MonadExecutor {
                 block_pool_config,
                 tx_exec_num_fibers,
                 node_lru_max_mem,
+                triedb_num_workers,
                 dbpath.as_c_str().as_ptr(),
             )
         };
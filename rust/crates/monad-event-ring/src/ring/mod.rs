@@ -57,6 +57,10 @@ where
     D: EventDecoder,
 {
     /// Synchronously creates a new event ring from the provided path.
+    ///
+    /// The ring holds the event ring file's reader lock until it is dropped,
+    /// so a writer that only records while a reader is attached records for
+    /// it.
     pub fn new(path: impl AsRef<EventRingPath>) -> Result<Self, String> {
         use std::os::fd::AsRawFd;
 
@@ -97,6 +97,7 @@ impl ExecutedBlockBuilder {
             | ExecEventRef::AccountAccessListHeader(_)
             | ExecEventRef::AccountAccess(_)
             | ExecEventRef::StorageAccess(_)
+            | ExecEventRef::BlockContractProfile(_)
             | ExecEventRef::TxnPerfEvmEnter
             | ExecEventRef::TxnPerfEvmExit => None,
 
@@ -122,6 +123,7 @@ impl ExecutedBlockBuilder {
             | ExecEvent::AccountAccessListHeader(_)
             | ExecEvent::AccountAccess(_)
             | ExecEvent::StorageAccess(_)
+            | ExecEvent::BlockContractProfile(_)
             | ExecEvent::TxnPerfEvmEnter
             | ExecEvent::TxnPerfEvmExit => unreachable!(),
 
@@ -21,9 +21,9 @@ use monad_event_ring::{
 use self::bytes::{ref_from_bytes, ref_from_bytes_with_trailing};
 use crate::ffi::{
     self, g_monad_exec_event_schema_hash, monad_exec_account_access,
-    monad_exec_account_access_list_header, monad_exec_block_end, monad_exec_block_finalized,
-    monad_exec_block_qc, monad_exec_block_reject, monad_exec_block_start,
-    monad_exec_block_verified, monad_exec_event_type, monad_exec_evm_error,
+    monad_exec_account_access_list_header, monad_exec_block_contract_profile, monad_exec_block_end,
+    monad_exec_block_finalized, monad_exec_block_qc, monad_exec_block_reject,
+    monad_exec_block_start, monad_exec_block_verified, monad_exec_event_type, monad_exec_evm_error,
     monad_exec_storage_access, monad_exec_txn_access_list_entry, monad_exec_txn_auth_list_entry,
     monad_exec_txn_call_frame, monad_exec_txn_evm_output, monad_exec_txn_header_start,
     monad_exec_txn_log, monad_exec_txn_reject,
@@ -97,6 +97,7 @@ pub enum ExecEvent {
     AccountAccess(monad_exec_account_access),
     StorageAccess(monad_exec_storage_access),
     EvmError(monad_exec_evm_error),
+    BlockContractProfile(monad_exec_block_contract_profile),
 }
 
 /// Ref rust enum for monad execution events.
@@ -160,6 +161,7 @@ pub enum ExecEventRef<'ring> {
     AccountAccess(&'ring monad_exec_account_access),
     StorageAccess(&'ring monad_exec_storage_access),
     EvmError(&'ring monad_exec_evm_error),
+    BlockContractProfile(&'ring monad_exec_block_contract_profile),
 }
 
 impl ExecEventType {
@@ -189,6 +191,7 @@ impl ExecEventType {
             ExecEventType::AccountAccess => ffi::MONAD_EXEC_ACCOUNT_ACCESS,
             ExecEventType::StorageAccess => ffi::MONAD_EXEC_STORAGE_ACCESS,
             ExecEventType::EvmError => ffi::MONAD_EXEC_EVM_ERROR,
+            ExecEventType::BlockContractProfile => ffi::MONAD_EXEC_BLOCK_CONTRACT_PROFILE,
         }
     }
 }
@@ -273,6 +276,9 @@ impl<'ring> ExecEventRef<'ring> {
             Self::AccountAccess(account_access) => ExecEvent::AccountAccess(*account_access),
             Self::StorageAccess(storage_access) => ExecEvent::StorageAccess(*storage_access),
             Self::EvmError(evm_error) => ExecEvent::EvmError(*evm_error),
+            Self::BlockContractProfile(block_contract_profile) => {
+                ExecEvent::BlockContractProfile(*block_contract_profile)
+            }
         }
     }
 }
@@ -497,6 +503,9 @@ impl EventDecoder for ExecEventDecoder {
             ffi::MONAD_EXEC_EVM_ERROR => {
                 ExecEventRef::EvmError(ref_from_bytes(bytes).expect("EvmError event valid"))
             }
+            ffi::MONAD_EXEC_BLOCK_CONTRACT_PROFILE => ExecEventRef::BlockContractProfile(
+                ref_from_bytes(bytes).expect("BlockContractProfile event valid"),
+            ),
             event_type => panic!("ExecEventDecoder encountered unknown event_type {event_type}"),
         }
     }
@@ -11,4 +11,8 @@ if [ -n "${CMAKE_TOOLCHAIN_FILE:-}" ]; then
   cmake_args+=("-DCMAKE_TOOLCHAIN_FILE=${CMAKE_TOOLCHAIN_FILE}")
 fi
 
+if [ -n "${MONAD_STATE_JOURNAL:-}" ]; then
+  cmake_args+=("-DMONAD_STATE_JOURNAL:BOOL=${MONAD_STATE_JOURNAL}")
+fi
+
 cmake "${cmake_args[@]}"
\ No newline at end of file
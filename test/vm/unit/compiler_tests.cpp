@@ -283,6 +283,61 @@ TEST(BasicBlocksIRTest, Validation)
     EXPECT_TRUE(instrIR3.is_valid());
 }
 
+TEST(BasicBlocksIRTest, SingleEntryBlocks)
+{
+    EXPECT_EQ(
+        basic_blocks::single_entry_blocks(instrIR0), std::vector<bool>{false});
+    EXPECT_EQ(
+        basic_blocks::single_entry_blocks(instrIR1),
+        (std::vector<bool>{false, true}));
+    EXPECT_EQ(
+        basic_blocks::single_entry_blocks(instrIR2),
+        (std::vector<bool>{false, true, true}));
+
+    // The jump at offset 0x0d does not take its destination from a `PUSH`,
+    // so every jumpdest may be a jump target.
+    EXPECT_EQ(
+        basic_blocks::single_entry_blocks(instrIR3),
+        (std::vector<bool>{false, false, false, false}));
+
+    // Fall through from `JUMPI` into an untargeted jumpdest.
+    auto const ir0 = basic_blocks::BasicBlocksIR::unsafe_from(
+        {PUSH1, 1, PUSH1, 7, JUMPI, JUMPDEST, STOP, JUMPDEST, STOP});
+    EXPECT_EQ(
+        basic_blocks::single_entry_blocks(ir0),
+        (std::vector<bool>{false, true, false}));
+
+    // Fall through into a jumpdest that is also a literal jump target, and
+    // from `JUMPI` into a block without jumpdest.
+    auto const ir1 = basic_blocks::BasicBlocksIR::unsafe_from(
+        {PUSH1, 0, JUMPDEST, PUSH1, 2, JUMPI, PUSH1, 0, STOP});
+    EXPECT_EQ(
+        basic_blocks::single_entry_blocks(ir1),
+        (std::vector<bool>{false, false, true}));
+
+    // Static jump to the next block, which has no other entry.
+    auto const ir2 = basic_blocks::BasicBlocksIR::unsafe_from(
+        {PUSH1, 3, JUMP, JUMPDEST, STOP});
+    EXPECT_EQ(
+        basic_blocks::single_entry_blocks(ir2),
+        (std::vector<bool>{false, true}));
+
+    // Static jump to the next block, which is also entered by another jump.
+    auto const ir3 = basic_blocks::BasicBlocksIR::unsafe_from(
+        {PUSH1, 3, JUMP, JUMPDEST, PUSH1, 3, JUMP});
+    EXPECT_EQ(
+        basic_blocks::single_entry_blocks(ir3),
+        (std::vector<bool>{false, false}));
+
+    // Static jump over a block: the destination has a single predecessor,
+    // but is not marked since it does not follow the jump in program order.
+    auto const ir4 = basic_blocks::BasicBlocksIR::unsafe_from(
+        {PUSH1, 5, JUMP, JUMPDEST, STOP, JUMPDEST, STOP});
+    EXPECT_EQ(
+        basic_blocks::single_entry_blocks(ir4),
+        (std::vector<bool>{false, false, false}));
+}
+
 TEST(BasicBlocksIRTest, Formatter)
 {
     EXPECT_EQ(
@@ -46,6 +46,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <random>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -2349,7 +2350,15 @@ TEST(Emitter, mulmod)
     }
 
     std::vector<uint256_t> const non_shift_mods = {
-        uint256_t{31}, clear0, clear234, -uint256_t{31}, -clear0, -clear234};
+        uint256_t{31},
+        clear0,
+        clear234,
+        -uint256_t{31},
+        -clear0,
+        -clear234,
+        // BN254 and secp256k1 field primes
+        0x30644E72E131A029B85045B68181585D97816A916871CA8D3C208C16D87CFD47_u256,
+        0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F_u256};
     for (auto const &m : non_shift_mods) {
         for (auto &[a, b] : inputs) {
             auto expected = m == 0 ? 0 : mulmod(a, b, m);
@@ -2382,6 +2391,80 @@ TEST(Emitter, mulmod)
     }
 }
 
+TEST(Emitter, modop_literal_modulus_matches_runtime)
+{
+    // Literal moduli are reduced by mask, Barrett or the generic runtime
+    // call depending on their shape, all of which must agree with the
+    // generic path
+    std::vector<uint256_t> moduli = {
+        1,
+        2,
+        uint256_t{1} << 192,
+        (uint256_t{1} << 192) - 1,
+        (uint256_t{1} << 192) + 1,
+        uint256_t{1} << 255,
+        (uint256_t{1} << 255) + 1,
+        std::numeric_limits<uint256_t>::max(),
+        std::numeric_limits<uint256_t>::max() - 1,
+        std::numeric_limits<uint256_t>::max() - 2,
+        // BN254 and secp256k1 field primes
+        0x30644E72E131A029B85045B68181585D97816A916871CA8D3C208C16D87CFD47_u256,
+        0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F_u256};
+
+    std::mt19937_64 rng{42};
+    auto const random_u256 = [&] {
+        return uint256_t{rng(), rng(), rng(), rng()};
+    };
+    for (int i = 0; i < 4; ++i) {
+        auto const m = random_u256();
+        moduli.push_back(m);
+        moduli.push_back(m >> 96);
+    }
+
+    asmjit::JitRuntime rt;
+    for (auto const &m : moduli) {
+        std::vector<uint256_t> const values = {
+            0,
+            1,
+            m - 1,
+            m,
+            m + 1,
+            std::numeric_limits<uint256_t>::max(),
+            random_u256()};
+        for (auto const &a : values) {
+            for (auto const &b : values) {
+                uint256_t expected;
+                runtime::addmod(&expected, &a, &b, &m);
+                pure_bin_instr_test(
+                    rt,
+                    PUSH0,
+                    [&](Emitter &em) {
+                        em.push(m);
+                        em.swap(2);
+                        em.swap(1);
+                        em.addmod(1000);
+                    },
+                    a,
+                    b,
+                    expected);
+                runtime::mulmod(&expected, &a, &b, &m);
+                pure_bin_instr_test(
+                    rt,
+                    PUSH0,
+                    [&](Emitter &em) {
+                        em.push(m);
+                        em.swap(2);
+                        em.swap(1);
+                        em.mulmod(1000);
+                    },
+                    a,
+                    b,
+                    expected);
+            }
+        }
+    }
+}
+
 TEST(Emitter, exp)
 {
     asmjit::JitRuntime rt;
@@ -36,9 +36,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <filesystem>
 #include <span>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -194,6 +196,39 @@ namespace monad::vm::compiler::test
                    host_.recorded_selfdestructs.empty();
         }
 
+        // Runs every program against evmone at each gas limit up to
+        // max_gas, so that an out-of-gas exit is taken at every instruction
+        // and at every block boundary of the program under test.
+        void sweep_gas_and_compare(
+            std::span<std::vector<std::uint8_t> const> programs,
+            Implementation impl, std::int64_t max_gas = 150) noexcept
+        {
+            for (auto const &code : programs) {
+                for (std::int64_t gas = 0; gas <= max_gas; ++gas) {
+                    host_ = {};
+                    execute(gas, code, {}, impl);
+                    auto const actual = std::move(result_);
+
+                    host_ = {};
+                    execute(gas, code, {}, Evmone);
+                    auto const expected = std::move(result_);
+
+                    if (expected.status_code == EVMC_SUCCESS) {
+                        ASSERT_EQ(actual.status_code, EVMC_SUCCESS);
+                    }
+                    else {
+                        ASSERT_NE(actual.status_code, EVMC_SUCCESS);
+                    }
+                    ASSERT_EQ(actual.gas_left, expected.gas_left);
+                    ASSERT_EQ(actual.output_size, expected.output_size);
+                    ASSERT_TRUE(std::equal(
+                        actual.output_data,
+                        actual.output_data + actual.output_size,
+                        expected.output_data));
+                }
+            }
+        }
+
     public:
         void execute_and_compare(
             std::int64_t gas_limit, std::span<std::uint8_t const> code,
@@ -791,3 +791,69 @@ INSTANTIATE_TEST_SUITE_P(
         auto const &[f, rev] = info.param;
         return monad_evm_revision_name(rev) + "_" + f.path().stem().string();
     }));
+
+TYPED_TEST(VMTraitsTest, InterpreterSuperinstructions)
+{
+    // Each program exercises at least one fused sequence in the interpreter;
+    // sweeping the gas limit forces an out-of-gas exit at every constituent
+    // instruction, which must match unfused execution exactly.
+    std::vector<std::vector<uint8_t>> const programs = {
+        {PUSH1, 0x07, PUSH1, 0x05, ADD, PUSH1, 0x0f, AND, PUSH1, 0x00,
+         MSTORE, PUSH1, 0x20, PUSH1, 0x00, RETURN},
+        {PUSH1, 0x2a, PUSH1, 0x40, MSTORE, PUSH1, 0x40, MLOAD, PUSH1, 0x00,
+         MSTORE, PUSH1, 0x20, PUSH1, 0x00, RETURN},
+        {PUSH1, 0x01, PUSH1, 0x06, JUMPI, 0xFE, JUMPDEST, PUSH1, 0x00, PUSH2,
+         0x00, 0x0e, JUMPI, STOP, JUMPDEST, 0xFE},
+        {PUSH1, 0x04, JUMP, 0xFE, JUMPDEST, PUSH2, 0x00, 0x09, JUMP, JUMPDEST,
+         STOP},
+        {PUSH1, 0x01, PUSH1, 0x02, PUSH1, 0x03, DUP2, SWAP1, POP, SWAP2, POP,
+         SWAP1, POP, PUSH1, 0x00, MSTORE, PUSH1, 0x20, PUSH1, 0x00, RETURN},
+        // Stack underflow inside fused sequences
+        {PUSH1, 0x01, JUMPI},
+        {SWAP1, POP},
+        {PUSH1, 0x01, DUP2, SWAP1, POP},
+        // Invalid jump destinations
+        {PUSH1, 0x03, JUMP, STOP},
+        {PUSH1, 0x01, PUSH2, 0xff, 0xff, JUMPI},
+    };
+
+    this->sweep_gas_and_compare(
+        programs, TestFixture::Implementation::Interpreter);
+}
+
+TYPED_TEST(VMTraitsTest, CompilerSingleEntryJumpdests)
+{
+    // Each program enters a jumpdest which no other jump targets, through a
+    // fallthrough or a static jump to the next block, so the compiler
+    // carries registers and literals across the block boundary.
+    // Sweeping the gas limit checks gas and stack accounting at every block.
+    std::vector<std::vector<uint8_t>> const programs = {
+        {PUSH1, 0x07, PUSH1, 0x05, JUMPDEST, ADD, JUMPDEST, PUSH1, 0x0f, AND,
+         JUMPDEST, PUSH1, 0x00, MSTORE, PUSH1, 0x20, PUSH1, 0x00, RETURN},
+        {PUSH1, 0x01, PUSH1, 0x00, PUSH1, 0x0b, JUMPI, JUMPDEST, PUSH1, 0x02,
+         ADD, JUMPDEST, PUSH1, 0x00, MSTORE, PUSH1, 0x20, PUSH1, 0x00, RETURN},
+        {PUSH1, 0x03, JUMPDEST, PUSH1, 0x01, SWAP1, SUB, DUP1, PUSH1, 0x02,
+         JUMPI, JUMPDEST, PUSH1, 0x00, MSTORE, PUSH1, 0x20, PUSH1, 0x00,
+         RETURN},
+        // Stack underflow after carrying state into the next block
+        {PUSH1, 0x01, JUMPDEST, ADD, STOP},
+        // Jump back into a block whose successor is single-entry
+        {PUSH1, 0x01, JUMPDEST, DUP1, DUP1, JUMPDEST, DUP1, DUP1, PUSH1, 0x02,
+         JUMP},
+        // More unspilled stack elements than the spill budget of the short
+        // `JUMPI` block fallen through into
+        {PUSH1, 0x01, PUSH1, 0x02, PUSH1, 0x03, PUSH1, 0x04, PUSH1, 0x05,
+         PUSH1, 0x06, PUSH1, 0x07, PUSH1, 0x08, PUSH1, 0x09, PUSH1, 0x0a,
+         JUMPDEST, PUSH1, 0x00, PUSH1, 0x00, JUMPI, ADD, ADD, PUSH1, 0x00,
+         MSTORE, PUSH1, 0x20, PUSH1, 0x00, RETURN},
+        // Static jump into the next block, carrying the stack across
+        {PUSH1, 0x07, PUSH1, 0x05, JUMP, JUMPDEST, PUSH1, 0x01, ADD, PUSH1,
+         0x00, MSTORE, PUSH1, 0x20, PUSH1, 0x00, RETURN},
+        // Static jump over a block, which spills the stack
+        {PUSH1, 0x07, PUSH1, 0x06, JUMP, STOP, JUMPDEST, PUSH1, 0x00,
+         MSTORE, PUSH1, 0x20, PUSH1, 0x00, RETURN},
+    };
+
+    this->sweep_gas_and_compare(
+        programs, TestFixture::Implementation::Compiler);
+}
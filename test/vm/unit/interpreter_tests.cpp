@@ -82,3 +82,53 @@ TEST(Intercode, Jumpdests)
     ASSERT_FALSE(code.is_jumpdest(8));
     ASSERT_FALSE(code.is_jumpdest(3894));
 }
+
+TEST(Intercode, DispatchCodeSharedWithoutFusion)
+{
+    auto const code = make_intercode(PUSH1, 0x01, PUSH0, SUB, STOP);
+    ASSERT_EQ(code.dispatch_code(), code.code());
+}
+
+TEST(Intercode, DispatchCodeFusion)
+{
+    auto const ops = std::vector<std::uint8_t>{
+        PUSH1, 0x40, MLOAD, // 0
+        PUSH2, 0x00, 0x0e, JUMPI, // 3
+        DUP2, SWAP1, POP, // 7
+        SWAP2, POP, // 10
+        PUSH1, 0x01, // 12, trailing push is not fused with end padding
+    };
+    auto const code = Intercode(ops);
+
+    for (auto i = 0u; i < ops.size(); ++i) {
+        ASSERT_EQ(ops[i], code.code()[i]);
+    }
+
+    auto const *const dispatch = code.dispatch_code();
+    ASSERT_NE(dispatch, code.code());
+    ASSERT_EQ(dispatch[0], FUSED_PUSH1_MLOAD);
+    ASSERT_EQ(dispatch[1], 0x40);
+    ASSERT_EQ(dispatch[2], MLOAD);
+    ASSERT_EQ(dispatch[3], FUSED_PUSH2_JUMPI);
+    ASSERT_EQ(dispatch[6], JUMPI);
+    ASSERT_EQ(dispatch[7], FUSED_DUP2_SWAP1_POP);
+    ASSERT_EQ(dispatch[8], FUSED_SWAP1_POP);
+    ASSERT_EQ(dispatch[9], POP);
+    ASSERT_EQ(dispatch[10], FUSED_SWAP2_POP);
+    ASSERT_EQ(dispatch[12], PUSH1);
+    ASSERT_EQ(dispatch[ops.size()], STOP);
+}
+
+TEST(Intercode, DispatchCodeRewritesReservedOpcodes)
+{
+    // A genuine superinstruction byte in the code must still behave as an
+    // invalid instruction, but push data is never rewritten.
+    auto const code =
+        make_intercode(FUSED_PUSH1_ADD, PUSH1, FUSED_PUSH1_ADD, STOP);
+
+    auto const *const dispatch = code.dispatch_code();
+    ASSERT_EQ(dispatch[0], 0xFE);
+    ASSERT_EQ(dispatch[1], PUSH1);
+    ASSERT_EQ(dispatch[2], FUSED_PUSH1_ADD);
+    ASSERT_EQ(code.code()[0], FUSED_PUSH1_ADD);
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include <category/core/bytes.hpp>
+#include <category/vm/contract_profiler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+using namespace monad::vm;
+using monad::bytes32_t;
+
+TEST(MonadVmContractProfiler, sampling_disabled_by_default)
+{
+    ContractProfiler profiler;
+    for (int i = 0; i < 1'000; ++i) {
+        ASSERT_FALSE(profiler.should_sample());
+    }
+}
+
+TEST(MonadVmContractProfiler, sample_rate)
+{
+    ContractProfiler profiler;
+    profiler.set_sample_period(1);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(profiler.should_sample());
+    }
+
+    profiler.set_sample_period(16);
+    uint32_t sampled = 0;
+    for (int i = 0; i < 160'000; ++i) {
+        sampled += profiler.should_sample();
+    }
+    EXPECT_GT(sampled, 9'000);
+    EXPECT_LT(sampled, 11'000);
+}
+
+TEST(MonadVmContractProfiler, drain)
+{
+    using enum ContractProfiler::Entrypoint;
+
+    bytes32_t const a{1};
+    bytes32_t const b{2};
+
+    ContractProfiler profiler;
+    profiler.add_sample(a, Native, {1, 100, 1'000, 2});
+    profiler.add_sample(a, Native, {1, 50, 500, 1});
+    profiler.add_sample(a, Interpreter, {1, 400, 1'000, 3});
+    profiler.add_sample(b, Native, {1, 200, 2'000, 0});
+
+    auto const entries = profiler.drain();
+    ASSERT_EQ(entries.size(), 3);
+
+    EXPECT_EQ(entries[0].code_hash, a);
+    EXPECT_EQ(entries[0].entrypoint, Interpreter);
+    EXPECT_EQ(entries[0].totals.wall_nanos, 400);
+
+    EXPECT_EQ(entries[1].code_hash, b);
+    EXPECT_EQ(entries[1].entrypoint, Native);
+
+    EXPECT_EQ(entries[2].code_hash, a);
+    EXPECT_EQ(entries[2].entrypoint, Native);
+    EXPECT_EQ(entries[2].totals.sample_count, 2);
+    EXPECT_EQ(entries[2].totals.wall_nanos, 150);
+    EXPECT_EQ(entries[2].totals.gas_used, 1'500);
+    EXPECT_EQ(entries[2].totals.storage_reads, 3);
+
+    EXPECT_TRUE(profiler.drain().empty());
+}
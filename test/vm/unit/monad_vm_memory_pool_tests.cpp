@@ -17,8 +17,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <thread>
 
 using namespace monad::vm;
@@ -104,3 +107,26 @@ TEST(MonadVmMemoryPool, stress_test_in_steps)
     ASSERT_EQ(memory_pool.debug_get_cache_size(), N);
     ASSERT_TRUE(memory_pool.debug_check_uniqueness_invariant());
 }
+
+TEST(MonadVmMemoryPool, reuse_large_buffer)
+{
+    static constexpr uint32_t capacity = 8 * 1024 * 1024;
+    static constexpr uint32_t used = 3 * 4096 + 96;
+
+    MemoryPool memory_pool{capacity};
+
+    uint8_t *const m = memory_pool.alloc();
+    ASSERT_TRUE(std::all_of(
+        m, m + capacity, [](uint8_t const x) { return x == 0; }));
+
+    std::memset(m, 0xff, used);
+    std::memset(m, 0, used);
+    memory_pool.dealloc(m);
+    ASSERT_EQ(memory_pool.debug_get_cache_size(), 1);
+
+    uint8_t *const n = memory_pool.alloc();
+    ASSERT_EQ(n, m);
+    ASSERT_TRUE(std::all_of(
+        n, n + capacity, [](uint8_t const x) { return x == 0; }));
+    memory_pool.dealloc(n);
+}
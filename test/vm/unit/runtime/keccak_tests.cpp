@@ -18,8 +18,19 @@
 #include <category/core/runtime/uint256.hpp>
 #include <category/vm/evm/traits.hpp>
 #include <category/vm/runtime/keccak.hpp>
+#include <category/vm/runtime/keccak_cache.hpp>
 #include <category/vm/runtime/memory.hpp>
 
+#include <ethash/keccak.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+
 using namespace monad;
 using namespace monad::vm::runtime;
 using namespace monad::vm::compiler::test;
@@ -101,3 +112,29 @@ TYPED_TEST(RuntimeTraitsTest, KeccakExpand)
         break;
     }
 }
+
+TEST(KeccakCache, MatchesUncached)
+{
+    std::mt19937_64 rng{42};
+    std::array<uint8_t, 64> buf{};
+
+    // Mapping-style preimages: a small key space with repeated slots, so
+    // that lookups hit, miss and evict each other
+    for (size_t i = 0; i < 20'000; ++i) {
+        buf.fill(0);
+        buf[31] = static_cast<uint8_t>(rng() % 97);
+        buf[30] = static_cast<uint8_t>(rng() % 7);
+        buf[63] = static_cast<uint8_t>(rng() % 3);
+        for (size_t const size : {size_t{32}, size_t{64}}) {
+            auto const expected = ethash::keccak256(buf.data(), size);
+            auto const actual = keccak256_memo(buf.data(), size);
+            ASSERT_EQ(
+                std::memcmp(expected.bytes, actual.bytes, sizeof(actual)), 0);
+        }
+    }
+
+    // Inputs of other lengths bypass the cache
+    auto const expected = ethash::keccak256(buf.data(), 33);
+    auto const actual = keccak256_memo(buf.data(), 33);
+    ASSERT_EQ(std::memcmp(expected.bytes, actual.bytes, sizeof(actual)), 0);
+}
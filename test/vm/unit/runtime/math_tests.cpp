@@ -216,3 +216,42 @@ TYPED_TEST(RuntimeTraitsTest, Exp)
         0x6170C9D4CF040C5B5B784780A1BD33BA7B6BB3803AA626C24C21067A267C0001_u256);
     ASSERT_EQ(this->ctx_.gas_remaining, 0);
 }
+
+TEST(BarrettModulus, MatchesLongDivision)
+{
+    std::vector<uint256_t> const moduli = {
+        0x30644E72E131A029B85045B68181585D97816A916871CA8D3C208C16D87CFD47_u256,
+        0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F_u256,
+        0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141_u256,
+        0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_u256,
+        0x1000000000000000000000000000000000000000000000001_u256};
+    for (auto const &m : moduli) {
+        ASSERT_TRUE(BarrettModulus::supports(m));
+        BarrettModulus const n{m};
+        std::vector<uint256_t> const values = {
+            0,
+            1,
+            2,
+            m - 1,
+            m,
+            m + 1,
+            ~m,
+            0x747d1d94b679f91eeeee9ecca05eb0b0a71ea2020c4e94bdb62e4d5f9fef9244_u256,
+            0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_u256};
+        for (auto const &a : values) {
+            for (auto const &b : values) {
+                uint256_t result;
+                addmod_barrett(&result, &a, &b, &n);
+                ASSERT_EQ(result, addmod(a, b, m));
+                mulmod_barrett(&result, &a, &b, &n);
+                ASSERT_EQ(result, mulmod(a, b, m));
+            }
+        }
+    }
+
+    ASSERT_FALSE(BarrettModulus::supports(0));
+    ASSERT_FALSE(BarrettModulus::supports(
+        0x1000000000000000000000000000000000000000000000000_u256));
+    ASSERT_FALSE(BarrettModulus::supports(
+        0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_u256));
+}
@@ -92,6 +92,40 @@ TYPED_TEST(RuntimeTraitsTest, StorageLoadWarm)
     ASSERT_EQ(this->ctx_.gas_remaining, 0);
 }
 
+TYPED_TEST(RuntimeTraitsTest, StorageDirectHost)
+{
+    using traits = TestFixture::Trait;
+    auto load = TestFixture::wrap(sload<traits>);
+    auto store = TestFixture::wrap(sstore<traits>);
+
+    this->ctx_.monad_host = &this->host_;
+
+    this->ctx_.gas_remaining = [] {
+        if constexpr (is_monad_trait_v<traits>) {
+            if constexpr (traits::monad_rev() >= MONAD_SEVEN) {
+                return 8000;
+            }
+        }
+        return 2000;
+    }();
+    ASSERT_EQ(load(key), 0);
+    ASSERT_EQ(this->ctx_.result.status, StatusCode::Success);
+    ASSERT_EQ(this->ctx_.gas_remaining, 0);
+
+    this->ctx_.gas_remaining = 100'000;
+    store(key, val);
+    ASSERT_EQ(this->ctx_.result.status, StatusCode::Success);
+    ASSERT_EQ(
+        load_be<uint256_t>(this->host_.get_storage(
+            this->ctx_.env.recipient, store_be_as<bytes32_t>(key))),
+        val);
+
+    this->ctx_.gas_remaining = 0;
+    ASSERT_EQ(load(key), val);
+    ASSERT_EQ(this->ctx_.result.status, StatusCode::Success);
+    ASSERT_EQ(this->ctx_.gas_remaining, 0);
+}
+
 TYPED_TEST(RuntimeTraitsTest, StorageOriginalEmpty)
 {
     static_assert(TestFixture::Trait::evm_rev() >= MONAD_ETH_BERLIN);